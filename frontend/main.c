@@ -51,6 +51,14 @@
 #include <string.h>
 #include <getopt.h>
 
+#ifdef USE_THREADS
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+#endif
+
 #include <neaacdec.h>
 
 #include "unicode_support.h"
@@ -188,6 +196,172 @@ static void lookforheader(aac_buffer *b)
     }
 }
 
+/* Parse stage of the pipelined decoding (-T): NeAACDecParse of the next
+   frame runs on a helper thread while the current frame is synthesized */
+typedef struct {
+    NeAACDecHandle hDecoder;
+    unsigned char *buffer;
+    unsigned long buffer_size;
+    NeAACDecFrameInfo frameInfo;
+    unsigned char queued;
+#ifdef USE_THREADS
+    int threaded;
+    int busy;
+    int quit;
+#ifdef _WIN32
+    HANDLE thread;
+    CRITICAL_SECTION lock;
+    CONDITION_VARIABLE cond;
+#else
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+#endif
+#endif
+} frame_parser;
+
+#ifdef USE_THREADS
+#ifdef _WIN32
+# define parser_lock(p)      EnterCriticalSection(&(p)->lock)
+# define parser_unlock(p)    LeaveCriticalSection(&(p)->lock)
+# define parser_wake(p)      WakeAllConditionVariable(&(p)->cond)
+# define parser_sleep(p)     SleepConditionVariableCS(&(p)->cond, &(p)->lock, INFINITE)
+#else
+# define parser_lock(p)      pthread_mutex_lock(&(p)->lock)
+# define parser_unlock(p)    pthread_mutex_unlock(&(p)->lock)
+# define parser_wake(p)      pthread_cond_broadcast(&(p)->cond)
+# define parser_sleep(p)     pthread_cond_wait(&(p)->cond, &(p)->lock)
+#endif
+#endif
+
+static void parser_run(frame_parser *p)
+{
+    p->queued = NeAACDecParse(p->hDecoder, &p->frameInfo, p->buffer, p->buffer_size);
+}
+
+#ifdef USE_THREADS
+static void parser_work(frame_parser *p)
+{
+    parser_lock(p);
+    for (;;)
+    {
+        while (!p->busy && !p->quit)
+            parser_sleep(p);
+        if (p->quit)
+            break;
+        parser_unlock(p);
+
+        parser_run(p);
+
+        parser_lock(p);
+        p->busy = 0;
+        parser_wake(p);
+    }
+    parser_unlock(p);
+}
+
+#ifdef _WIN32
+static unsigned __stdcall parser_thread(void *arg)
+{
+    parser_work((frame_parser*)arg);
+    return 0;
+}
+#else
+static void *parser_thread(void *arg)
+{
+    parser_work((frame_parser*)arg);
+    return NULL;
+}
+#endif
+#endif
+
+static void parser_open(frame_parser *p, NeAACDecHandle hDecoder)
+{
+    memset(p, 0, sizeof(frame_parser));
+    p->hDecoder = hDecoder;
+
+#ifdef USE_THREADS
+    /* without the helper thread the stages simply take turns */
+#ifdef _WIN32
+    InitializeCriticalSection(&p->lock);
+    InitializeConditionVariable(&p->cond);
+    p->thread = (HANDLE)_beginthreadex(NULL, 0, parser_thread, p, 0, NULL);
+    p->threaded = (p->thread != 0);
+#else
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->cond, NULL);
+    p->threaded = (pthread_create(&p->thread, NULL, parser_thread, p) == 0);
+#endif
+#endif
+}
+
+static void parser_close(frame_parser *p)
+{
+#ifdef USE_THREADS
+    if (p->threaded)
+    {
+        parser_lock(p);
+        while (p->busy)
+            parser_sleep(p);
+        p->quit = 1;
+        parser_wake(p);
+        parser_unlock(p);
+#ifdef _WIN32
+        WaitForSingleObject(p->thread, INFINITE);
+        CloseHandle(p->thread);
+#else
+        pthread_join(p->thread, NULL);
+#endif
+    }
+#ifdef _WIN32
+    DeleteCriticalSection(&p->lock);
+#else
+    pthread_cond_destroy(&p->cond);
+    pthread_mutex_destroy(&p->lock);
+#endif
+#endif
+}
+
+/* parse the frame in buffer, the buffer has to stay untouched until
+   parser_wait returns */
+static void parser_start(frame_parser *p, unsigned char *buffer, unsigned long buffer_size)
+{
+    p->buffer = buffer;
+    p->buffer_size = buffer_size;
+
+#ifdef USE_THREADS
+    if (p->threaded)
+    {
+        parser_lock(p);
+        p->busy = 1;
+        parser_wake(p);
+        parser_unlock(p);
+        return;
+    }
+#endif
+    parser_run(p);
+}
+
+/* called after the previous frame was synthesized; a frame that could not
+   be queued while that one was waiting is parsed again now */
+static unsigned char parser_wait(frame_parser *p, NeAACDecFrameInfo *frameInfo)
+{
+#ifdef USE_THREADS
+    if (p->threaded)
+    {
+        parser_lock(p);
+        while (p->busy)
+            parser_sleep(p);
+        parser_unlock(p);
+    }
+#endif
+    if (!p->queued)
+        parser_run(p);
+
+    *frameInfo = p->frameInfo;
+    return p->queued;
+}
+
 static int adts_sample_rates[] = {96000,88200,64000,48000,44100,32000,24000,22050,16000,12000,11025,8000,7350,0,0,0};
 
 static int adts_parse(aac_buffer *b, int *bitrate, float *length)
@@ -425,11 +599,13 @@ static void usage(void)
     faad_fprintf(stdout, "        2:  LC (Low Complexity) object type.\n");
     faad_fprintf(stdout, "        4:  LTP (Long Term Prediction) object type.\n");
     faad_fprintf(stdout, "        23: LD (Low Delay) object type.\n");
-    faad_fprintf(stdout, " -d    Down matrix 5.1 to 2 channels\n");
+    faad_fprintf(stdout, " -d    Down matrix 5.1 and 7.1 to 2 channels\n");
     faad_fprintf(stdout, " -w    Write output to stdio instead of a file.\n");
     faad_fprintf(stdout, " -g    Disable gapless decoding.\n");
     faad_fprintf(stdout, " -q    Quiet - suppresses status messages.\n");
     faad_fprintf(stdout, " -j X  Jump - start output X seconds into track (MP4 files only).\n");
+    faad_fprintf(stdout, " -T X  Decode on X threads, parsing the next frame while the\n");
+    faad_fprintf(stdout, "       current one is synthesized.\n");
     faad_fprintf(stdout, "Example:\n");
     faad_fprintf(stdout, "       %s infile.aac\n", progName);
     faad_fprintf(stdout, "       %s infile.mp4\n", progName);
@@ -442,7 +618,7 @@ static void usage(void)
 static int decodeAACfile(char *aacfile, char *sndfile, char *adts_fn, int to_stdout,
                   int def_srate, unsigned char object_type, unsigned char outputFormat, int fileType,
                   unsigned char downMatrix, int infoOnly, int adts_out, unsigned char old_format,
-                  float *song_length)
+                  float *song_length, int threads)
 {
     int tagsize;
     unsigned long samplerate;
@@ -472,6 +648,11 @@ static int decodeAACfile(char *aacfile, char *sndfile, char *adts_fn, int to_std
     int retval;
     int streaminput = 0;
 
+    /* ADTS output copies the frame bytes after decoding them */
+    int pipelined = (threads > 1) && !adts_out;
+    int parsing = 0;
+    frame_parser parser;
+
     aac_buffer b;
 
     memset(&b, 0, sizeof(aac_buffer));
@@ -563,6 +744,10 @@ static int decodeAACfile(char *aacfile, char *sndfile, char *adts_fn, int to_std
     //config->dontUpSampleImplicitSBR = 1;
     NeAACDecSetConfiguration(hDecoder, config);
 
+    /* one thread goes to the parse stage when pipelined */
+    if (threads > 1)
+        NeAACDecSetThreads(hDecoder, (unsigned char)min(threads - pipelined, 255));
+
     /* get AAC infos for printing */
     header_type = 0;
     if (streaminput == 1)
@@ -666,10 +851,37 @@ static int decodeAACfile(char *aacfile, char *sndfile, char *adts_fn, int to_std
         return 0;
     }
 
+    if (pipelined)
+    {
+        parser_open(&parser, hDecoder);
+        parser_start(&parser, b.buffer, b.bytes_into_buffer);
+    }
+
     do
     {
-        sample_buffer = NeAACDecDecode(hDecoder, &frameInfo,
-            b.buffer, b.bytes_into_buffer);
+        if (pipelined)
+        {
+            NeAACDecFrameInfo parseInfo;
+
+            if (!parser_wait(&parser, &parseInfo))
+            {
+                faad_fprintf(stderr, "Error: %s\n",
+                    NeAACDecGetErrorMessage(parseInfo.error));
+                break;
+            }
+
+            /* the next frame is parsed while this one is synthesized */
+            advance_buffer(&b, parseInfo.bytesconsumed);
+            fill_buffer(&b);
+            parsing = (parseInfo.error == 0) && (b.bytes_into_buffer > 0);
+            if (parsing)
+                parser_start(&parser, b.buffer, b.bytes_into_buffer);
+
+            sample_buffer = NeAACDecSynthesize(hDecoder, &frameInfo);
+        } else {
+            sample_buffer = NeAACDecDecode(hDecoder, &frameInfo,
+                b.buffer, b.bytes_into_buffer);
+        }
 
         if (adts_out == 1)
         {
@@ -687,7 +899,8 @@ static int decodeAACfile(char *aacfile, char *sndfile, char *adts_fn, int to_std
         }
 
         /* update buffer indices */
-        advance_buffer(&b, frameInfo.bytesconsumed);
+        if (!pipelined)
+            advance_buffer(&b, frameInfo.bytesconsumed);
 
         /* check if the inconsistent number of channels */
         if (aufile != NULL && frameInfo.channels != aufile->channels)
@@ -718,6 +931,8 @@ static int decodeAACfile(char *aacfile, char *sndfile, char *adts_fn, int to_std
                 }
                 if (aufile == NULL)
                 {
+                    if (pipelined)
+                        parser_close(&parser);
                     if (b.buffer)
                         free(b.buffer);
                     NeAACDecClose(hDecoder);
@@ -748,14 +963,23 @@ static int decodeAACfile(char *aacfile, char *sndfile, char *adts_fn, int to_std
                 break;
         }
 
-        /* fill buffer */
-        fill_buffer(&b);
+        if (pipelined)
+        {
+            if (!parsing)
+                sample_buffer = NULL;
+        } else {
+            /* fill buffer */
+            fill_buffer(&b);
 
-        if (b.bytes_into_buffer == 0)
-            sample_buffer = NULL; /* to make sure it stops now */
+            if (b.bytes_into_buffer == 0)
+                sample_buffer = NULL; /* to make sure it stops now */
+        }
 
     } while (sample_buffer != NULL);
 
+    if (pipelined)
+        parser_close(&parser);
+
     NeAACDecClose(hDecoder);
 
     if (adts_out == 1)
@@ -777,7 +1001,7 @@ static int decodeAACfile(char *aacfile, char *sndfile, char *adts_fn, int to_std
 
 static int decodeMP4file(char *mp4file, char *sndfile, char *adts_fn, int to_stdout,
                   unsigned char outputFormat, int fileType, unsigned char downMatrix, int noGapless,
-                  int infoOnly, int adts_out, float *song_length, float seek_to)
+                  int infoOnly, int adts_out, float *song_length, float seek_to, int threads)
 {
     /*int track;*/
     unsigned long samplerate;
@@ -802,6 +1026,11 @@ static int decodeMP4file(char *mp4file, char *sndfile, char *adts_fn, int to_std
 
     int first_time = 1;
 
+    /* ADTS output copies the frame bytes after decoding them */
+    int pipelined = (threads > 1) && !adts_out;
+    int parsing = 0;
+    frame_parser parser;
+
     /* for gapless decoding */
     unsigned int useAacLength = 1;
     unsigned int framesize;
@@ -833,6 +1062,10 @@ static int decodeMP4file(char *mp4file, char *sndfile, char *adts_fn, int to_std
     //config->dontUpSampleImplicitSBR = 1;
     NeAACDecSetConfiguration(hDecoder, config);
 
+    /* one thread goes to the parse stage when pipelined */
+    if (threads > 1)
+        NeAACDecSetThreads(hDecoder, (unsigned char)min(threads - pipelined, 255));
+
     if (adts_out)
     {
         adtsFile = faad_fopen(adts_fn, "wb");
@@ -895,16 +1128,44 @@ static int decodeMP4file(char *mp4file, char *sndfile, char *adts_fn, int to_std
     }
 
     mp4read_seek(startSampleId);
+    if (pipelined)
+    {
+        parser_open(&parser, hDecoder);
+        parsing = (startSampleId < mp4config.frame.nsamples) && !mp4read_frame();
+        if (parsing)
+            parser_start(&parser, mp4config.bitbuf.data, mp4config.bitbuf.size);
+    }
     for (sampleId = startSampleId; sampleId < mp4config.frame.nsamples; sampleId++)
     {
         /*int rc;*/
         unsigned long dur;
         unsigned int sample_count;
 
-        if (mp4read_frame())
-            break;
+        if (pipelined)
+        {
+            NeAACDecFrameInfo parseInfo;
+
+            if (!parsing)
+                break;
+            if (!parser_wait(&parser, &parseInfo))
+            {
+                faad_fprintf(stderr, "Warning: %s\n",
+                    NeAACDecGetErrorMessage(parseInfo.error));
+                break;
+            }
+
+            /* the next frame is parsed while this one is synthesized */
+            parsing = (sampleId+1 < mp4config.frame.nsamples) && !mp4read_frame();
+            if (parsing)
+                parser_start(&parser, mp4config.bitbuf.data, mp4config.bitbuf.size);
+
+            sample_buffer = NeAACDecSynthesize(hDecoder, &frameInfo);
+        } else {
+            if (mp4read_frame())
+                break;
 
-        sample_buffer = NeAACDecDecode(hDecoder, &frameInfo, mp4config.bitbuf.data, mp4config.bitbuf.size);
+            sample_buffer = NeAACDecDecode(hDecoder, &frameInfo, mp4config.bitbuf.data, mp4config.bitbuf.size);
+        }
 
         if (!sample_buffer) {
             /* unable to decode file, abort */
@@ -968,6 +1229,8 @@ static int decodeMP4file(char *mp4file, char *sndfile, char *adts_fn, int to_std
                 }
                 if (aufile == NULL)
                 {
+                    if (pipelined)
+                        parser_close(&parser);
                     NeAACDecClose(hDecoder);
                     mp4read_close();
                     return 0;
@@ -1000,6 +1263,9 @@ static int decodeMP4file(char *mp4file, char *sndfile, char *adts_fn, int to_std
         }
     }
 
+    if (pipelined)
+        parser_close(&parser);
+
     NeAACDecClose(hDecoder);
 
     if (adts_out == 1)
@@ -1037,6 +1303,7 @@ static int faad_main(int argc, char *argv[])
     char *audioFileName = NULL;
     char *adtsFileName = NULL;
     float seekTo = 0;
+    int threads = 1;
     unsigned char header[8];
     size_t bread;
     float length = 0;
@@ -1073,11 +1340,12 @@ static int faad_main(int argc, char *argv[])
             { "stdio",      0, 0, 'w' },
             { "stdio",      0, 0, 'g' },
             { "seek",       1, 0, 'j' },
+            { "threads",    1, 0, 'T' },
             { "help",       0, 0, 'h' },
             { 0, 0, 0, 0 }
         };
 
-        c = getopt_long(argc, argv, "o:a:s:f:b:l:j:wgdhitq",
+        c = getopt_long(argc, argv, "o:a:s:f:b:l:j:T:wgdhitq",
             long_options, &option_index);
 
         if (c == -1)
@@ -1178,6 +1446,14 @@ static int faad_main(int argc, char *argv[])
                 seekTo = (float)atof(optarg);
             }
             break;
+        case 'T':
+            if (optarg)
+            {
+                threads = atoi(optarg);
+                if (threads < 1)
+                    showHelp = 1;
+            }
+            break;
         case 't':
             old_format = 1;
             break;
@@ -1316,7 +1592,8 @@ static int faad_main(int argc, char *argv[])
     if (mp4file)
     {
         result = decodeMP4file(aacFileName, audioFileName, adtsFileName, writeToStdio,
-            outputFormat, format, downMatrix, noGapless, infoOnly, adts_out, &length, seekTo);
+            outputFormat, format, downMatrix, noGapless, infoOnly, adts_out, &length, seekTo,
+            threads);
     } else {
 
     if (readFromStdin == 1) {
@@ -1332,7 +1609,7 @@ static int faad_main(int argc, char *argv[])
 
         result = decodeAACfile(aacFileName, audioFileName, adtsFileName, writeToStdio,
             def_srate, object_type, outputFormat, format, downMatrix, infoOnly, adts_out,
-            old_format, &length);
+            old_format, &length, threads);
     }
 
     if (audioFileName != NULL)
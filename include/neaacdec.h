@@ -102,6 +102,12 @@ extern "C" {
 #define FAAD_FMT_FIXED  FAAD_FMT_FLOAT
 #define FAAD_FMT_DOUBLE 5
 
+/* downmix modes, the downMatrix configuration field */
+#define FAAD_DMX_OFF    0
+#define FAAD_DMX_STEREO 1 /* 5.0, 5.1 and 7.1 to stereo */
+#define FAAD_DMX_MONO   2 /* stereo, 5.0, 5.1 and 7.1 to mono */
+#define FAAD_DMX_5_1    3 /* 7.1 to 5.1 */
+
 /* Capabilities */
 #define LC_DEC_CAP           (1<<0) /* Can decode LC */
 #define MAIN_DEC_CAP         (1<<1) /* Can decode MAIN */
@@ -136,6 +142,7 @@ extern "C" {
 
 
 typedef void *NeAACDecHandle;
+typedef void *NeAACDecSharedHandle;
 
 typedef struct mp4AudioSpecificConfig
 {
@@ -168,6 +175,11 @@ typedef struct NeAACDecConfiguration
     unsigned char downMatrix;
     unsigned char useOldADTSFormat;
     unsigned char dontUpSampleImplicitSBR;
+    unsigned char preallocate;
+    unsigned char useLowPowerSBR;
+    unsigned char useFastMathSBR;
+    unsigned long skipChannels;
+    unsigned long outputSampleRate;
 } NeAACDecConfiguration, *NeAACDecConfigurationPtr;
 
 typedef struct NeAACDecFrameInfo
@@ -198,17 +210,95 @@ typedef struct NeAACDecFrameInfo
     unsigned char ps;
 } NeAACDecFrameInfo;
 
+/* One stream of a NeAACDecDecodeBatch call */
+typedef struct NeAACDecBatchItem
+{
+    /* in: decoder handle and one frame of input for it */
+    NeAACDecHandle hDecoder;
+    unsigned char *buffer;
+    unsigned long buffer_size;
+
+    /* in: output buffer, or NULL (and size 0) to use the internal buffer */
+    void *sample_buffer;
+    unsigned long sample_buffer_size;
+
+    /* out: decoded samples (NULL on error or when there is no output) */
+    void *samples;
+    NeAACDecFrameInfo frameInfo;
+} NeAACDecBatchItem;
+
+/* User memory callbacks for NeAACDecOpenWithAllocator */
+typedef struct NeAACDecAllocator
+{
+    void* (*alloc)(void *user_data, unsigned long size);
+    void (*free)(void *user_data, void *ptr);
+    void *user_data;
+} NeAACDecAllocator;
+
+/* Task scheduler for NeAACDecSetScheduler; run calls task(arg, i) for
+   every i below count, in any order and possibly in parallel, and returns
+   once all of them have finished */
+typedef struct NeAACDecScheduler
+{
+    void (*run)(void *user_data, void (*task)(void *arg, unsigned long i),
+                void *arg, unsigned long count);
+    void *user_data;
+} NeAACDecScheduler;
+
 NEAACDECAPI char* NeAACDecGetErrorMessage(unsigned char errcode);
 
 NEAACDECAPI unsigned long NeAACDecGetCapabilities(void);
 
 NEAACDECAPI NeAACDecHandle NeAACDecOpen(void);
 
+/* Open a decoder whose instance state comes from the given callbacks */
+NEAACDECAPI NeAACDecHandle NeAACDecOpenWithAllocator(const NeAACDecAllocator *allocator);
+
+/* Open a decoder whose instance state is carved from a caller-provided
+   arena; the arena must stay valid until NeAACDecClose */
+NEAACDECAPI NeAACDecHandle NeAACDecOpenWithArena(void *arena,
+                                                 unsigned long arena_size);
+
 NEAACDECAPI NeAACDecConfigurationPtr NeAACDecGetCurrentConfiguration(NeAACDecHandle hDecoder);
 
 NEAACDECAPI unsigned char NeAACDecSetConfiguration(NeAACDecHandle hDecoder,
                                                    NeAACDecConfigurationPtr config);
 
+/* Mix every frame of a stream with in_channels channels down to
+   out_channels (at most 8) channels, before the conversion to the output
+   format. matrix holds out_channels rows of in_channels gains, for the
+   decoded channels in their normal output order. Takes precedence over
+   the downMatrix configuration; a NULL matrix removes it. Returns 0 when
+   the matrix is not accepted. */
+NEAACDECAPI unsigned char NeAACDecSetDownmixMatrix(NeAACDecHandle hDecoder,
+                                                   const float *matrix,
+                                                   unsigned char in_channels,
+                                                   unsigned char out_channels);
+
+/* Create a reference counted context with the read-only filterbank tables
+   that decoders opened by NeAACDecOpenShared use instead of their own */
+NEAACDECAPI NeAACDecSharedHandle NeAACDecSharedOpen(void);
+
+/* Drop the reference of the creator; the context goes away once the
+   last decoder using it is closed */
+NEAACDECAPI void NeAACDecSharedClose(NeAACDecSharedHandle hShared);
+
+NEAACDECAPI NeAACDecHandle NeAACDecOpenShared(NeAACDecSharedHandle hShared);
+
+/* Bytes of memory currently held by the decoder */
+NEAACDECAPI unsigned long NeAACDecGetMemoryUsage(NeAACDecHandle hDecoder);
+
+/* Decode with the given number of threads, the calling one included;
+   the SBR of the channel elements and the two channels of a channel pair
+   then run in parallel */
+NEAACDECAPI unsigned char NeAACDecSetThreads(NeAACDecHandle hDecoder,
+                                             unsigned char threads);
+
+/* Hand the parallel parts of decoding to the caller's scheduler instead
+   of decoder owned threads; NULL goes back to decoding on one thread */
+NEAACDECAPI unsigned char NeAACDecSetScheduler(NeAACDecHandle hDecoder,
+                                               const NeAACDecScheduler *scheduler);
+
 /* Init the library based on info from the AAC file (ADTS/ADIF) */
 NEAACDECAPI long NeAACDecInit(NeAACDecHandle hDecoder,
                               unsigned char *buffer,
@@ -243,6 +333,51 @@ NEAACDECAPI void* NeAACDecDecode2(NeAACDecHandle hDecoder,
                                   void **sample_buffer,
                                   unsigned long sample_buffer_size);
 
+/* Decode one frame into one buffer per output channel instead of an
+   interleaved buffer, in the configured outputFormat. channel_buffers
+   holds channel_count pointers of channel_buffer_size bytes each;
+   returns channel_buffers, or NULL on error */
+NEAACDECAPI void** NeAACDecDecodePlanar(NeAACDecHandle hDecoder,
+                                        NeAACDecFrameInfo *hInfo,
+                                        unsigned char *buffer,
+                                        unsigned long buffer_size,
+                                        void **channel_buffers,
+                                        unsigned char channel_count,
+                                        unsigned long channel_buffer_size);
+
+/* Decode one frame without copying the output: returns hInfo->channels
+   pointers to the decoder's own float buffers, read-only and valid until
+   the next call on hDecoder. The samples are not scaled, full scale is
+   +-32768 as for FAAD_FMT_16BIT. Not available with downMatrix or in
+   fixed point builds */
+NEAACDECAPI const float* const* NeAACDecDecodeZeroCopy(NeAACDecHandle hDecoder,
+                                                       NeAACDecFrameInfo *hInfo,
+                                                       unsigned char *buffer,
+                                                       unsigned long buffer_size);
+
+/* Decode one frame for each of count independent streams. The frames are
+   parsed and then synthesized stream after stream, as with NeAACDecParse
+   and NeAACDecSynthesize; returns the number of streams decoded without
+   error */
+NEAACDECAPI unsigned long NeAACDecDecodeBatch(NeAACDecBatchItem *items,
+                                              unsigned long count);
+
+/* Split decoding: NeAACDecParse reads a frame up to and including the
+   Huffman decoding and queues it, NeAACDecSynthesize decodes the oldest
+   queued frame to PCM. The two may run at the same time on different
+   threads, so the parsing of a frame overlaps the synthesis of the one
+   before. NeAACDecParse returns 0 when the frame could not be queued;
+   the same buffer can be passed again after a NeAACDecSynthesize call.
+   NeAACDecPostSeekReset drops the queued frames and must not overlap
+   either call. */
+NEAACDECAPI unsigned char NeAACDecParse(NeAACDecHandle hDecoder,
+                                        NeAACDecFrameInfo *hInfo,
+                                        unsigned char *buffer,
+                                        unsigned long buffer_size);
+
+NEAACDECAPI void* NeAACDecSynthesize(NeAACDecHandle hDecoder,
+                                     NeAACDecFrameInfo *hInfo);
+
 NEAACDECAPI char NeAACDecAudioSpecificConfig(unsigned char *pBuffer,
                                              unsigned long buffer_size,
                                              mp4AudioSpecificConfig *mp4ASC);
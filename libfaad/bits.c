@@ -34,68 +34,34 @@
 #include <stdlib.h>
 #include "bits.h"
 
-/* reads only n bytes from the stream instead of the standard 4 */
-static /*INLINE*/ uint32_t getdword_n(void *mem, int n)
+/* load the cache starting at byte offset bytes of the buffer */
+static void faad_loadbits(bitfile *ld, uint32_t bytes)
 {
-    uint8_t* m8 = (uint8_t*)mem;
-    switch (n)
-    {
-    case 3:
-        return ((uint32_t)m8[2] << 8) | ((uint32_t)m8[1] << 16) | ((uint32_t)m8[0] << 24);
-    case 2:
-        return ((uint32_t)m8[1] << 16) | ((uint32_t)m8[0] << 24);
-    case 1:
-        return (uint32_t)m8[0] << 24;
-    default:
-        return 0;
-    }
+    if (ld->buffer_size < bytes)
+        ld->bytes_left = 0;
+    else
+        ld->bytes_left = ld->buffer_size - bytes;
+
+    ld->tail = ld->start + bytes;
+    ld->cache = 0;
+    ld->bits_left = 0;
+    faad_refill(ld);
 }
 
 /* initialize buffer, call once before first getbits or showbits */
 void faad_initbits(bitfile *ld, const void *_buffer, const uint32_t buffer_size)
 {
-    uint32_t tmp;
-
     if (ld == NULL)
         return;
 
-    if (buffer_size == 0 || _buffer == NULL)
-    {
-        ld->error = 1;
-        return;
-    }
-
     ld->buffer = _buffer;
+    ld->buffer_size = (_buffer == NULL) ? 0 : buffer_size;
+    ld->start = (const uint8_t*)ld->buffer;
 
-    ld->buffer_size = buffer_size;
-    ld->bytes_left  = buffer_size;
-
-    if (ld->bytes_left >= 4)
-    {
-        tmp = getdword((uint32_t*)ld->buffer);
-        ld->bytes_left -= 4;
-    } else {
-        tmp = getdword_n((uint32_t*)ld->buffer, ld->bytes_left);
-        ld->bytes_left = 0;
-    }
-    ld->bufa = tmp;
-
-    if (ld->bytes_left >= 4)
-    {
-        tmp = getdword((uint32_t*)ld->buffer + 1);
-        ld->bytes_left -= 4;
-    } else {
-        tmp = getdword_n((uint32_t*)ld->buffer + 1, ld->bytes_left);
-        ld->bytes_left = 0;
-    }
-    ld->bufb = tmp;
-
-    ld->start = (uint32_t*)ld->buffer;
-    ld->tail = ((uint32_t*)ld->buffer + 2);
-
-    ld->bits_left = 32;
+    /* an empty buffer reads as zeroes */
+    faad_loadbits(ld, 0);
 
-    ld->error = 0;
+    ld->error = (ld->buffer_size == 0) ? 1 : 0;
 }
 
 void faad_endbits(bitfile *ld)
@@ -105,12 +71,12 @@ void faad_endbits(bitfile *ld)
 
 uint32_t faad_get_processed_bits(bitfile *ld)
 {
-    return (uint32_t)(8 * (4*(ld->tail - ld->start) - 4) - (ld->bits_left));
+    return (uint32_t)(8 * (ld->tail - ld->start) - ld->bits_left);
 }
 
 uint8_t faad_byte_align(bitfile *ld)
 {
-    int remainder = (32 - ld->bits_left) & 0x7;
+    int remainder = (64 - ld->bits_left) & 0x7;
 
     if (remainder)
     {
@@ -120,106 +86,56 @@ uint8_t faad_byte_align(bitfile *ld)
     return 0;
 }
 
+/* flush more than 32 bits at once */
 void faad_flushbits_ex(bitfile *ld, uint32_t bits)
 {
-    uint32_t tmp;
+    while (bits > 32)
+    {
+        faad_flushbits(ld, 32);
+        bits -= 32;
+    }
+    faad_flushbits(ld, bits);
+}
 
-    ld->bufa = ld->bufb;
-    if (ld->bytes_left >= 4)
+/* byte-wise refill for the last 7 bytes of the buffer, reads zeroes
+   past its end */
+void faad_refill_ex(bitfile *ld)
+{
+    while (ld->bits_left <= 56)
     {
-        tmp = getdword(ld->tail);
-        ld->bytes_left -= 4;
-    } else {
-        tmp = getdword_n(ld->tail, ld->bytes_left);
-        ld->bytes_left = 0;
+        if (ld->bytes_left > 0)
+        {
+            ld->cache |= (uint64_t)*ld->tail << (56 - ld->bits_left);
+            ld->bytes_left--;
+        }
+        ld->tail++;
+        ld->bits_left += 8;
     }
-    ld->bufb = tmp;
-    ld->tail++;
-    ld->bits_left += (32 - bits);
-    //ld->bytes_left -= 4;
-//    if (ld->bytes_left == 0)
-//        ld->no_more_reading = 1;
-//    if (ld->bytes_left < 0)
-//        ld->error = 1;
 }
 
 #ifdef DRM
 /* rewind to beginning */
 void faad_rewindbits(bitfile *ld)
 {
-    uint32_t tmp;
-
-    ld->bytes_left = ld->buffer_size;
-
-    if (ld->bytes_left >= 4)
-    {
-        tmp = getdword((uint32_t*)&ld->start[0]);
-        ld->bytes_left -= 4;
-    } else {
-        tmp = getdword_n((uint32_t*)&ld->start[0], ld->bytes_left);
-        ld->bytes_left = 0;
-    }
-    ld->bufa = tmp;
-
-    if (ld->bytes_left >= 4)
-    {
-        tmp = getdword((uint32_t*)&ld->start[1]);
-        ld->bytes_left -= 4;
-    } else {
-        tmp = getdword_n((uint32_t*)&ld->start[1], ld->bytes_left);
-        ld->bytes_left = 0;
-    }
-    ld->bufb = tmp;
-
-    ld->bits_left = 32;
-    ld->tail = &ld->start[2];
+    faad_loadbits(ld, 0);
 }
 #endif
 
 /* reset to a certain point */
 void faad_resetbits(bitfile *ld, uint32_t bits)
 {
-    uint32_t tmp;
-    uint32_t words = bits >> 5;
-    uint32_t remainder = bits & 0x1F;
-
-    if (ld->buffer_size < words * 4)
-        ld->bytes_left = 0;
-    else
-        ld->bytes_left = ld->buffer_size - words*4;
+    uint32_t remainder = bits & 0x7;
 
-    if (ld->bytes_left >= 4)
-    {
-        tmp = getdword(&ld->start[words]);
-        ld->bytes_left -= 4;
-    } else {
-        tmp = getdword_n(&ld->start[words], ld->bytes_left);
-        ld->bytes_left = 0;
-    }
-    ld->bufa = tmp;
-
-    if (ld->bytes_left >= 4)
-    {
-        tmp = getdword(&ld->start[words+1]);
-        ld->bytes_left -= 4;
-    } else {
-        tmp = getdword_n(&ld->start[words+1], ld->bytes_left);
-        ld->bytes_left = 0;
-    }
-    ld->bufb = tmp;
-
-    ld->bits_left = 32 - remainder;
-    ld->tail = &ld->start[words+2];
+    faad_loadbits(ld, bits >> 3);
+    ld->cache <<= remainder;
+    ld->bits_left -= remainder;
 
     /* recheck for reading too many bytes */
     ld->error = 0;
-//    if (ld->bytes_left == 0)
-//        ld->no_more_reading = 1;
-//    if (ld->bytes_left < 0)
-//        ld->error = 1;
 }
 
-uint8_t *faad_getbitbuffer(bitfile *ld, uint32_t bits
+/* reads bits into buffer, which must hold (bits+8)/8 bytes */
+uint8_t *faad_getbitbuffer(bitfile *ld, uint8_t *buffer, uint32_t bits
                        DEBUGDEC)
 {
     int i;
@@ -227,8 +143,6 @@ uint8_t *faad_getbitbuffer(bitfile *ld, uint32_t bits
     int bytes = bits >> 3;
     int remainder = bits & 0x7;
 
-    uint8_t *buffer = (uint8_t*)faad_malloc((bytes+1)*sizeof(uint8_t));
-
     for (i = 0; i < bytes; i++)
     {
         buffer[i] = (uint8_t)faad_getbits(ld, 8 DEBUGVAR(print,var,dbg));
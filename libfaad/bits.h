@@ -48,14 +48,13 @@ extern "C" {
 typedef struct _bitfile
 {
     const void *buffer;
-    uint32_t *tail;
-    uint32_t *start;
+    const uint8_t *tail; /* next byte to load into the cache */
+    const uint8_t *start;
     /* bit input */
-    uint32_t bufa;
-    uint32_t bufb;
-    uint32_t bits_left;
+    uint64_t cache; /* unread bits, MSB first */
+    uint32_t bits_left; /* valid bits in cache, >= 32 between calls */
     uint32_t buffer_size; /* size of the buffer in bytes */
-    uint32_t bytes_left;
+    uint32_t bytes_left; /* bytes not yet loaded into the cache */
     uint8_t error;
 } bitfile;
 
@@ -81,11 +80,12 @@ void faad_initbits_rev(bitfile *ld, void *buffer,
 uint8_t faad_byte_align(bitfile *ld);
 uint32_t faad_get_processed_bits(bitfile *ld);
 void faad_flushbits_ex(bitfile *ld, uint32_t bits);
+void faad_refill_ex(bitfile *ld);
 #ifdef DRM
 void faad_rewindbits(bitfile *ld);
 #endif
 void faad_resetbits(bitfile *ld, uint32_t bits);
-uint8_t *faad_getbitbuffer(bitfile *ld, uint32_t bits
+uint8_t *faad_getbitbuffer(bitfile *ld, uint8_t *buffer, uint32_t bits
                        DEBUGDEC);
 #ifdef DRM
 void *faad_origbitbuffer(bitfile *ld);
@@ -99,17 +99,47 @@ static INLINE uint32_t getdword(void *mem)
     return (uint32_t)m8[3] | ((uint32_t)m8[2] << 8) | ((uint32_t)m8[1] << 16) | ((uint32_t)m8[0] << 24);
 }
 
-static INLINE uint32_t faad_showbits(bitfile *ld, uint32_t bits)
+/* big endian 64 bit load from an unaligned address */
+static INLINE uint64_t getqword(const uint8_t *m8)
 {
-    if (bits <= ld->bits_left)
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    uint64_t v;
+    memcpy(&v, m8, sizeof(v));
+    return __builtin_bswap64(v);
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    uint64_t v;
+    memcpy(&v, m8, sizeof(v));
+    return v;
+#elif defined(_MSC_VER)
+    uint64_t v;
+    memcpy(&v, m8, sizeof(v));
+    return _byteswap_uint64(v);
+#else
+    return ((uint64_t)getdword((void*)m8) << 32) | getdword((void*)(m8 + 4));
+#endif
+}
+
+/* top up the cache to at least 56 bits; only called with bits_left < 64 */
+static INLINE void faad_refill(bitfile *ld)
+{
+    if (ld->bytes_left >= 8)
     {
-        //return (ld->bufa >> (ld->bits_left - bits)) & bitmask[bits];
-        return (ld->bufa << (32 - ld->bits_left)) >> (32 - bits);
+        /* the bytes past the ones counted here are also ORed in, they are
+           the same stream bits so the next refill ORs them again unchanged */
+        uint32_t n = (63 - ld->bits_left) >> 3;
+
+        ld->cache |= getqword(ld->tail) >> ld->bits_left;
+        ld->tail += n;
+        ld->bytes_left -= n;
+        ld->bits_left += n << 3;
+    } else {
+        faad_refill_ex(ld);
     }
+}
 
-    bits -= ld->bits_left;
-    //return ((ld->bufa & bitmask[ld->bits_left]) << bits) | (ld->bufb >> (32 - bits));
-    return ((ld->bufa & ((1u<<ld->bits_left)-1)) << bits) | (ld->bufb >> (32 - bits));
+static INLINE uint32_t faad_showbits(bitfile *ld, uint32_t bits)
+{
+    return (uint32_t)(ld->cache >> 32) >> (32 - bits);
 }
 
 static INLINE void faad_flushbits(bitfile *ld, uint32_t bits)
@@ -118,16 +148,19 @@ static INLINE void faad_flushbits(bitfile *ld, uint32_t bits)
     if (ld->error != 0)
         return;
 
-    if (bits < ld->bits_left)
+    if (bits <= 32)
     {
+        ld->cache <<= bits;
         ld->bits_left -= bits;
+        if (ld->bits_left < 32)
+            faad_refill(ld);
     } else {
         faad_flushbits_ex(ld, bits);
     }
 }
 
 /* return next n bits (right adjusted) */
-static /*INLINE*/ uint32_t faad_getbits(bitfile *ld, uint32_t n DEBUGDEC)
+static INLINE uint32_t faad_getbits(bitfile *ld, uint32_t n DEBUGDEC)
 {
     uint32_t ret;
 
@@ -149,20 +182,12 @@ static INLINE uint8_t faad_get1bit(bitfile *ld DEBUGDEC)
 {
     uint8_t r;
 
-    if (ld->bits_left > 0)
-    {
-        ld->bits_left--;
-        r = (uint8_t)((ld->bufa >> ld->bits_left) & 1);
-        return r;
-    }
+    r = (uint8_t)(ld->cache >> 63);
+    ld->cache <<= 1;
+    ld->bits_left--;
+    if (ld->bits_left < 32)
+        faad_refill(ld);
 
-    /* bits_left == 0 */
-#if 0
-    r = (uint8_t)(ld->bufb >> 31);
-    faad_flushbits_ex(ld, 1);
-#else
-    r = (uint8_t)faad_getbits(ld, 1);
-#endif
     return r;
 }
 
@@ -45,6 +45,10 @@
 #include "cfft.h"
 #include "cfft_tab.h"
 
+#ifdef USE_SSE
+#include <xmmintrin.h>
+#endif
+
 
 /* static function declarations */
 static void passf2pos(const uint16_t ido, const uint16_t l1, const complex_t *cc,
@@ -732,6 +736,269 @@ static void passf5(const uint16_t ido, const uint16_t l1, const complex_t *cc,
     }
 }
 
+#ifdef USE_SSE
+/*----------------------------------------------------------------------
+   SSE versions of the passes. Two complex values are handled at once,
+   either two consecutive i (ido even) or two consecutive k (ido == 1,
+   l1 even). The arithmetic is done in the same order as in the scalar
+   passes, so the results are identical.
+  ----------------------------------------------------------------------*/
+
+#define SWAP_RI(A) _mm_shuffle_ps(A, A, _MM_SHUFFLE(2,3,0,1))
+
+/* two complex values from non-adjacent positions */
+static INLINE SSE_TARGET __m128 load_pair(const complex_t *a, const complex_t *b)
+{
+    __m128 r = _mm_setzero_ps();
+
+    r = _mm_loadl_pi(r, (const __m64*)a);
+    return _mm_loadh_pi(r, (const __m64*)b);
+}
+
+/* ComplexMult as done by the isign == +1 passes */
+static INLINE SSE_TARGET __m128 cmul_pos(__m128 a, __m128 w)
+{
+    const __m128 sign = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+    __m128 wr = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2,2,0,0));
+    __m128 wi = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3,3,1,1));
+
+    return _mm_add_ps(_mm_mul_ps(a, wr),
+        _mm_xor_ps(_mm_mul_ps(SWAP_RI(a), wi), sign));
+}
+
+/* ComplexMult as done by the isign == -1 passes */
+static INLINE SSE_TARGET __m128 cmul_neg(__m128 a, __m128 w)
+{
+    const __m128 sign = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+    __m128 wr = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2,2,0,0));
+    __m128 wi = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3,3,1,1));
+
+    return _mm_add_ps(_mm_mul_ps(a, wr),
+        _mm_xor_ps(_mm_mul_ps(SWAP_RI(a), wi), sign));
+}
+
+/* (-IM(a), RE(a)) */
+static INLINE SSE_TARGET __m128 rot90(__m128 a)
+{
+    const __m128 sign = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+
+    return _mm_xor_ps(SWAP_RI(a), sign);
+}
+
+/* ido must be even */
+static SSE_TARGET void passf2_sse(const uint16_t ido, const uint16_t l1, const complex_t *cc,
+                                  complex_t *ch, const complex_t *wa, const int8_t isign)
+{
+    uint16_t i, k, ah, ac;
+
+    for (k = 0; k < l1; k++)
+    {
+        ah = k*ido;
+        ac = 2*k*ido;
+
+        for (i = 0; i < ido; i += 2)
+        {
+            __m128 a = _mm_loadu_ps(&RE(cc[ac+i]));
+            __m128 b = _mm_loadu_ps(&RE(cc[ac+i+ido]));
+            __m128 w = _mm_loadu_ps(&RE(wa[i]));
+            __m128 t2 = _mm_sub_ps(a, b);
+
+            _mm_storeu_ps(&RE(ch[ah+i]), _mm_add_ps(a, b));
+            _mm_storeu_ps(&RE(ch[ah+i+l1*ido]),
+                (isign == 1) ? cmul_pos(t2, w) : cmul_neg(t2, w));
+        }
+    }
+}
+
+/* ido must be even */
+static SSE_TARGET void passf3_sse(const uint16_t ido, const uint16_t l1, const complex_t *cc,
+                                  complex_t *ch, const complex_t *wa1, const complex_t *wa2,
+                                  const int8_t isign)
+{
+    const __m128 taur = _mm_set1_ps(FRAC_CONST(-0.5));
+    const __m128 taui = _mm_set1_ps(FRAC_CONST(0.866025403784439));
+    uint16_t i, k, ac, ah;
+
+    for (k = 0; k < l1; k++)
+    {
+        for (i = 0; i < ido; i += 2)
+        {
+            __m128 a0, a1, a2, t2, c2, c3, m, d2, d3;
+
+            ac = i + (3*k+1)*ido;
+            ah = i + k * ido;
+
+            a0 = _mm_loadu_ps(&RE(cc[ac-ido]));
+            a1 = _mm_loadu_ps(&RE(cc[ac]));
+            a2 = _mm_loadu_ps(&RE(cc[ac+ido]));
+
+            t2 = _mm_add_ps(a1, a2);
+            c2 = _mm_add_ps(a0, _mm_mul_ps(t2, taur));
+            c3 = _mm_mul_ps(_mm_sub_ps(a1, a2), taui);
+
+            _mm_storeu_ps(&RE(ch[ah]), _mm_add_ps(a0, t2));
+
+            m = rot90(c3);
+            if (isign == 1)
+            {
+                d2 = cmul_pos(_mm_add_ps(c2, m), _mm_loadu_ps(&RE(wa1[i])));
+                d3 = cmul_pos(_mm_sub_ps(c2, m), _mm_loadu_ps(&RE(wa2[i])));
+            } else {
+                d2 = cmul_neg(_mm_sub_ps(c2, m), _mm_loadu_ps(&RE(wa1[i])));
+                d3 = cmul_neg(_mm_add_ps(c2, m), _mm_loadu_ps(&RE(wa2[i])));
+            }
+            _mm_storeu_ps(&RE(ch[ah+l1*ido]), d2);
+            _mm_storeu_ps(&RE(ch[ah+2*l1*ido]), d3);
+        }
+    }
+}
+
+/* butterfly shared by both passf4 cases; t4 is built from a1 - a3 and
+ * a3 - a1 because that is how the scalar code computes its halves */
+static INLINE SSE_TARGET void butterfly4_sse(__m128 a0, __m128 a1, __m128 a2, __m128 a3,
+                                             const __m128 sign,
+                                             __m128 *y0, __m128 *y1, __m128 *y2, __m128 *y3)
+{
+    __m128 t1, t2, t3, t4, u, v;
+
+    t2 = _mm_add_ps(a0, a2);
+    t1 = _mm_sub_ps(a0, a2);
+    t3 = _mm_add_ps(a1, a3);
+    u = _mm_sub_ps(a1, a3);
+    v = _mm_sub_ps(a3, a1);
+    t4 = _mm_shuffle_ps(v, u, _MM_SHUFFLE(2,0,3,1));
+    t4 = _mm_shuffle_ps(t4, t4, _MM_SHUFFLE(3,1,2,0));
+    t4 = _mm_xor_ps(t4, sign);
+
+    *y0 = _mm_add_ps(t2, t3);
+    *y1 = _mm_add_ps(t1, t4);
+    *y2 = _mm_sub_ps(t2, t3);
+    *y3 = _mm_sub_ps(t1, t4);
+}
+
+/* ido must be even, or 1 with l1 even */
+static SSE_TARGET void passf4_sse(const uint16_t ido, const uint16_t l1, const complex_t *cc,
+                                  complex_t *ch, const complex_t *wa1, const complex_t *wa2,
+                                  const complex_t *wa3, const int8_t isign)
+{
+    const __m128 sign = (isign == 1) ? _mm_setzero_ps() : _mm_set1_ps(-0.0f);
+    uint16_t i, k, ac, ah;
+    __m128 y0, y1, y2, y3;
+
+    if (ido == 1)
+    {
+        for (k = 0; k < l1; k += 2)
+        {
+            ac = 4*k;
+            ah = k;
+
+            butterfly4_sse(load_pair(&cc[ac], &cc[ac+4]),
+                load_pair(&cc[ac+1], &cc[ac+5]),
+                load_pair(&cc[ac+2], &cc[ac+6]),
+                load_pair(&cc[ac+3], &cc[ac+7]),
+                sign, &y0, &y1, &y2, &y3);
+
+            _mm_storeu_ps(&RE(ch[ah]), y0);
+            _mm_storeu_ps(&RE(ch[ah+l1]), y1);
+            _mm_storeu_ps(&RE(ch[ah+2*l1]), y2);
+            _mm_storeu_ps(&RE(ch[ah+3*l1]), y3);
+        }
+    } else {
+        for (k = 0; k < l1; k++)
+        {
+            ac = 4*k*ido;
+            ah = k*ido;
+
+            for (i = 0; i < ido; i += 2)
+            {
+                __m128 w1 = _mm_loadu_ps(&RE(wa1[i]));
+                __m128 w2 = _mm_loadu_ps(&RE(wa2[i]));
+                __m128 w3 = _mm_loadu_ps(&RE(wa3[i]));
+
+                butterfly4_sse(_mm_loadu_ps(&RE(cc[ac+i])),
+                    _mm_loadu_ps(&RE(cc[ac+i+ido])),
+                    _mm_loadu_ps(&RE(cc[ac+i+2*ido])),
+                    _mm_loadu_ps(&RE(cc[ac+i+3*ido])),
+                    sign, &y0, &y1, &y2, &y3);
+
+                _mm_storeu_ps(&RE(ch[ah+i]), y0);
+                if (isign == 1)
+                {
+                    y1 = cmul_pos(y1, w1);
+                    y2 = cmul_pos(y2, w2);
+                    y3 = cmul_pos(y3, w3);
+                } else {
+                    y1 = cmul_neg(y1, w1);
+                    y2 = cmul_neg(y2, w2);
+                    y3 = cmul_neg(y3, w3);
+                }
+                _mm_storeu_ps(&RE(ch[ah+i+l1*ido]), y1);
+                _mm_storeu_ps(&RE(ch[ah+i+2*l1*ido]), y2);
+                _mm_storeu_ps(&RE(ch[ah+i+3*l1*ido]), y3);
+            }
+        }
+    }
+}
+
+/* ido must be 1 and l1 even */
+static SSE_TARGET void passf5_sse(const uint16_t l1, const complex_t *cc, complex_t *ch,
+                                  const int8_t isign)
+{
+    const __m128 tr11 = _mm_set1_ps(FRAC_CONST(0.309016994374947));
+    const __m128 ti11 = _mm_set1_ps(FRAC_CONST(0.951056516295154));
+    const __m128 tr12 = _mm_set1_ps(FRAC_CONST(-0.809016994374947));
+    const __m128 ti12 = _mm_set1_ps(FRAC_CONST(0.587785252292473));
+    uint16_t k, ac, ah;
+
+    for (k = 0; k < l1; k += 2)
+    {
+        __m128 a0, a1, a2, a3, a4, t2, t3, t4, t5, c2, c3, c4, c5, m4, m5;
+
+        ac = 5*k;
+        ah = k;
+
+        a0 = load_pair(&cc[ac], &cc[ac+5]);
+        a1 = load_pair(&cc[ac+1], &cc[ac+6]);
+        a2 = load_pair(&cc[ac+2], &cc[ac+7]);
+        a3 = load_pair(&cc[ac+3], &cc[ac+8]);
+        a4 = load_pair(&cc[ac+4], &cc[ac+9]);
+
+        t2 = _mm_add_ps(a1, a4);
+        t3 = _mm_add_ps(a2, a3);
+        t4 = _mm_sub_ps(a2, a3);
+        t5 = _mm_sub_ps(a1, a4);
+
+        _mm_storeu_ps(&RE(ch[ah]), _mm_add_ps(_mm_add_ps(a0, t2), t3));
+
+        c2 = _mm_add_ps(_mm_add_ps(a0, _mm_mul_ps(t2, tr11)), _mm_mul_ps(t3, tr12));
+        c3 = _mm_add_ps(_mm_add_ps(a0, _mm_mul_ps(t2, tr12)), _mm_mul_ps(t3, tr11));
+
+        if (isign == 1)
+        {
+            c5 = _mm_add_ps(_mm_mul_ps(ti11, t5), _mm_mul_ps(ti12, t4));
+            c4 = _mm_sub_ps(_mm_mul_ps(ti12, t5), _mm_mul_ps(ti11, t4));
+            m4 = rot90(c4);
+            m5 = rot90(c5);
+
+            _mm_storeu_ps(&RE(ch[ah+l1]), _mm_add_ps(c2, m5));
+            _mm_storeu_ps(&RE(ch[ah+2*l1]), _mm_add_ps(c3, m4));
+            _mm_storeu_ps(&RE(ch[ah+3*l1]), _mm_sub_ps(c3, m4));
+            _mm_storeu_ps(&RE(ch[ah+4*l1]), _mm_sub_ps(c2, m5));
+        } else {
+            c4 = _mm_add_ps(_mm_mul_ps(ti12, t5), _mm_mul_ps(ti11, t4));
+            c5 = _mm_sub_ps(_mm_mul_ps(ti11, t5), _mm_mul_ps(ti12, t4));
+            m4 = rot90(c4);
+            m5 = rot90(c5);
+
+            _mm_storeu_ps(&RE(ch[ah+l1]), _mm_sub_ps(c2, m5));
+            _mm_storeu_ps(&RE(ch[ah+2*l1]), _mm_sub_ps(c3, m4));
+            _mm_storeu_ps(&RE(ch[ah+3*l1]), _mm_add_ps(c3, m4));
+            _mm_storeu_ps(&RE(ch[ah+4*l1]), _mm_add_ps(c2, m5));
+        }
+    }
+}
+#endif
+
 
 /*----------------------------------------------------------------------
    cfftf1, cfftf, cfftb, cffti1, cffti. Complex FFTs.
@@ -893,14 +1160,118 @@ static INLINE void cfftf1neg(uint16_t n, complex_t *c, complex_t *ch,
     }
 }
 
-void cfftf(cfft_info *cfft, complex_t *c)
+#ifdef USE_SSE
+/* same as cfftf1pos/cfftf1neg, using the SSE passes where the
+ * loop counts allow it */
+static SSE_TARGET void cfftf1_sse(uint16_t n, complex_t *c, complex_t *ch,
+                                  const uint16_t *ifac, const complex_t *wa,
+                                  const int8_t isign)
 {
-    cfftf1neg(cfft->n, c, cfft->work, (const uint16_t*)cfft->ifac, (const complex_t*)cfft->tab, -1);
+    uint16_t i;
+    uint16_t k1, l1, l2;
+    uint16_t na, nf, ip, iw, ix2, ix3, ix4, ido;
+    const complex_t *in;
+    complex_t *out;
+
+    nf = ifac[1];
+    na = 0;
+    l1 = 1;
+    iw = 0;
+
+    for (k1 = 2; k1 <= nf+1; k1++)
+    {
+        ip = ifac[k1];
+        l2 = ip*l1;
+        ido = n / l2;
+
+        in = (const complex_t*)((na == 0) ? c : ch);
+        out = (na == 0) ? ch : c;
+
+        switch (ip)
+        {
+        case 4:
+            ix2 = iw + ido;
+            ix3 = ix2 + ido;
+
+            if (!(ido & 1) || (ido == 1 && !(l1 & 1)))
+                passf4_sse(ido, l1, in, out, &wa[iw], &wa[ix2], &wa[ix3], isign);
+            else if (isign == 1)
+                passf4pos(ido, l1, in, out, &wa[iw], &wa[ix2], &wa[ix3]);
+            else
+                passf4neg(ido, l1, in, out, &wa[iw], &wa[ix2], &wa[ix3]);
+            break;
+        case 2:
+            if (!(ido & 1))
+                passf2_sse(ido, l1, in, out, &wa[iw], isign);
+            else if (isign == 1)
+                passf2pos(ido, l1, in, out, &wa[iw]);
+            else
+                passf2neg(ido, l1, in, out, &wa[iw]);
+            break;
+        case 3:
+            ix2 = iw + ido;
+
+            if (!(ido & 1))
+                passf3_sse(ido, l1, in, out, &wa[iw], &wa[ix2], isign);
+            else
+                passf3(ido, l1, in, out, &wa[iw], &wa[ix2], isign);
+            break;
+        case 5:
+            ix2 = iw + ido;
+            ix3 = ix2 + ido;
+            ix4 = ix3 + ido;
+
+            if (ido == 1 && !(l1 & 1))
+                passf5_sse(l1, in, out, isign);
+            else
+                passf5(ido, l1, in, out, &wa[iw], &wa[ix2], &wa[ix3], &wa[ix4], isign);
+            break;
+        }
+
+        na = 1 - na;
+        l1 = l2;
+        iw += (ip-1) * ido;
+    }
+
+    if (na == 0)
+        return;
+
+    for (i = 0; i < n; i++)
+    {
+        RE(c[i]) = RE(ch[i]);
+        IM(c[i]) = IM(ch[i]);
+    }
+}
+#endif
+
+/* the work buffer lives on the stack, so that a cfft_info can be used
+ * by several decoders at the same time */
+void cfftf(const cfft_info *cfft, complex_t *c)
+{
+    ALIGN complex_t work[MAX_CFFT_SIZE];
+
+#ifdef USE_SSE
+    if (cfft->sse)
+    {
+        cfftf1_sse(cfft->n, c, work, (const uint16_t*)cfft->ifac, (const complex_t*)cfft->tab, -1);
+        return;
+    }
+#endif
+    cfftf1neg(cfft->n, c, work, (const uint16_t*)cfft->ifac, (const complex_t*)cfft->tab, -1);
 }
 
-void cfftb(cfft_info *cfft, complex_t *c)
+void cfftb(const cfft_info *cfft, complex_t *c)
 {
-    cfftf1pos(cfft->n, c, cfft->work, (const uint16_t*)cfft->ifac, (const complex_t*)cfft->tab, +1);
+    ALIGN complex_t work[MAX_CFFT_SIZE];
+
+#ifdef USE_SSE
+    if (cfft->sse)
+    {
+        cfftf1_sse(cfft->n, c, work, (const uint16_t*)cfft->ifac, (const complex_t*)cfft->tab, +1);
+        return;
+    }
+#endif
+    cfftf1pos(cfft->n, c, work, (const uint16_t*)cfft->ifac, (const complex_t*)cfft->tab, +1);
 }
 
 static void cffti1(uint16_t n, complex_t *wa, uint16_t *ifac)
@@ -1002,15 +1373,25 @@ startloop:
 #endif
 }
 
-cfft_info *cffti(uint16_t n)
+cfft_info *cffti(allocator_info *alloc, uint16_t n)
 {
-    cfft_info *cfft = (cfft_info*)faad_malloc(sizeof(cfft_info));
+    cfft_info *cfft = (cfft_info*)faad_malloc(alloc, sizeof(cfft_info));
+
+    if (cfft == NULL)
+        return NULL;
 
     cfft->n = n;
-    cfft->work = (complex_t*)faad_malloc(n*sizeof(complex_t));
+#ifdef USE_SSE
+    cfft->sse = cpu_has_sse();
+#endif
 
 #ifndef FIXED_POINT
-    cfft->tab = (complex_t*)faad_malloc(n*sizeof(complex_t));
+    cfft->tab = (complex_t*)faad_malloc(alloc, n*sizeof(complex_t));
+    if (cfft->tab == NULL)
+    {
+        faad_free(alloc, cfft);
+        return NULL;
+    }
 
     cffti1(n, cfft->tab, cfft->ifac);
 #else
@@ -1038,13 +1419,15 @@ cfft_info *cffti(uint16_t n)
     return cfft;
 }
 
-void cfftu(cfft_info *cfft)
+void cfftu(allocator_info *alloc, cfft_info *cfft)
 {
-    if (cfft->work) faad_free(cfft->work);
+    if (cfft == NULL)
+        return;
+
 #ifndef FIXED_POINT
-    if (cfft->tab) faad_free(cfft->tab);
+    if (cfft->tab) faad_free(alloc, cfft->tab);
 #endif
 
-    if (cfft) faad_free(cfft);
+    faad_free(alloc, cfft);
 }
 
@@ -35,19 +35,24 @@
 extern "C" {
 #endif
 
+/* largest transform, used by the 2048 point MDCT */
+#define MAX_CFFT_SIZE 512
+
 typedef struct
 {
     uint16_t n;
     uint16_t ifac[15];
-    complex_t *work;
     complex_t *tab;
+#ifdef USE_SSE
+    uint8_t sse;
+#endif
 } cfft_info;
 
 
-void cfftf(cfft_info *cfft, complex_t *c);
-void cfftb(cfft_info *cfft, complex_t *c);
-cfft_info *cffti(uint16_t n);
-void cfftu(cfft_info *cfft);
+void cfftf(const cfft_info *cfft, complex_t *c);
+void cfftb(const cfft_info *cfft, complex_t *c);
+cfft_info *cffti(allocator_info *alloc, uint16_t n);
+void cfftu(allocator_info *alloc, cfft_info *cfft);
 
 
 #ifdef __cplusplus
@@ -118,6 +118,27 @@ typedef struct
     int8_t data[2];
 } hcb_bin_pair;
 
+/* lookup tables indexed with the next HCB_LUT_BITS bits */
+#define HCB_LUT_BITS 10
+
+typedef struct
+{
+    uint8_t bits;
+    uint8_t sign;
+    int8_t x;
+    int8_t y;
+    int8_t v;
+    int8_t w;
+} hcb_lut_quad;
+
+typedef struct
+{
+    uint8_t bits;
+    uint8_t sign;
+    int8_t x;
+    int8_t y;
+} hcb_lut_pair;
+
 #include "codebook/hcb_1.h"
 #include "codebook/hcb_2.h"
 #include "codebook/hcb_3.h"
@@ -130,6 +151,7 @@ typedef struct
 #include "codebook/hcb_10.h"
 #include "codebook/hcb_11.h"
 #include "codebook/hcb_sf.h"
+#include "codebook/hcb_lut.h"
 
 #ifdef __cplusplus
 }
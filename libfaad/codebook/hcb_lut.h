@@ -0,0 +1,11338 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**
+** $Id: hcb_lut.h,v 1.0 $
+**/
+
+/* 10 bit lookup tables for the spectral codebooks
+ *
+ * Entry i is the codeword that starts with the 10 bits of i. bits is the
+ * number of bits to flush; 0 means the codeword is longer than 10 bits and
+ * has to be decoded with the 2-step or binary tables. For the unsigned
+ * codebooks the sign bits are included in bits and applied to the values
+ * when they fit in the 10 bits as well; otherwise sign is set and the sign
+ * bits still have to be read after the codeword.
+ *
+ * Generated by decoding every 10 bit pattern with the hcb_N tables.
+ */
+
+static const hcb_lut_quad hcb1_lut[1024] = {
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  1,  0, -1,  0 },
+    {  7, 0,  1,  0, -1,  0 },
+    {  7, 0,  1,  0, -1,  0 },
+    {  7, 0,  1,  0, -1,  0 },
+    {  7, 0,  1,  0, -1,  0 },
+    {  7, 0,  1,  0, -1,  0 },
+    {  7, 0,  1,  0, -1,  0 },
+    {  7, 0,  1,  0, -1,  0 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0, -1,  0,  1,  0 },
+    {  7, 0, -1,  0,  1,  0 },
+    {  7, 0, -1,  0,  1,  0 },
+    {  7, 0, -1,  0,  1,  0 },
+    {  7, 0, -1,  0,  1,  0 },
+    {  7, 0, -1,  0,  1,  0 },
+    {  7, 0, -1,  0,  1,  0 },
+    {  7, 0, -1,  0,  1,  0 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  0 },
+    {  7, 0,  1,  0,  1,  0 },
+    {  7, 0,  1,  0,  1,  0 },
+    {  7, 0,  1,  0,  1,  0 },
+    {  7, 0,  1,  0,  1,  0 },
+    {  7, 0,  1,  0,  1,  0 },
+    {  7, 0,  1,  0,  1,  0 },
+    {  7, 0,  1,  0,  1,  0 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0, -1,  0, -1,  0 },
+    {  7, 0, -1,  0, -1,  0 },
+    {  7, 0, -1,  0, -1,  0 },
+    {  7, 0, -1,  0, -1,  0 },
+    {  7, 0, -1,  0, -1,  0 },
+    {  7, 0, -1,  0, -1,  0 },
+    {  7, 0, -1,  0, -1,  0 },
+    {  7, 0, -1,  0, -1,  0 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  9, 0,  1,  1, -1,  0 },
+    {  9, 0,  1,  1, -1,  0 },
+    {  9, 0, -1,  1, -1,  0 },
+    {  9, 0, -1,  1, -1,  0 },
+    {  9, 0,  1, -1,  1,  0 },
+    {  9, 0,  1, -1,  1,  0 },
+    {  9, 0,  0,  1,  1, -1 },
+    {  9, 0,  0,  1,  1, -1 },
+    {  9, 0,  0,  1, -1,  1 },
+    {  9, 0,  0,  1, -1,  1 },
+    {  9, 0,  0, -1,  1,  1 },
+    {  9, 0,  0, -1,  1,  1 },
+    {  9, 0,  0, -1,  1, -1 },
+    {  9, 0,  0, -1,  1, -1 },
+    {  9, 0,  1, -1, -1,  0 },
+    {  9, 0,  1, -1, -1,  0 },
+    {  9, 0,  1,  0, -1,  1 },
+    {  9, 0,  1,  0, -1,  1 },
+    {  9, 0,  0,  1, -1, -1 },
+    {  9, 0,  0,  1, -1, -1 },
+    {  9, 0, -1,  1,  1,  0 },
+    {  9, 0, -1,  1,  1,  0 },
+    {  9, 0, -1,  0,  1, -1 },
+    {  9, 0, -1,  0,  1, -1 },
+    {  9, 0, -1, -1,  1,  0 },
+    {  9, 0, -1, -1,  1,  0 },
+    {  9, 0,  0, -1, -1,  1 },
+    {  9, 0,  0, -1, -1,  1 },
+    {  9, 0,  1, -1,  0,  1 },
+    {  9, 0,  1, -1,  0,  1 },
+    {  9, 0,  1, -1,  0, -1 },
+    {  9, 0,  1, -1,  0, -1 },
+    {  9, 0, -1,  1,  0, -1 },
+    {  9, 0, -1,  1,  0, -1 },
+    {  9, 0, -1, -1, -1,  0 },
+    {  9, 0, -1, -1, -1,  0 },
+    {  9, 0,  0, -1, -1, -1 },
+    {  9, 0,  0, -1, -1, -1 },
+    {  9, 0,  0,  1,  1,  1 },
+    {  9, 0,  0,  1,  1,  1 },
+    {  9, 0,  1,  0,  1, -1 },
+    {  9, 0,  1,  0,  1, -1 },
+    {  9, 0,  1,  1,  0,  1 },
+    {  9, 0,  1,  1,  0,  1 },
+    {  9, 0, -1,  1,  0,  1 },
+    {  9, 0, -1,  1,  0,  1 },
+    {  9, 0,  1,  1,  1,  0 },
+    {  9, 0,  1,  1,  1,  0 },
+    { 10, 0, -1, -1,  0,  1 },
+    { 10, 0, -1,  0, -1, -1 },
+    { 10, 0,  1,  1,  0, -1 },
+    { 10, 0,  1,  0, -1, -1 },
+    { 10, 0, -1,  0, -1,  1 },
+    { 10, 0, -1, -1,  0, -1 },
+    { 10, 0, -1,  0,  1,  1 },
+    { 10, 0,  1,  0,  1,  1 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 }
+};
+
+static const hcb_lut_quad hcb2_lut[1024] = {
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  3, 0,  0,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  4, 0,  1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0,  0, -1,  1,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  1, -1,  0 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  1,  0, -1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0, -1,  0,  0, -1 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  1,  0,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0,  0, -1,  0,  1 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0,  1,  0,  1 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0,  0, -1, -1,  0 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0, -1,  0,  0,  1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0,  0, -1,  0, -1 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  1,  1,  0 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  6, 0,  1,  0,  0, -1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  8, 0,  1, -1,  0,  1 },
+    {  8, 0,  1, -1,  0,  1 },
+    {  8, 0,  1, -1,  0,  1 },
+    {  8, 0,  1, -1,  0,  1 },
+    {  8, 0, -1,  1,  0, -1 },
+    {  8, 0, -1,  1,  0, -1 },
+    {  8, 0, -1,  1,  0, -1 },
+    {  8, 0, -1,  1,  0, -1 },
+    {  8, 0, -1, -1,  1,  0 },
+    {  8, 0, -1, -1,  1,  0 },
+    {  8, 0, -1, -1,  1,  0 },
+    {  8, 0, -1, -1,  1,  0 },
+    {  8, 0, -1,  0,  1,  1 },
+    {  8, 0, -1,  0,  1,  1 },
+    {  8, 0, -1,  0,  1,  1 },
+    {  8, 0, -1,  0,  1,  1 },
+    {  8, 0, -1, -1,  0,  1 },
+    {  8, 0, -1, -1,  0,  1 },
+    {  8, 0, -1, -1,  0,  1 },
+    {  8, 0, -1, -1,  0,  1 },
+    {  8, 0, -1, -1,  0, -1 },
+    {  8, 0, -1, -1,  0, -1 },
+    {  8, 0, -1, -1,  0, -1 },
+    {  8, 0, -1, -1,  0, -1 },
+    {  8, 0,  0, -1, -1, -1 },
+    {  8, 0,  0, -1, -1, -1 },
+    {  8, 0,  0, -1, -1, -1 },
+    {  8, 0,  0, -1, -1, -1 },
+    {  8, 0,  1,  0,  1, -1 },
+    {  8, 0,  1,  0,  1, -1 },
+    {  8, 0,  1,  0,  1, -1 },
+    {  8, 0,  1,  0,  1, -1 },
+    {  8, 0,  1,  0, -1, -1 },
+    {  8, 0,  1,  0, -1, -1 },
+    {  8, 0,  1,  0, -1, -1 },
+    {  8, 0,  1,  0, -1, -1 },
+    {  8, 0,  0,  1, -1, -1 },
+    {  8, 0,  0,  1, -1, -1 },
+    {  8, 0,  0,  1, -1, -1 },
+    {  8, 0,  0,  1, -1, -1 },
+    {  8, 0,  0,  1,  1,  1 },
+    {  8, 0,  0,  1,  1,  1 },
+    {  8, 0,  0,  1,  1,  1 },
+    {  8, 0,  0,  1,  1,  1 },
+    {  8, 0, -1,  1,  0,  1 },
+    {  8, 0, -1,  1,  0,  1 },
+    {  8, 0, -1,  1,  0,  1 },
+    {  8, 0, -1,  1,  0,  1 },
+    {  8, 0, -1,  0, -1, -1 },
+    {  8, 0, -1,  0, -1, -1 },
+    {  8, 0, -1,  0, -1, -1 },
+    {  8, 0, -1,  0, -1, -1 },
+    {  8, 0,  0,  1,  1, -1 },
+    {  8, 0,  0,  1,  1, -1 },
+    {  8, 0,  0,  1,  1, -1 },
+    {  8, 0,  0,  1,  1, -1 },
+    {  8, 0,  1, -1,  0, -1 },
+    {  8, 0,  1, -1,  0, -1 },
+    {  8, 0,  1, -1,  0, -1 },
+    {  8, 0,  1, -1,  0, -1 },
+    {  8, 0,  0, -1,  1,  1 },
+    {  8, 0,  0, -1,  1,  1 },
+    {  8, 0,  0, -1,  1,  1 },
+    {  8, 0,  0, -1,  1,  1 },
+    {  8, 0,  1,  1,  0,  1 },
+    {  8, 0,  1,  1,  0,  1 },
+    {  8, 0,  1,  1,  0,  1 },
+    {  8, 0,  1,  1,  0,  1 },
+    {  8, 0,  1, -1,  1, -1 },
+    {  8, 0,  1, -1,  1, -1 },
+    {  8, 0,  1, -1,  1, -1 },
+    {  8, 0,  1, -1,  1, -1 },
+    {  8, 0, -1,  1, -1,  1 },
+    {  8, 0, -1,  1, -1,  1 },
+    {  8, 0, -1,  1, -1,  1 },
+    {  8, 0, -1,  1, -1,  1 },
+    {  9, 0,  1, -1, -1,  1 },
+    {  9, 0,  1, -1, -1,  1 },
+    {  9, 0, -1, -1, -1, -1 },
+    {  9, 0, -1, -1, -1, -1 },
+    {  9, 0, -1,  1,  1, -1 },
+    {  9, 0, -1,  1,  1, -1 },
+    {  9, 0, -1,  1,  1,  1 },
+    {  9, 0, -1,  1,  1,  1 },
+    {  9, 0,  1,  1,  1,  1 },
+    {  9, 0,  1,  1,  1,  1 },
+    {  9, 0, -1, -1,  1, -1 },
+    {  9, 0, -1, -1,  1, -1 },
+    {  9, 0,  1, -1,  1,  1 },
+    {  9, 0,  1, -1,  1,  1 },
+    {  9, 0, -1,  1, -1, -1 },
+    {  9, 0, -1,  1, -1, -1 },
+    {  9, 0, -1, -1,  1,  1 },
+    {  9, 0, -1, -1,  1,  1 },
+    {  9, 0,  1,  1, -1, -1 },
+    {  9, 0,  1,  1, -1, -1 },
+    {  9, 0,  1, -1, -1, -1 },
+    {  9, 0,  1, -1, -1, -1 },
+    {  9, 0, -1, -1, -1,  1 },
+    {  9, 0, -1, -1, -1,  1 },
+    {  9, 0,  1,  1, -1,  1 },
+    {  9, 0,  1,  1, -1,  1 },
+    {  9, 0,  1,  1,  1, -1 },
+    {  9, 0,  1,  1,  1, -1 }
+};
+
+static const hcb_lut_quad hcb3_lut[1024] = {
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  1, 0,  0,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0,  1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  0,  0, -1 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0,  1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0, -1,  0,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0,  1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  5, 0,  0,  0, -1,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1,  1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0,  1, -1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1,  1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0, -1, -1,  0,  0 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1,  1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0,  1, -1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1,  1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  7, 0,  0,  0, -1, -1 },
+    {  8, 0,  0,  1,  1,  0 },
+    {  8, 0,  0,  1,  1,  0 },
+    {  8, 0,  0,  1,  1,  0 },
+    {  8, 0,  0,  1,  1,  0 },
+    {  8, 0,  0,  1, -1,  0 },
+    {  8, 0,  0,  1, -1,  0 },
+    {  8, 0,  0,  1, -1,  0 },
+    {  8, 0,  0,  1, -1,  0 },
+    {  8, 0,  0, -1,  1,  0 },
+    {  8, 0,  0, -1,  1,  0 },
+    {  8, 0,  0, -1,  1,  0 },
+    {  8, 0,  0, -1,  1,  0 },
+    {  8, 0,  0, -1, -1,  0 },
+    {  8, 0,  0, -1, -1,  0 },
+    {  8, 0,  0, -1, -1,  0 },
+    {  8, 0,  0, -1, -1,  0 },
+    {  8, 0,  0,  1,  0,  1 },
+    {  8, 0,  0,  1,  0,  1 },
+    {  8, 0,  0,  1,  0,  1 },
+    {  8, 0,  0,  1,  0,  1 },
+    {  8, 0,  0,  1,  0, -1 },
+    {  8, 0,  0,  1,  0, -1 },
+    {  8, 0,  0,  1,  0, -1 },
+    {  8, 0,  0,  1,  0, -1 },
+    {  8, 0,  0, -1,  0,  1 },
+    {  8, 0,  0, -1,  0,  1 },
+    {  8, 0,  0, -1,  0,  1 },
+    {  8, 0,  0, -1,  0,  1 },
+    {  8, 0,  0, -1,  0, -1 },
+    {  8, 0,  0, -1,  0, -1 },
+    {  8, 0,  0, -1,  0, -1 },
+    {  8, 0,  0, -1,  0, -1 },
+    {  8, 0,  1,  0,  1,  0 },
+    {  8, 0,  1,  0,  1,  0 },
+    {  8, 0,  1,  0,  1,  0 },
+    {  8, 0,  1,  0,  1,  0 },
+    {  8, 0,  1,  0, -1,  0 },
+    {  8, 0,  1,  0, -1,  0 },
+    {  8, 0,  1,  0, -1,  0 },
+    {  8, 0,  1,  0, -1,  0 },
+    {  8, 0, -1,  0,  1,  0 },
+    {  8, 0, -1,  0,  1,  0 },
+    {  8, 0, -1,  0,  1,  0 },
+    {  8, 0, -1,  0,  1,  0 },
+    {  8, 0, -1,  0, -1,  0 },
+    {  8, 0, -1,  0, -1,  0 },
+    {  8, 0, -1,  0, -1,  0 },
+    {  8, 0, -1,  0, -1,  0 },
+    {  9, 0,  0,  1,  1,  1 },
+    {  9, 0,  0,  1,  1,  1 },
+    {  9, 0,  0,  1,  1, -1 },
+    {  9, 0,  0,  1,  1, -1 },
+    {  9, 0,  0,  1, -1,  1 },
+    {  9, 0,  0,  1, -1,  1 },
+    {  9, 0,  0,  1, -1, -1 },
+    {  9, 0,  0,  1, -1, -1 },
+    {  9, 0,  0, -1,  1,  1 },
+    {  9, 0,  0, -1,  1,  1 },
+    {  9, 0,  0, -1,  1, -1 },
+    {  9, 0,  0, -1,  1, -1 },
+    {  9, 0,  0, -1, -1,  1 },
+    {  9, 0,  0, -1, -1,  1 },
+    {  9, 0,  0, -1, -1, -1 },
+    {  9, 0,  0, -1, -1, -1 },
+    {  8, 0,  1,  0,  0,  1 },
+    {  8, 0,  1,  0,  0,  1 },
+    {  8, 0,  1,  0,  0,  1 },
+    {  8, 0,  1,  0,  0,  1 },
+    {  8, 0,  1,  0,  0, -1 },
+    {  8, 0,  1,  0,  0, -1 },
+    {  8, 0,  1,  0,  0, -1 },
+    {  8, 0,  1,  0,  0, -1 },
+    {  8, 0, -1,  0,  0,  1 },
+    {  8, 0, -1,  0,  0,  1 },
+    {  8, 0, -1,  0,  0,  1 },
+    {  8, 0, -1,  0,  0,  1 },
+    {  8, 0, -1,  0,  0, -1 },
+    {  8, 0, -1,  0,  0, -1 },
+    {  8, 0, -1,  0,  0, -1 },
+    {  8, 0, -1,  0,  0, -1 },
+    {  9, 0,  1,  1,  1,  0 },
+    {  9, 0,  1,  1,  1,  0 },
+    {  9, 0,  1,  1, -1,  0 },
+    {  9, 0,  1,  1, -1,  0 },
+    {  9, 0,  1, -1,  1,  0 },
+    {  9, 0,  1, -1,  1,  0 },
+    {  9, 0,  1, -1, -1,  0 },
+    {  9, 0,  1, -1, -1,  0 },
+    {  9, 0, -1,  1,  1,  0 },
+    {  9, 0, -1,  1,  1,  0 },
+    {  9, 0, -1,  1, -1,  0 },
+    {  9, 0, -1,  1, -1,  0 },
+    {  9, 0, -1, -1,  1,  0 },
+    {  9, 0, -1, -1,  1,  0 },
+    {  9, 0, -1, -1, -1,  0 },
+    {  9, 0, -1, -1, -1,  0 },
+    {  7, 1,  1,  1,  1,  1 },
+    {  7, 1,  1,  1,  1,  1 },
+    {  7, 1,  1,  1,  1,  1 },
+    {  7, 1,  1,  1,  1,  1 },
+    {  7, 1,  1,  1,  1,  1 },
+    {  7, 1,  1,  1,  1,  1 },
+    {  7, 1,  1,  1,  1,  1 },
+    {  7, 1,  1,  1,  1,  1 },
+    { 10, 0,  1,  0,  1,  1 },
+    { 10, 0,  1,  0,  1, -1 },
+    { 10, 0,  1,  0, -1,  1 },
+    { 10, 0,  1,  0, -1, -1 },
+    { 10, 0, -1,  0,  1,  1 },
+    { 10, 0, -1,  0,  1, -1 },
+    { 10, 0, -1,  0, -1,  1 },
+    { 10, 0, -1,  0, -1, -1 },
+    { 10, 0,  1,  1,  0,  1 },
+    { 10, 0,  1,  1,  0, -1 },
+    { 10, 0,  1, -1,  0,  1 },
+    { 10, 0,  1, -1,  0, -1 },
+    { 10, 0, -1,  1,  0,  1 },
+    { 10, 0, -1,  1,  0, -1 },
+    { 10, 0, -1, -1,  0,  1 },
+    { 10, 0, -1, -1,  0, -1 },
+    {  9, 0,  2,  0,  0,  0 },
+    {  9, 0,  2,  0,  0,  0 },
+    {  9, 0, -2,  0,  0,  0 },
+    {  9, 0, -2,  0,  0,  0 },
+    {  9, 0,  0,  0,  0,  2 },
+    {  9, 0,  0,  0,  0,  2 },
+    {  9, 0,  0,  0,  0, -2 },
+    {  9, 0,  0,  0,  0, -2 },
+    { 10, 0,  0,  0,  1,  2 },
+    { 10, 0,  0,  0,  1, -2 },
+    { 10, 0,  0,  0, -1,  2 },
+    { 10, 0,  0,  0, -1, -2 },
+    { 10, 0,  2,  1,  0,  0 },
+    { 10, 0,  2, -1,  0,  0 },
+    { 10, 0, -2,  1,  0,  0 },
+    { 10, 0, -2, -1,  0,  0 },
+    {  8, 1,  1,  2,  1,  0 },
+    {  8, 1,  1,  2,  1,  0 },
+    {  8, 1,  1,  2,  1,  0 },
+    {  8, 1,  1,  2,  1,  0 },
+    {  9, 1,  0,  0,  2,  1 },
+    {  9, 1,  0,  0,  2,  1 },
+    {  9, 1,  0,  1,  2,  1 },
+    {  9, 1,  0,  1,  2,  1 },
+    {  9, 1,  1,  2,  0,  0 },
+    {  9, 1,  1,  2,  0,  0 },
+    {  9, 1,  0,  1,  1,  2 },
+    {  9, 1,  0,  1,  1,  2 },
+    {  9, 1,  2,  1,  1,  0 },
+    {  9, 1,  2,  1,  1,  0 },
+    { 10, 0,  0,  0,  2,  0 },
+    { 10, 0,  0,  0, -2,  0 },
+    {  9, 1,  0,  2,  1,  0 },
+    {  9, 1,  0,  2,  1,  0 },
+    {  9, 1,  0,  1,  2,  0 },
+    {  9, 1,  0,  1,  2,  0 },
+    { 10, 0,  0,  2,  0,  0 },
+    { 10, 0,  0, -2,  0,  0 },
+    {  9, 1,  0,  1,  0,  2 },
+    {  9, 1,  0,  1,  0,  2 },
+    {  9, 1,  2,  0,  1,  0 },
+    {  9, 1,  2,  0,  1,  0 },
+    {  9, 1,  1,  2,  1,  1 },
+    {  9, 1,  1,  2,  1,  1 },
+    {  9, 1,  0,  2,  1,  1 },
+    {  9, 1,  0,  2,  1,  1 },
+    {  9, 1,  1,  1,  2,  0 },
+    {  9, 1,  1,  1,  2,  0 },
+    {  9, 1,  1,  1,  2,  1 },
+    {  9, 1,  1,  1,  2,  1 },
+    { 10, 1,  1,  2,  0,  1 },
+    { 10, 1,  1,  0,  2,  0 },
+    { 10, 1,  1,  0,  2,  1 },
+    { 10, 1,  0,  2,  0,  1 },
+    { 10, 1,  2,  1,  1,  1 },
+    { 10, 1,  1,  1,  1,  2 },
+    { 10, 1,  2,  1,  0,  1 },
+    { 10, 1,  1,  0,  1,  2 },
+    { 10, 1,  0,  0,  2,  2 },
+    { 10, 1,  0,  1,  2,  2 },
+    { 10, 1,  2,  2,  1,  0 },
+    { 10, 1,  1,  2,  2,  0 },
+    { 10, 1,  1,  0,  0,  2 },
+    { 10, 1,  2,  0,  0,  1 },
+    { 10, 1,  0,  2,  2,  1 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 }
+};
+
+static const hcb_lut_quad hcb4_lut[1024] = {
+    {  8, 0,  1,  1,  1,  1 },
+    {  8, 0,  1,  1,  1,  1 },
+    {  8, 0,  1,  1,  1,  1 },
+    {  8, 0,  1,  1,  1,  1 },
+    {  8, 0,  1,  1,  1, -1 },
+    {  8, 0,  1,  1,  1, -1 },
+    {  8, 0,  1,  1,  1, -1 },
+    {  8, 0,  1,  1,  1, -1 },
+    {  8, 0,  1,  1, -1,  1 },
+    {  8, 0,  1,  1, -1,  1 },
+    {  8, 0,  1,  1, -1,  1 },
+    {  8, 0,  1,  1, -1,  1 },
+    {  8, 0,  1,  1, -1, -1 },
+    {  8, 0,  1,  1, -1, -1 },
+    {  8, 0,  1,  1, -1, -1 },
+    {  8, 0,  1,  1, -1, -1 },
+    {  8, 0,  1, -1,  1,  1 },
+    {  8, 0,  1, -1,  1,  1 },
+    {  8, 0,  1, -1,  1,  1 },
+    {  8, 0,  1, -1,  1,  1 },
+    {  8, 0,  1, -1,  1, -1 },
+    {  8, 0,  1, -1,  1, -1 },
+    {  8, 0,  1, -1,  1, -1 },
+    {  8, 0,  1, -1,  1, -1 },
+    {  8, 0,  1, -1, -1,  1 },
+    {  8, 0,  1, -1, -1,  1 },
+    {  8, 0,  1, -1, -1,  1 },
+    {  8, 0,  1, -1, -1,  1 },
+    {  8, 0,  1, -1, -1, -1 },
+    {  8, 0,  1, -1, -1, -1 },
+    {  8, 0,  1, -1, -1, -1 },
+    {  8, 0,  1, -1, -1, -1 },
+    {  8, 0, -1,  1,  1,  1 },
+    {  8, 0, -1,  1,  1,  1 },
+    {  8, 0, -1,  1,  1,  1 },
+    {  8, 0, -1,  1,  1,  1 },
+    {  8, 0, -1,  1,  1, -1 },
+    {  8, 0, -1,  1,  1, -1 },
+    {  8, 0, -1,  1,  1, -1 },
+    {  8, 0, -1,  1,  1, -1 },
+    {  8, 0, -1,  1, -1,  1 },
+    {  8, 0, -1,  1, -1,  1 },
+    {  8, 0, -1,  1, -1,  1 },
+    {  8, 0, -1,  1, -1,  1 },
+    {  8, 0, -1,  1, -1, -1 },
+    {  8, 0, -1,  1, -1, -1 },
+    {  8, 0, -1,  1, -1, -1 },
+    {  8, 0, -1,  1, -1, -1 },
+    {  8, 0, -1, -1,  1,  1 },
+    {  8, 0, -1, -1,  1,  1 },
+    {  8, 0, -1, -1,  1,  1 },
+    {  8, 0, -1, -1,  1,  1 },
+    {  8, 0, -1, -1,  1, -1 },
+    {  8, 0, -1, -1,  1, -1 },
+    {  8, 0, -1, -1,  1, -1 },
+    {  8, 0, -1, -1,  1, -1 },
+    {  8, 0, -1, -1, -1,  1 },
+    {  8, 0, -1, -1, -1,  1 },
+    {  8, 0, -1, -1, -1,  1 },
+    {  8, 0, -1, -1, -1,  1 },
+    {  8, 0, -1, -1, -1, -1 },
+    {  8, 0, -1, -1, -1, -1 },
+    {  8, 0, -1, -1, -1, -1 },
+    {  8, 0, -1, -1, -1, -1 },
+    {  7, 0,  0,  1,  1,  1 },
+    {  7, 0,  0,  1,  1,  1 },
+    {  7, 0,  0,  1,  1,  1 },
+    {  7, 0,  0,  1,  1,  1 },
+    {  7, 0,  0,  1,  1,  1 },
+    {  7, 0,  0,  1,  1,  1 },
+    {  7, 0,  0,  1,  1,  1 },
+    {  7, 0,  0,  1,  1,  1 },
+    {  7, 0,  0,  1,  1, -1 },
+    {  7, 0,  0,  1,  1, -1 },
+    {  7, 0,  0,  1,  1, -1 },
+    {  7, 0,  0,  1,  1, -1 },
+    {  7, 0,  0,  1,  1, -1 },
+    {  7, 0,  0,  1,  1, -1 },
+    {  7, 0,  0,  1,  1, -1 },
+    {  7, 0,  0,  1,  1, -1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1,  1 },
+    {  7, 0,  0,  1, -1, -1 },
+    {  7, 0,  0,  1, -1, -1 },
+    {  7, 0,  0,  1, -1, -1 },
+    {  7, 0,  0,  1, -1, -1 },
+    {  7, 0,  0,  1, -1, -1 },
+    {  7, 0,  0,  1, -1, -1 },
+    {  7, 0,  0,  1, -1, -1 },
+    {  7, 0,  0,  1, -1, -1 },
+    {  7, 0,  0, -1,  1,  1 },
+    {  7, 0,  0, -1,  1,  1 },
+    {  7, 0,  0, -1,  1,  1 },
+    {  7, 0,  0, -1,  1,  1 },
+    {  7, 0,  0, -1,  1,  1 },
+    {  7, 0,  0, -1,  1,  1 },
+    {  7, 0,  0, -1,  1,  1 },
+    {  7, 0,  0, -1,  1,  1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1,  1, -1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1,  1 },
+    {  7, 0,  0, -1, -1, -1 },
+    {  7, 0,  0, -1, -1, -1 },
+    {  7, 0,  0, -1, -1, -1 },
+    {  7, 0,  0, -1, -1, -1 },
+    {  7, 0,  0, -1, -1, -1 },
+    {  7, 0,  0, -1, -1, -1 },
+    {  7, 0,  0, -1, -1, -1 },
+    {  7, 0,  0, -1, -1, -1 },
+    {  7, 0,  1,  1,  0,  1 },
+    {  7, 0,  1,  1,  0,  1 },
+    {  7, 0,  1,  1,  0,  1 },
+    {  7, 0,  1,  1,  0,  1 },
+    {  7, 0,  1,  1,  0,  1 },
+    {  7, 0,  1,  1,  0,  1 },
+    {  7, 0,  1,  1,  0,  1 },
+    {  7, 0,  1,  1,  0,  1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1,  1,  0, -1 },
+    {  7, 0,  1, -1,  0,  1 },
+    {  7, 0,  1, -1,  0,  1 },
+    {  7, 0,  1, -1,  0,  1 },
+    {  7, 0,  1, -1,  0,  1 },
+    {  7, 0,  1, -1,  0,  1 },
+    {  7, 0,  1, -1,  0,  1 },
+    {  7, 0,  1, -1,  0,  1 },
+    {  7, 0,  1, -1,  0,  1 },
+    {  7, 0,  1, -1,  0, -1 },
+    {  7, 0,  1, -1,  0, -1 },
+    {  7, 0,  1, -1,  0, -1 },
+    {  7, 0,  1, -1,  0, -1 },
+    {  7, 0,  1, -1,  0, -1 },
+    {  7, 0,  1, -1,  0, -1 },
+    {  7, 0,  1, -1,  0, -1 },
+    {  7, 0,  1, -1,  0, -1 },
+    {  7, 0, -1,  1,  0,  1 },
+    {  7, 0, -1,  1,  0,  1 },
+    {  7, 0, -1,  1,  0,  1 },
+    {  7, 0, -1,  1,  0,  1 },
+    {  7, 0, -1,  1,  0,  1 },
+    {  7, 0, -1,  1,  0,  1 },
+    {  7, 0, -1,  1,  0,  1 },
+    {  7, 0, -1,  1,  0,  1 },
+    {  7, 0, -1,  1,  0, -1 },
+    {  7, 0, -1,  1,  0, -1 },
+    {  7, 0, -1,  1,  0, -1 },
+    {  7, 0, -1,  1,  0, -1 },
+    {  7, 0, -1,  1,  0, -1 },
+    {  7, 0, -1,  1,  0, -1 },
+    {  7, 0, -1,  1,  0, -1 },
+    {  7, 0, -1,  1,  0, -1 },
+    {  7, 0, -1, -1,  0,  1 },
+    {  7, 0, -1, -1,  0,  1 },
+    {  7, 0, -1, -1,  0,  1 },
+    {  7, 0, -1, -1,  0,  1 },
+    {  7, 0, -1, -1,  0,  1 },
+    {  7, 0, -1, -1,  0,  1 },
+    {  7, 0, -1, -1,  0,  1 },
+    {  7, 0, -1, -1,  0,  1 },
+    {  7, 0, -1, -1,  0, -1 },
+    {  7, 0, -1, -1,  0, -1 },
+    {  7, 0, -1, -1,  0, -1 },
+    {  7, 0, -1, -1,  0, -1 },
+    {  7, 0, -1, -1,  0, -1 },
+    {  7, 0, -1, -1,  0, -1 },
+    {  7, 0, -1, -1,  0, -1 },
+    {  7, 0, -1, -1,  0, -1 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1,  1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1,  1, -1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1,  1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0,  1, -1, -1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1,  1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1,  1, -1,  0 },
+    {  7, 0, -1, -1,  1,  0 },
+    {  7, 0, -1, -1,  1,  0 },
+    {  7, 0, -1, -1,  1,  0 },
+    {  7, 0, -1, -1,  1,  0 },
+    {  7, 0, -1, -1,  1,  0 },
+    {  7, 0, -1, -1,  1,  0 },
+    {  7, 0, -1, -1,  1,  0 },
+    {  7, 0, -1, -1,  1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0, -1, -1, -1,  0 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1,  1 },
+    {  7, 0,  1,  0,  1, -1 },
+    {  7, 0,  1,  0,  1, -1 },
+    {  7, 0,  1,  0,  1, -1 },
+    {  7, 0,  1,  0,  1, -1 },
+    {  7, 0,  1,  0,  1, -1 },
+    {  7, 0,  1,  0,  1, -1 },
+    {  7, 0,  1,  0,  1, -1 },
+    {  7, 0,  1,  0,  1, -1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1,  1 },
+    {  7, 0,  1,  0, -1, -1 },
+    {  7, 0,  1,  0, -1, -1 },
+    {  7, 0,  1,  0, -1, -1 },
+    {  7, 0,  1,  0, -1, -1 },
+    {  7, 0,  1,  0, -1, -1 },
+    {  7, 0,  1,  0, -1, -1 },
+    {  7, 0,  1,  0, -1, -1 },
+    {  7, 0,  1,  0, -1, -1 },
+    {  7, 0, -1,  0,  1,  1 },
+    {  7, 0, -1,  0,  1,  1 },
+    {  7, 0, -1,  0,  1,  1 },
+    {  7, 0, -1,  0,  1,  1 },
+    {  7, 0, -1,  0,  1,  1 },
+    {  7, 0, -1,  0,  1,  1 },
+    {  7, 0, -1,  0,  1,  1 },
+    {  7, 0, -1,  0,  1,  1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0,  1, -1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1,  1 },
+    {  7, 0, -1,  0, -1, -1 },
+    {  7, 0, -1,  0, -1, -1 },
+    {  7, 0, -1,  0, -1, -1 },
+    {  7, 0, -1,  0, -1, -1 },
+    {  7, 0, -1,  0, -1, -1 },
+    {  7, 0, -1,  0, -1, -1 },
+    {  7, 0, -1,  0, -1, -1 },
+    {  7, 0, -1,  0, -1, -1 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0,  1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  5, 0, -1,  0,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1,  1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0,  1, -1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1,  1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  6, 0, -1, -1,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  4, 0,  0,  0,  0,  0 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1,  1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0,  1, -1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1,  1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  0,  0, -1, -1 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0,  1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0,  1,  0, -1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0,  1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  6, 0, -1,  0, -1,  0 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0,  1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0,  1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0,  1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0, -1,  0,  0, -1 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1,  1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0,  1, -1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1,  1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  7, 0,  0, -1, -1,  0 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0,  1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  6, 0,  0,  0,  0, -1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0,  1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0,  1,  0, -1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0,  1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  7, 0,  0, -1,  0, -1 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0,  1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  0, -1,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0,  1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  6, 0,  0, -1,  0,  0 },
+    {  7, 1,  2,  1,  1,  1 },
+    {  7, 1,  2,  1,  1,  1 },
+    {  7, 1,  2,  1,  1,  1 },
+    {  7, 1,  2,  1,  1,  1 },
+    {  7, 1,  2,  1,  1,  1 },
+    {  7, 1,  2,  1,  1,  1 },
+    {  7, 1,  2,  1,  1,  1 },
+    {  7, 1,  2,  1,  1,  1 },
+    {  7, 1,  1,  1,  2,  1 },
+    {  7, 1,  1,  1,  2,  1 },
+    {  7, 1,  1,  1,  2,  1 },
+    {  7, 1,  1,  1,  2,  1 },
+    {  7, 1,  1,  1,  2,  1 },
+    {  7, 1,  1,  1,  2,  1 },
+    {  7, 1,  1,  1,  2,  1 },
+    {  7, 1,  1,  1,  2,  1 },
+    {  7, 1,  1,  2,  1,  1 },
+    {  7, 1,  1,  2,  1,  1 },
+    {  7, 1,  1,  2,  1,  1 },
+    {  7, 1,  1,  2,  1,  1 },
+    {  7, 1,  1,  2,  1,  1 },
+    {  7, 1,  1,  2,  1,  1 },
+    {  7, 1,  1,  2,  1,  1 },
+    {  7, 1,  1,  2,  1,  1 },
+    {  7, 1,  1,  1,  1,  2 },
+    {  7, 1,  1,  1,  1,  2 },
+    {  7, 1,  1,  1,  1,  2 },
+    {  7, 1,  1,  1,  1,  2 },
+    {  7, 1,  1,  1,  1,  2 },
+    {  7, 1,  1,  1,  1,  2 },
+    {  7, 1,  1,  1,  1,  2 },
+    {  7, 1,  1,  1,  1,  2 },
+    { 10, 0,  2,  1,  1,  0 },
+    { 10, 0,  2,  1, -1,  0 },
+    { 10, 0,  2, -1,  1,  0 },
+    { 10, 0,  2, -1, -1,  0 },
+    { 10, 0, -2,  1,  1,  0 },
+    { 10, 0, -2,  1, -1,  0 },
+    { 10, 0, -2, -1,  1,  0 },
+    { 10, 0, -2, -1, -1,  0 },
+    { 10, 0,  2,  1,  0,  1 },
+    { 10, 0,  2,  1,  0, -1 },
+    { 10, 0,  2, -1,  0,  1 },
+    { 10, 0,  2, -1,  0, -1 },
+    { 10, 0, -2,  1,  0,  1 },
+    { 10, 0, -2,  1,  0, -1 },
+    { 10, 0, -2, -1,  0,  1 },
+    { 10, 0, -2, -1,  0, -1 },
+    { 10, 0,  1,  2,  1,  0 },
+    { 10, 0,  1,  2, -1,  0 },
+    { 10, 0,  1, -2,  1,  0 },
+    { 10, 0,  1, -2, -1,  0 },
+    { 10, 0, -1,  2,  1,  0 },
+    { 10, 0, -1,  2, -1,  0 },
+    { 10, 0, -1, -2,  1,  0 },
+    { 10, 0, -1, -2, -1,  0 },
+    { 10, 0,  2,  0,  1,  1 },
+    { 10, 0,  2,  0,  1, -1 },
+    { 10, 0,  2,  0, -1,  1 },
+    { 10, 0,  2,  0, -1, -1 },
+    { 10, 0, -2,  0,  1,  1 },
+    { 10, 0, -2,  0,  1, -1 },
+    { 10, 0, -2,  0, -1,  1 },
+    { 10, 0, -2,  0, -1, -1 },
+    { 10, 0,  0,  1,  2,  1 },
+    { 10, 0,  0,  1,  2, -1 },
+    { 10, 0,  0,  1, -2,  1 },
+    { 10, 0,  0,  1, -2, -1 },
+    { 10, 0,  0, -1,  2,  1 },
+    { 10, 0,  0, -1,  2, -1 },
+    { 10, 0,  0, -1, -2,  1 },
+    { 10, 0,  0, -1, -2, -1 },
+    {  8, 1,  0,  1,  1,  2 },
+    {  8, 1,  0,  1,  1,  2 },
+    {  8, 1,  0,  1,  1,  2 },
+    {  8, 1,  0,  1,  1,  2 },
+    {  8, 1,  1,  1,  2,  0 },
+    {  8, 1,  1,  1,  2,  0 },
+    {  8, 1,  1,  1,  2,  0 },
+    {  8, 1,  1,  1,  2,  0 },
+    {  8, 1,  0,  2,  1,  1 },
+    {  8, 1,  0,  2,  1,  1 },
+    {  8, 1,  0,  2,  1,  1 },
+    {  8, 1,  0,  2,  1,  1 },
+    {  8, 1,  1,  0,  1,  2 },
+    {  8, 1,  1,  0,  1,  2 },
+    {  8, 1,  1,  0,  1,  2 },
+    {  8, 1,  1,  0,  1,  2 },
+    {  8, 1,  1,  2,  0,  1 },
+    {  8, 1,  1,  2,  0,  1 },
+    {  8, 1,  1,  2,  0,  1 },
+    {  8, 1,  1,  2,  0,  1 },
+    {  8, 1,  1,  1,  0,  2 },
+    {  8, 1,  1,  1,  0,  2 },
+    {  8, 1,  1,  1,  0,  2 },
+    {  8, 1,  1,  1,  0,  2 },
+    {  8, 1,  1,  0,  2,  1 },
+    {  8, 1,  1,  0,  2,  1 },
+    {  8, 1,  1,  0,  2,  1 },
+    {  8, 1,  1,  0,  2,  1 },
+    { 10, 0,  2,  1,  0,  0 },
+    { 10, 0,  2, -1,  0,  0 },
+    { 10, 0, -2,  1,  0,  0 },
+    { 10, 0, -2, -1,  0,  0 },
+    { 10, 0,  2,  0,  1,  0 },
+    { 10, 0,  2,  0, -1,  0 },
+    { 10, 0, -2,  0,  1,  0 },
+    { 10, 0, -2,  0, -1,  0 },
+    { 10, 0,  1,  2,  0,  0 },
+    { 10, 0,  1, -2,  0,  0 },
+    { 10, 0, -1,  2,  0,  0 },
+    { 10, 0, -1, -2,  0,  0 },
+    { 10, 0,  2,  0,  0,  1 },
+    { 10, 0,  2,  0,  0, -1 },
+    { 10, 0, -2,  0,  0,  1 },
+    { 10, 0, -2,  0,  0, -1 },
+    { 10, 0,  0,  1,  0,  2 },
+    { 10, 0,  0,  1,  0, -2 },
+    { 10, 0,  0, -1,  0,  2 },
+    { 10, 0,  0, -1,  0, -2 },
+    { 10, 0,  0,  2,  1,  0 },
+    { 10, 0,  0,  2, -1,  0 },
+    { 10, 0,  0, -2,  1,  0 },
+    { 10, 0,  0, -2, -1,  0 },
+    { 10, 0,  0,  0,  1,  2 },
+    { 10, 0,  0,  0,  1, -2 },
+    { 10, 0,  0,  0, -1,  2 },
+    { 10, 0,  0,  0, -1, -2 },
+    { 10, 0,  0,  1,  2,  0 },
+    { 10, 0,  0,  1, -2,  0 },
+    { 10, 0,  0, -1,  2,  0 },
+    { 10, 0,  0, -1, -2,  0 },
+    { 10, 0,  0,  2,  0,  1 },
+    { 10, 0,  0,  2,  0, -1 },
+    { 10, 0,  0, -2,  0,  1 },
+    { 10, 0,  0, -2,  0, -1 },
+    { 10, 0,  1,  0,  0,  2 },
+    { 10, 0,  1,  0,  0, -2 },
+    { 10, 0, -1,  0,  0,  2 },
+    { 10, 0, -1,  0,  0, -2 },
+    { 10, 0,  0,  0,  2,  1 },
+    { 10, 0,  0,  0,  2, -1 },
+    { 10, 0,  0,  0, -2,  1 },
+    { 10, 0,  0,  0, -2, -1 },
+    { 10, 0,  1,  0,  2,  0 },
+    { 10, 0,  1,  0, -2,  0 },
+    { 10, 0, -1,  0,  2,  0 },
+    { 10, 0, -1,  0, -2,  0 },
+    {  9, 0,  2,  0,  0,  0 },
+    {  9, 0,  2,  0,  0,  0 },
+    {  9, 0, -2,  0,  0,  0 },
+    {  9, 0, -2,  0,  0,  0 },
+    {  9, 0,  0,  0,  0,  2 },
+    {  9, 0,  0,  0,  0,  2 },
+    {  9, 0,  0,  0,  0, -2 },
+    {  9, 0,  0,  0,  0, -2 },
+    { 10, 0,  0,  2,  0,  0 },
+    { 10, 0,  0, -2,  0,  0 },
+    { 10, 0,  0,  0,  2,  0 },
+    { 10, 0,  0,  0, -2,  0 },
+    {  9, 1,  1,  2,  2,  1 },
+    {  9, 1,  1,  2,  2,  1 },
+    {  9, 1,  2,  2,  1,  1 },
+    {  9, 1,  2,  2,  1,  1 },
+    {  9, 1,  2,  1,  2,  1 },
+    {  9, 1,  2,  1,  2,  1 },
+    {  9, 1,  1,  1,  2,  2 },
+    {  9, 1,  1,  1,  2,  2 },
+    {  9, 1,  1,  2,  1,  2 },
+    {  9, 1,  1,  2,  1,  2 },
+    {  9, 1,  2,  1,  1,  2 },
+    {  9, 1,  2,  1,  1,  2 },
+    { 10, 1,  1,  2,  2,  0 },
+    { 10, 1,  2,  2,  1,  0 },
+    { 10, 1,  2,  1,  2,  0 },
+    { 10, 1,  0,  2,  2,  1 },
+    { 10, 1,  0,  1,  2,  2 },
+    { 10, 1,  2,  2,  0,  1 },
+    { 10, 1,  0,  2,  1,  2 },
+    { 10, 1,  2,  0,  2,  1 },
+    { 10, 1,  1,  0,  2,  2 },
+    { 10, 1,  2,  2,  2,  1 },
+    { 10, 1,  1,  2,  0,  2 },
+    { 10, 1,  2,  0,  1,  2 },
+    { 10, 1,  2,  1,  0,  2 },
+    { 10, 1,  1,  2,  2,  2 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 },
+    {  0, 0,  0,  0,  0,  0 }
+};
+
+static const hcb_lut_pair hcb5_lut[1024] = {
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,   3 },
+    {  9, 0,  -3,  -1 },
+    {  9, 0,  -3,  -1 },
+    {  9, 0,   1,   3 },
+    {  9, 0,   1,   3 },
+    {  9, 0,   3,   1 },
+    {  9, 0,   3,   1 },
+    {  9, 0,  -1,  -3 },
+    {  9, 0,  -1,  -3 },
+    {  9, 0,  -3,   1 },
+    {  9, 0,  -3,   1 },
+    {  9, 0,   3,  -1 },
+    {  9, 0,   3,  -1 },
+    {  9, 0,   1,  -3 },
+    {  9, 0,   1,  -3 },
+    {  9, 0,  -1,   3 },
+    {  9, 0,  -1,   3 },
+    {  9, 0,  -2,   2 },
+    {  9, 0,  -2,   2 },
+    {  9, 0,   2,   2 },
+    {  9, 0,   2,   2 },
+    {  9, 0,  -2,  -2 },
+    {  9, 0,  -2,  -2 },
+    {  9, 0,   2,  -2 },
+    {  9, 0,   2,  -2 },
+    { 10, 0,  -3,  -2 },
+    { 10, 0,   3,  -2 },
+    { 10, 0,  -2,   3 },
+    { 10, 0,   2,  -3 },
+    { 10, 0,   3,   2 },
+    { 10, 0,   2,   3 },
+    { 10, 0,  -3,   2 },
+    { 10, 0,  -2,  -3 },
+    { 10, 0,   0,  -4 },
+    { 10, 0,  -4,   0 },
+    { 10, 0,   4,   1 },
+    { 10, 0,   4,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 }
+};
+
+static const hcb_lut_pair hcb6_lut[1024] = {
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,   1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,  -1,   1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,   1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  4, 0,  -1,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  8, 0,  -3,  -2 },
+    {  8, 0,  -3,  -2 },
+    {  8, 0,  -3,  -2 },
+    {  8, 0,  -3,  -2 },
+    {  8, 0,  -2,   3 },
+    {  8, 0,  -2,   3 },
+    {  8, 0,  -2,   3 },
+    {  8, 0,  -2,   3 },
+    {  8, 0,   2,   3 },
+    {  8, 0,   2,   3 },
+    {  8, 0,   2,   3 },
+    {  8, 0,   2,   3 },
+    {  8, 0,   3,  -2 },
+    {  8, 0,   3,  -2 },
+    {  8, 0,   3,  -2 },
+    {  8, 0,   3,  -2 },
+    {  8, 0,   2,  -3 },
+    {  8, 0,   2,  -3 },
+    {  8, 0,   2,  -3 },
+    {  8, 0,   2,  -3 },
+    {  8, 0,  -2,  -3 },
+    {  8, 0,  -2,  -3 },
+    {  8, 0,  -2,  -3 },
+    {  8, 0,  -2,  -3 },
+    {  8, 0,  -3,   2 },
+    {  8, 0,  -3,   2 },
+    {  8, 0,  -3,   2 },
+    {  8, 0,  -3,   2 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,   3 },
+    {  9, 0,   3,  -3 },
+    {  9, 0,   3,  -3 },
+    {  9, 0,  -3,  -3 },
+    {  9, 0,  -3,  -3 },
+    {  9, 0,  -3,   3 },
+    {  9, 0,  -3,   3 },
+    {  9, 0,   1,  -4 },
+    {  9, 0,   1,  -4 },
+    {  9, 0,  -1,  -4 },
+    {  9, 0,  -1,  -4 },
+    {  9, 0,   4,   1 },
+    {  9, 0,   4,   1 },
+    {  9, 0,  -4,   1 },
+    {  9, 0,  -4,   1 },
+    {  9, 0,  -4,  -1 },
+    {  9, 0,  -4,  -1 },
+    {  9, 0,   1,   4 },
+    {  9, 0,   1,   4 },
+    {  9, 0,   4,  -1 },
+    {  9, 0,   4,  -1 },
+    {  9, 0,  -1,   4 },
+    {  9, 0,  -1,   4 },
+    {  9, 0,   0,  -4 },
+    {  9, 0,   0,  -4 },
+    {  9, 0,  -4,   2 },
+    {  9, 0,  -4,   2 },
+    {  9, 0,  -4,  -2 },
+    {  9, 0,  -4,  -2 },
+    {  9, 0,   2,   4 },
+    {  9, 0,   2,   4 },
+    {  9, 0,  -2,  -4 },
+    {  9, 0,  -2,  -4 },
+    {  9, 0,  -4,   0 },
+    {  9, 0,  -4,   0 },
+    {  9, 0,   4,   2 },
+    {  9, 0,   4,   2 },
+    {  9, 0,   4,  -2 },
+    {  9, 0,   4,  -2 },
+    {  9, 0,  -2,   4 },
+    {  9, 0,  -2,   4 },
+    {  9, 0,   4,   0 },
+    {  9, 0,   4,   0 },
+    {  9, 0,   2,  -4 },
+    {  9, 0,   2,  -4 },
+    {  9, 0,   0,   4 },
+    {  9, 0,   0,   4 },
+    { 10, 0,  -3,  -4 },
+    { 10, 0,  -3,   4 },
+    { 10, 0,   3,  -4 },
+    { 10, 0,   4,  -3 },
+    { 10, 0,   3,   4 },
+    { 10, 0,   4,   3 },
+    { 10, 0,  -4,   3 },
+    { 10, 0,  -4,  -3 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 }
+};
+
+static const hcb_lut_pair hcb7_lut[1024] = {
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,  -1,  -2 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  9, 0,   3,   1 },
+    {  9, 0,   3,   1 },
+    {  9, 0,   3,  -1 },
+    {  9, 0,   3,  -1 },
+    {  9, 0,  -3,   1 },
+    {  9, 0,  -3,   1 },
+    {  9, 0,  -3,  -1 },
+    {  9, 0,  -3,  -1 },
+    {  9, 0,   1,   3 },
+    {  9, 0,   1,   3 },
+    {  9, 0,   1,  -3 },
+    {  9, 0,   1,  -3 },
+    {  9, 0,  -1,   3 },
+    {  9, 0,  -1,   3 },
+    {  9, 0,  -1,  -3 },
+    {  9, 0,  -1,  -3 },
+    {  9, 0,   2,   2 },
+    {  9, 0,   2,   2 },
+    {  9, 0,   2,  -2 },
+    {  9, 0,   2,  -2 },
+    {  9, 0,  -2,   2 },
+    {  9, 0,  -2,   2 },
+    {  9, 0,  -2,  -2 },
+    {  9, 0,  -2,  -2 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,  -3 },
+    { 10, 0,   2,   3 },
+    { 10, 0,   2,  -3 },
+    { 10, 0,  -2,   3 },
+    { 10, 0,  -2,  -3 },
+    { 10, 0,   3,   2 },
+    { 10, 0,   3,  -2 },
+    { 10, 0,  -3,   2 },
+    { 10, 0,  -3,  -2 },
+    { 10, 0,   1,   4 },
+    { 10, 0,   1,  -4 },
+    { 10, 0,  -1,   4 },
+    { 10, 0,  -1,  -4 },
+    { 10, 0,   4,   1 },
+    { 10, 0,   4,  -1 },
+    { 10, 0,  -4,   1 },
+    { 10, 0,  -4,  -1 },
+    { 10, 0,   1,   5 },
+    { 10, 0,   1,  -5 },
+    { 10, 0,  -1,   5 },
+    { 10, 0,  -1,  -5 },
+    { 10, 0,   5,   1 },
+    { 10, 0,   5,  -1 },
+    { 10, 0,  -5,   1 },
+    { 10, 0,  -5,  -1 },
+    { 10, 0,   3,   3 },
+    { 10, 0,   3,  -3 },
+    { 10, 0,  -3,   3 },
+    { 10, 0,  -3,  -3 },
+    { 10, 0,   2,   4 },
+    { 10, 0,   2,  -4 },
+    { 10, 0,  -2,   4 },
+    { 10, 0,  -2,  -4 },
+    {  9, 0,   0,   4 },
+    {  9, 0,   0,   4 },
+    {  9, 0,   0,  -4 },
+    {  9, 0,   0,  -4 },
+    {  9, 0,   4,   0 },
+    {  9, 0,   4,   0 },
+    {  9, 0,  -4,   0 },
+    {  9, 0,  -4,   0 },
+    {  9, 1,   4,   2 },
+    {  9, 1,   4,   2 },
+    {  9, 1,   2,   5 },
+    {  9, 1,   2,   5 },
+    {  9, 1,   5,   2 },
+    {  9, 1,   5,   2 },
+    { 10, 0,   0,   5 },
+    { 10, 0,   0,  -5 },
+    {  9, 1,   6,   1 },
+    {  9, 1,   6,   1 },
+    { 10, 0,   5,   0 },
+    { 10, 0,  -5,   0 },
+    {  9, 1,   1,   6 },
+    {  9, 1,   1,   6 },
+    {  9, 1,   4,   3 },
+    {  9, 1,   4,   3 },
+    {  9, 1,   3,   5 },
+    {  9, 1,   3,   5 },
+    {  9, 1,   3,   4 },
+    {  9, 1,   3,   4 },
+    {  9, 1,   5,   3 },
+    {  9, 1,   5,   3 },
+    {  9, 1,   2,   6 },
+    {  9, 1,   2,   6 },
+    {  9, 1,   6,   2 },
+    {  9, 1,   6,   2 },
+    {  9, 1,   1,   7 },
+    {  9, 1,   1,   7 },
+    { 10, 1,   3,   6 },
+    { 10, 1,   0,   6 },
+    { 10, 1,   6,   0 },
+    { 10, 1,   4,   4 },
+    { 10, 1,   7,   1 },
+    { 10, 1,   4,   5 },
+    { 10, 1,   7,   2 },
+    { 10, 1,   5,   4 },
+    { 10, 1,   6,   3 },
+    { 10, 1,   2,   7 },
+    { 10, 1,   7,   3 },
+    { 10, 1,   6,   4 },
+    { 10, 1,   5,   5 },
+    { 10, 1,   4,   6 },
+    { 10, 1,   3,   7 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 }
+};
+
+static const hcb_lut_pair hcb8_lut[1024] = {
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,   1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,   1,  -1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,   1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  5, 0,  -1,  -1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,   1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  5, 0,  -1,   0 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,   1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  5, 0,   0,  -1 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,   2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,   2,  -2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,   2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  6, 0,  -2,  -2 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  5, 0,   0,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,   2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,  -2,   0 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,   2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  6, 0,   0,  -2 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,  -3 },
+    {  8, 0,   3,  -3 },
+    {  8, 0,   3,  -3 },
+    {  8, 0,   3,  -3 },
+    {  8, 0,  -3,   3 },
+    {  8, 0,  -3,   3 },
+    {  8, 0,  -3,   3 },
+    {  8, 0,  -3,   3 },
+    {  8, 0,  -3,  -3 },
+    {  8, 0,  -3,  -3 },
+    {  8, 0,  -3,  -3 },
+    {  8, 0,  -3,  -3 },
+    {  8, 0,   4,   1 },
+    {  8, 0,   4,   1 },
+    {  8, 0,   4,   1 },
+    {  8, 0,   4,   1 },
+    {  8, 0,   4,  -1 },
+    {  8, 0,   4,  -1 },
+    {  8, 0,   4,  -1 },
+    {  8, 0,   4,  -1 },
+    {  8, 0,  -4,   1 },
+    {  8, 0,  -4,   1 },
+    {  8, 0,  -4,   1 },
+    {  8, 0,  -4,   1 },
+    {  8, 0,  -4,  -1 },
+    {  8, 0,  -4,  -1 },
+    {  8, 0,  -4,  -1 },
+    {  8, 0,  -4,  -1 },
+    {  8, 0,   1,   4 },
+    {  8, 0,   1,   4 },
+    {  8, 0,   1,   4 },
+    {  8, 0,   1,   4 },
+    {  8, 0,   1,  -4 },
+    {  8, 0,   1,  -4 },
+    {  8, 0,   1,  -4 },
+    {  8, 0,   1,  -4 },
+    {  8, 0,  -1,   4 },
+    {  8, 0,  -1,   4 },
+    {  8, 0,  -1,   4 },
+    {  8, 0,  -1,   4 },
+    {  8, 0,  -1,  -4 },
+    {  8, 0,  -1,  -4 },
+    {  8, 0,  -1,  -4 },
+    {  8, 0,  -1,  -4 },
+    {  8, 0,   4,   2 },
+    {  8, 0,   4,   2 },
+    {  8, 0,   4,   2 },
+    {  8, 0,   4,   2 },
+    {  8, 0,   4,  -2 },
+    {  8, 0,   4,  -2 },
+    {  8, 0,   4,  -2 },
+    {  8, 0,   4,  -2 },
+    {  8, 0,  -4,   2 },
+    {  8, 0,  -4,   2 },
+    {  8, 0,  -4,   2 },
+    {  8, 0,  -4,   2 },
+    {  8, 0,  -4,  -2 },
+    {  8, 0,  -4,  -2 },
+    {  8, 0,  -4,  -2 },
+    {  8, 0,  -4,  -2 },
+    {  8, 0,   2,   4 },
+    {  8, 0,   2,   4 },
+    {  8, 0,   2,   4 },
+    {  8, 0,   2,   4 },
+    {  8, 0,   2,  -4 },
+    {  8, 0,   2,  -4 },
+    {  8, 0,   2,  -4 },
+    {  8, 0,   2,  -4 },
+    {  8, 0,  -2,   4 },
+    {  8, 0,  -2,   4 },
+    {  8, 0,  -2,   4 },
+    {  8, 0,  -2,   4 },
+    {  8, 0,  -2,  -4 },
+    {  8, 0,  -2,  -4 },
+    {  8, 0,  -2,  -4 },
+    {  8, 0,  -2,  -4 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  8, 0,   4,   3 },
+    {  8, 0,   4,   3 },
+    {  8, 0,   4,   3 },
+    {  8, 0,   4,   3 },
+    {  8, 0,   4,  -3 },
+    {  8, 0,   4,  -3 },
+    {  8, 0,   4,  -3 },
+    {  8, 0,   4,  -3 },
+    {  8, 0,  -4,   3 },
+    {  8, 0,  -4,   3 },
+    {  8, 0,  -4,   3 },
+    {  8, 0,  -4,   3 },
+    {  8, 0,  -4,  -3 },
+    {  8, 0,  -4,  -3 },
+    {  8, 0,  -4,  -3 },
+    {  8, 0,  -4,  -3 },
+    {  8, 0,   3,   4 },
+    {  8, 0,   3,   4 },
+    {  8, 0,   3,   4 },
+    {  8, 0,   3,   4 },
+    {  8, 0,   3,  -4 },
+    {  8, 0,   3,  -4 },
+    {  8, 0,   3,  -4 },
+    {  8, 0,   3,  -4 },
+    {  8, 0,  -3,   4 },
+    {  8, 0,  -3,   4 },
+    {  8, 0,  -3,   4 },
+    {  8, 0,  -3,   4 },
+    {  8, 0,  -3,  -4 },
+    {  8, 0,  -3,  -4 },
+    {  8, 0,  -3,  -4 },
+    {  8, 0,  -3,  -4 },
+    {  8, 0,   5,   2 },
+    {  8, 0,   5,   2 },
+    {  8, 0,   5,   2 },
+    {  8, 0,   5,   2 },
+    {  8, 0,   5,  -2 },
+    {  8, 0,   5,  -2 },
+    {  8, 0,   5,  -2 },
+    {  8, 0,   5,  -2 },
+    {  8, 0,  -5,   2 },
+    {  8, 0,  -5,   2 },
+    {  8, 0,  -5,   2 },
+    {  8, 0,  -5,   2 },
+    {  8, 0,  -5,  -2 },
+    {  8, 0,  -5,  -2 },
+    {  8, 0,  -5,  -2 },
+    {  8, 0,  -5,  -2 },
+    {  9, 0,   5,   1 },
+    {  9, 0,   5,   1 },
+    {  9, 0,   5,  -1 },
+    {  9, 0,   5,  -1 },
+    {  9, 0,  -5,   1 },
+    {  9, 0,  -5,   1 },
+    {  9, 0,  -5,  -1 },
+    {  9, 0,  -5,  -1 },
+    {  9, 0,   2,   5 },
+    {  9, 0,   2,   5 },
+    {  9, 0,   2,  -5 },
+    {  9, 0,   2,  -5 },
+    {  9, 0,  -2,   5 },
+    {  9, 0,  -2,   5 },
+    {  9, 0,  -2,  -5 },
+    {  9, 0,  -2,  -5 },
+    {  9, 0,   1,   5 },
+    {  9, 0,   1,   5 },
+    {  9, 0,   1,  -5 },
+    {  9, 0,   1,  -5 },
+    {  9, 0,  -1,   5 },
+    {  9, 0,  -1,   5 },
+    {  9, 0,  -1,  -5 },
+    {  9, 0,  -1,  -5 },
+    {  9, 0,   5,   3 },
+    {  9, 0,   5,   3 },
+    {  9, 0,   5,  -3 },
+    {  9, 0,   5,  -3 },
+    {  9, 0,  -5,   3 },
+    {  9, 0,  -5,   3 },
+    {  9, 0,  -5,  -3 },
+    {  9, 0,  -5,  -3 },
+    {  9, 0,   3,   5 },
+    {  9, 0,   3,   5 },
+    {  9, 0,   3,  -5 },
+    {  9, 0,   3,  -5 },
+    {  9, 0,  -3,   5 },
+    {  9, 0,  -3,   5 },
+    {  9, 0,  -3,  -5 },
+    {  9, 0,  -3,  -5 },
+    {  9, 0,   4,   4 },
+    {  9, 0,   4,   4 },
+    {  9, 0,   4,  -4 },
+    {  9, 0,   4,  -4 },
+    {  9, 0,  -4,   4 },
+    {  9, 0,  -4,   4 },
+    {  9, 0,  -4,  -4 },
+    {  9, 0,  -4,  -4 },
+    {  9, 0,   5,   4 },
+    {  9, 0,   5,   4 },
+    {  9, 0,   5,  -4 },
+    {  9, 0,   5,  -4 },
+    {  9, 0,  -5,   4 },
+    {  9, 0,  -5,   4 },
+    {  9, 0,  -5,  -4 },
+    {  9, 0,  -5,  -4 },
+    {  8, 0,   0,   4 },
+    {  8, 0,   0,   4 },
+    {  8, 0,   0,   4 },
+    {  8, 0,   0,   4 },
+    {  8, 0,   0,  -4 },
+    {  8, 0,   0,  -4 },
+    {  8, 0,   0,  -4 },
+    {  8, 0,   0,  -4 },
+    {  9, 0,   4,   5 },
+    {  9, 0,   4,   5 },
+    {  9, 0,   4,  -5 },
+    {  9, 0,   4,  -5 },
+    {  9, 0,  -4,   5 },
+    {  9, 0,  -4,   5 },
+    {  9, 0,  -4,  -5 },
+    {  9, 0,  -4,  -5 },
+    {  8, 0,   4,   0 },
+    {  8, 0,   4,   0 },
+    {  8, 0,   4,   0 },
+    {  8, 0,   4,   0 },
+    {  8, 0,  -4,   0 },
+    {  8, 0,  -4,   0 },
+    {  8, 0,  -4,   0 },
+    {  8, 0,  -4,   0 },
+    {  9, 0,   2,   6 },
+    {  9, 0,   2,   6 },
+    {  9, 0,   2,  -6 },
+    {  9, 0,   2,  -6 },
+    {  9, 0,  -2,   6 },
+    {  9, 0,  -2,   6 },
+    {  9, 0,  -2,  -6 },
+    {  9, 0,  -2,  -6 },
+    {  9, 0,   6,   2 },
+    {  9, 0,   6,   2 },
+    {  9, 0,   6,  -2 },
+    {  9, 0,   6,  -2 },
+    {  9, 0,  -6,   2 },
+    {  9, 0,  -6,   2 },
+    {  9, 0,  -6,  -2 },
+    {  9, 0,  -6,  -2 },
+    {  9, 0,   6,   1 },
+    {  9, 0,   6,   1 },
+    {  9, 0,   6,  -1 },
+    {  9, 0,   6,  -1 },
+    {  9, 0,  -6,   1 },
+    {  9, 0,  -6,   1 },
+    {  9, 0,  -6,  -1 },
+    {  9, 0,  -6,  -1 },
+    {  9, 0,   1,   6 },
+    {  9, 0,   1,   6 },
+    {  9, 0,   1,  -6 },
+    {  9, 0,   1,  -6 },
+    {  9, 0,  -1,   6 },
+    {  9, 0,  -1,   6 },
+    {  9, 0,  -1,  -6 },
+    {  9, 0,  -1,  -6 },
+    { 10, 0,   3,   6 },
+    { 10, 0,   3,  -6 },
+    { 10, 0,  -3,   6 },
+    { 10, 0,  -3,  -6 },
+    { 10, 0,   6,   3 },
+    { 10, 0,   6,  -3 },
+    { 10, 0,  -6,   3 },
+    { 10, 0,  -6,  -3 },
+    { 10, 0,   5,   5 },
+    { 10, 0,   5,  -5 },
+    { 10, 0,  -5,   5 },
+    { 10, 0,  -5,  -5 },
+    {  9, 0,   5,   0 },
+    {  9, 0,   5,   0 },
+    {  9, 0,  -5,   0 },
+    {  9, 0,  -5,   0 },
+    { 10, 0,   6,   4 },
+    { 10, 0,   6,  -4 },
+    { 10, 0,  -6,   4 },
+    { 10, 0,  -6,  -4 },
+    {  9, 0,   0,   5 },
+    {  9, 0,   0,   5 },
+    {  9, 0,   0,  -5 },
+    {  9, 0,   0,  -5 },
+    { 10, 0,   4,   6 },
+    { 10, 0,   4,  -6 },
+    { 10, 0,  -4,   6 },
+    { 10, 0,  -4,  -6 },
+    { 10, 0,   7,   1 },
+    { 10, 0,   7,  -1 },
+    { 10, 0,  -7,   1 },
+    { 10, 0,  -7,  -1 },
+    { 10, 0,   7,   2 },
+    { 10, 0,   7,  -2 },
+    { 10, 0,  -7,   2 },
+    { 10, 0,  -7,  -2 },
+    { 10, 0,   2,   7 },
+    { 10, 0,   2,  -7 },
+    { 10, 0,  -2,   7 },
+    { 10, 0,  -2,  -7 },
+    { 10, 0,   6,   5 },
+    { 10, 0,   6,  -5 },
+    { 10, 0,  -6,   5 },
+    { 10, 0,  -6,  -5 },
+    { 10, 0,   7,   3 },
+    { 10, 0,   7,  -3 },
+    { 10, 0,  -7,   3 },
+    { 10, 0,  -7,  -3 },
+    { 10, 0,   1,   7 },
+    { 10, 0,   1,  -7 },
+    { 10, 0,  -1,   7 },
+    { 10, 0,  -1,  -7 },
+    { 10, 0,   5,   6 },
+    { 10, 0,   5,  -6 },
+    { 10, 0,  -5,   6 },
+    { 10, 0,  -5,  -6 },
+    { 10, 0,   3,   7 },
+    { 10, 0,   3,  -7 },
+    { 10, 0,  -3,   7 },
+    { 10, 0,  -3,  -7 },
+    {  9, 1,   6,   6 },
+    {  9, 1,   6,   6 },
+    {  9, 1,   7,   4 },
+    {  9, 1,   7,   4 },
+    { 10, 0,   6,   0 },
+    { 10, 0,  -6,   0 },
+    {  9, 1,   4,   7 },
+    {  9, 1,   4,   7 },
+    { 10, 0,   0,   6 },
+    { 10, 0,   0,  -6 },
+    {  9, 1,   7,   5 },
+    {  9, 1,   7,   5 },
+    {  9, 1,   7,   6 },
+    {  9, 1,   7,   6 },
+    {  9, 1,   6,   7 },
+    {  9, 1,   6,   7 },
+    { 10, 1,   5,   7 },
+    { 10, 1,   7,   0 },
+    { 10, 1,   0,   7 },
+    { 10, 1,   7,   7 }
+};
+
+static const hcb_lut_pair hcb9_lut[1024] = {
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  1, 0,   0,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,   1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,  -1,   0 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,   1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  4, 0,   0,  -1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,   1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,   2,  -1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,   1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,  -2,  -1 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,   2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,   1,  -2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,   2 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,  -1,  -2 },
+    {  8, 0,  -1,  -2 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  9, 0,   3,   1 },
+    {  9, 0,   3,   1 },
+    {  9, 0,   3,  -1 },
+    {  9, 0,   3,  -1 },
+    {  9, 0,  -3,   1 },
+    {  9, 0,  -3,   1 },
+    {  9, 0,  -3,  -1 },
+    {  9, 0,  -3,  -1 },
+    {  9, 0,   2,   2 },
+    {  9, 0,   2,   2 },
+    {  9, 0,   2,  -2 },
+    {  9, 0,   2,  -2 },
+    {  9, 0,  -2,   2 },
+    {  9, 0,  -2,   2 },
+    {  9, 0,  -2,  -2 },
+    {  9, 0,  -2,  -2 },
+    {  9, 0,   1,   3 },
+    {  9, 0,   1,   3 },
+    {  9, 0,   1,  -3 },
+    {  9, 0,   1,  -3 },
+    {  9, 0,  -1,   3 },
+    {  9, 0,  -1,   3 },
+    {  9, 0,  -1,  -3 },
+    {  9, 0,  -1,  -3 },
+    {  9, 0,   3,   0 },
+    {  9, 0,   3,   0 },
+    {  9, 0,  -3,   0 },
+    {  9, 0,  -3,   0 },
+    {  9, 0,   0,   3 },
+    {  9, 0,   0,   3 },
+    {  9, 0,   0,  -3 },
+    {  9, 0,   0,  -3 },
+    { 10, 0,   2,   3 },
+    { 10, 0,   2,  -3 },
+    { 10, 0,  -2,   3 },
+    { 10, 0,  -2,  -3 },
+    { 10, 0,   3,   2 },
+    { 10, 0,   3,  -2 },
+    { 10, 0,  -3,   2 },
+    { 10, 0,  -3,  -2 },
+    { 10, 0,   1,   4 },
+    { 10, 0,   1,  -4 },
+    { 10, 0,  -1,   4 },
+    { 10, 0,  -1,  -4 },
+    { 10, 0,   4,   1 },
+    { 10, 0,   4,  -1 },
+    { 10, 0,  -4,   1 },
+    { 10, 0,  -4,  -1 },
+    { 10, 0,   2,   4 },
+    { 10, 0,   2,  -4 },
+    { 10, 0,  -2,   4 },
+    { 10, 0,  -2,  -4 },
+    { 10, 0,   1,   5 },
+    { 10, 0,   1,  -5 },
+    { 10, 0,  -1,   5 },
+    { 10, 0,  -1,  -5 },
+    {  9, 1,   4,   2 },
+    {  9, 1,   4,   2 },
+    {  9, 1,   3,   3 },
+    {  9, 1,   3,   3 },
+    { 10, 0,   0,   4 },
+    { 10, 0,   0,  -4 },
+    { 10, 0,   4,   0 },
+    { 10, 0,  -4,   0 },
+    {  9, 1,   5,   1 },
+    {  9, 1,   5,   1 },
+    {  9, 1,   2,   5 },
+    {  9, 1,   2,   5 },
+    {  9, 1,   1,   6 },
+    {  9, 1,   1,   6 },
+    {  9, 1,   3,   4 },
+    {  9, 1,   3,   4 },
+    {  9, 1,   5,   2 },
+    {  9, 1,   5,   2 },
+    {  9, 1,   6,   1 },
+    {  9, 1,   6,   1 },
+    {  9, 1,   4,   3 },
+    {  9, 1,   4,   3 },
+    { 10, 1,   0,   5 },
+    { 10, 1,   2,   6 },
+    { 10, 1,   5,   0 },
+    { 10, 1,   1,   7 },
+    { 10, 1,   3,   5 },
+    { 10, 1,   1,   8 },
+    { 10, 1,   8,   1 },
+    { 10, 1,   4,   4 },
+    { 10, 1,   5,   3 },
+    { 10, 1,   6,   2 },
+    { 10, 1,   7,   1 },
+    { 10, 1,   0,   6 },
+    { 10, 1,   8,   2 },
+    { 10, 1,   2,   8 },
+    { 10, 1,   3,   6 },
+    { 10, 1,   2,   7 },
+    { 10, 1,   4,   5 },
+    { 10, 1,   9,   1 },
+    { 10, 1,   1,   9 },
+    { 10, 1,   7,   2 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 }
+};
+
+static const hcb_lut_pair hcb10_lut[1024] = {
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,   2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,   1,  -2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,   2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,  -1,  -2 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,   1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,   2,  -1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,   1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  6, 0,  -2,  -1 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,   3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,   1,  -3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,   3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,  -1,  -3 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,   2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,   3,  -2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,   2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,  -3,  -2 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,   1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,   3,  -1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,   1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,  -3,  -1 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,   3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,   2,  -3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,   3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,  -2,  -3 },
+    {  7, 0,   3,   3 },
+    {  7, 0,   3,   3 },
+    {  7, 0,   3,   3 },
+    {  7, 0,   3,   3 },
+    {  7, 0,   3,   3 },
+    {  7, 0,   3,   3 },
+    {  7, 0,   3,   3 },
+    {  7, 0,   3,   3 },
+    {  7, 0,   3,  -3 },
+    {  7, 0,   3,  -3 },
+    {  7, 0,   3,  -3 },
+    {  7, 0,   3,  -3 },
+    {  7, 0,   3,  -3 },
+    {  7, 0,   3,  -3 },
+    {  7, 0,   3,  -3 },
+    {  7, 0,   3,  -3 },
+    {  7, 0,  -3,   3 },
+    {  7, 0,  -3,   3 },
+    {  7, 0,  -3,   3 },
+    {  7, 0,  -3,   3 },
+    {  7, 0,  -3,   3 },
+    {  7, 0,  -3,   3 },
+    {  7, 0,  -3,   3 },
+    {  7, 0,  -3,   3 },
+    {  7, 0,  -3,  -3 },
+    {  7, 0,  -3,  -3 },
+    {  7, 0,  -3,  -3 },
+    {  7, 0,  -3,  -3 },
+    {  7, 0,  -3,  -3 },
+    {  7, 0,  -3,  -3 },
+    {  7, 0,  -3,  -3 },
+    {  7, 0,  -3,  -3 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  8, 0,   2,   4 },
+    {  8, 0,   2,   4 },
+    {  8, 0,   2,   4 },
+    {  8, 0,   2,   4 },
+    {  8, 0,   2,  -4 },
+    {  8, 0,   2,  -4 },
+    {  8, 0,   2,  -4 },
+    {  8, 0,   2,  -4 },
+    {  8, 0,  -2,   4 },
+    {  8, 0,  -2,   4 },
+    {  8, 0,  -2,   4 },
+    {  8, 0,  -2,   4 },
+    {  8, 0,  -2,  -4 },
+    {  8, 0,  -2,  -4 },
+    {  8, 0,  -2,  -4 },
+    {  8, 0,  -2,  -4 },
+    {  8, 0,   4,   2 },
+    {  8, 0,   4,   2 },
+    {  8, 0,   4,   2 },
+    {  8, 0,   4,   2 },
+    {  8, 0,   4,  -2 },
+    {  8, 0,   4,  -2 },
+    {  8, 0,   4,  -2 },
+    {  8, 0,   4,  -2 },
+    {  8, 0,  -4,   2 },
+    {  8, 0,  -4,   2 },
+    {  8, 0,  -4,   2 },
+    {  8, 0,  -4,   2 },
+    {  8, 0,  -4,  -2 },
+    {  8, 0,  -4,  -2 },
+    {  8, 0,  -4,  -2 },
+    {  8, 0,  -4,  -2 },
+    {  8, 0,   1,   4 },
+    {  8, 0,   1,   4 },
+    {  8, 0,   1,   4 },
+    {  8, 0,   1,   4 },
+    {  8, 0,   1,  -4 },
+    {  8, 0,   1,  -4 },
+    {  8, 0,   1,  -4 },
+    {  8, 0,   1,  -4 },
+    {  8, 0,  -1,   4 },
+    {  8, 0,  -1,   4 },
+    {  8, 0,  -1,   4 },
+    {  8, 0,  -1,   4 },
+    {  8, 0,  -1,  -4 },
+    {  8, 0,  -1,  -4 },
+    {  8, 0,  -1,  -4 },
+    {  8, 0,  -1,  -4 },
+    {  8, 0,   4,   1 },
+    {  8, 0,   4,   1 },
+    {  8, 0,   4,   1 },
+    {  8, 0,   4,   1 },
+    {  8, 0,   4,  -1 },
+    {  8, 0,   4,  -1 },
+    {  8, 0,   4,  -1 },
+    {  8, 0,   4,  -1 },
+    {  8, 0,  -4,   1 },
+    {  8, 0,  -4,   1 },
+    {  8, 0,  -4,   1 },
+    {  8, 0,  -4,   1 },
+    {  8, 0,  -4,  -1 },
+    {  8, 0,  -4,  -1 },
+    {  8, 0,  -4,  -1 },
+    {  8, 0,  -4,  -1 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  6, 0,   0,   0 },
+    {  8, 0,   4,   3 },
+    {  8, 0,   4,   3 },
+    {  8, 0,   4,   3 },
+    {  8, 0,   4,   3 },
+    {  8, 0,   4,  -3 },
+    {  8, 0,   4,  -3 },
+    {  8, 0,   4,  -3 },
+    {  8, 0,   4,  -3 },
+    {  8, 0,  -4,   3 },
+    {  8, 0,  -4,   3 },
+    {  8, 0,  -4,   3 },
+    {  8, 0,  -4,   3 },
+    {  8, 0,  -4,  -3 },
+    {  8, 0,  -4,  -3 },
+    {  8, 0,  -4,  -3 },
+    {  8, 0,  -4,  -3 },
+    {  8, 0,   3,   4 },
+    {  8, 0,   3,   4 },
+    {  8, 0,   3,   4 },
+    {  8, 0,   3,   4 },
+    {  8, 0,   3,  -4 },
+    {  8, 0,   3,  -4 },
+    {  8, 0,   3,  -4 },
+    {  8, 0,   3,  -4 },
+    {  8, 0,  -3,   4 },
+    {  8, 0,  -3,   4 },
+    {  8, 0,  -3,   4 },
+    {  8, 0,  -3,   4 },
+    {  8, 0,  -3,  -4 },
+    {  8, 0,  -3,  -4 },
+    {  8, 0,  -3,  -4 },
+    {  8, 0,  -3,  -4 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,   3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,  -3,   0 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,   3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  7, 0,   0,  -3 },
+    {  8, 0,   4,   4 },
+    {  8, 0,   4,   4 },
+    {  8, 0,   4,   4 },
+    {  8, 0,   4,   4 },
+    {  8, 0,   4,  -4 },
+    {  8, 0,   4,  -4 },
+    {  8, 0,   4,  -4 },
+    {  8, 0,   4,  -4 },
+    {  8, 0,  -4,   4 },
+    {  8, 0,  -4,   4 },
+    {  8, 0,  -4,   4 },
+    {  8, 0,  -4,   4 },
+    {  8, 0,  -4,  -4 },
+    {  8, 0,  -4,  -4 },
+    {  8, 0,  -4,  -4 },
+    {  8, 0,  -4,  -4 },
+    {  8, 0,   2,   5 },
+    {  8, 0,   2,   5 },
+    {  8, 0,   2,   5 },
+    {  8, 0,   2,   5 },
+    {  8, 0,   2,  -5 },
+    {  8, 0,   2,  -5 },
+    {  8, 0,   2,  -5 },
+    {  8, 0,   2,  -5 },
+    {  8, 0,  -2,   5 },
+    {  8, 0,  -2,   5 },
+    {  8, 0,  -2,   5 },
+    {  8, 0,  -2,   5 },
+    {  8, 0,  -2,  -5 },
+    {  8, 0,  -2,  -5 },
+    {  8, 0,  -2,  -5 },
+    {  8, 0,  -2,  -5 },
+    {  8, 0,   5,   2 },
+    {  8, 0,   5,   2 },
+    {  8, 0,   5,   2 },
+    {  8, 0,   5,   2 },
+    {  8, 0,   5,  -2 },
+    {  8, 0,   5,  -2 },
+    {  8, 0,   5,  -2 },
+    {  8, 0,   5,  -2 },
+    {  8, 0,  -5,   2 },
+    {  8, 0,  -5,   2 },
+    {  8, 0,  -5,   2 },
+    {  8, 0,  -5,   2 },
+    {  8, 0,  -5,  -2 },
+    {  8, 0,  -5,  -2 },
+    {  8, 0,  -5,  -2 },
+    {  8, 0,  -5,  -2 },
+    {  9, 0,   1,   5 },
+    {  9, 0,   1,   5 },
+    {  9, 0,   1,  -5 },
+    {  9, 0,   1,  -5 },
+    {  9, 0,  -1,   5 },
+    {  9, 0,  -1,   5 },
+    {  9, 0,  -1,  -5 },
+    {  9, 0,  -1,  -5 },
+    {  9, 0,   5,   1 },
+    {  9, 0,   5,   1 },
+    {  9, 0,   5,  -1 },
+    {  9, 0,   5,  -1 },
+    {  9, 0,  -5,   1 },
+    {  9, 0,  -5,   1 },
+    {  9, 0,  -5,  -1 },
+    {  9, 0,  -5,  -1 },
+    {  9, 0,   5,   3 },
+    {  9, 0,   5,   3 },
+    {  9, 0,   5,  -3 },
+    {  9, 0,   5,  -3 },
+    {  9, 0,  -5,   3 },
+    {  9, 0,  -5,   3 },
+    {  9, 0,  -5,  -3 },
+    {  9, 0,  -5,  -3 },
+    {  9, 0,   3,   5 },
+    {  9, 0,   3,   5 },
+    {  9, 0,   3,  -5 },
+    {  9, 0,   3,  -5 },
+    {  9, 0,  -3,   5 },
+    {  9, 0,  -3,   5 },
+    {  9, 0,  -3,  -5 },
+    {  9, 0,  -3,  -5 },
+    {  9, 0,   5,   4 },
+    {  9, 0,   5,   4 },
+    {  9, 0,   5,  -4 },
+    {  9, 0,   5,  -4 },
+    {  9, 0,  -5,   4 },
+    {  9, 0,  -5,   4 },
+    {  9, 0,  -5,  -4 },
+    {  9, 0,  -5,  -4 },
+    {  9, 0,   4,   5 },
+    {  9, 0,   4,   5 },
+    {  9, 0,   4,  -5 },
+    {  9, 0,   4,  -5 },
+    {  9, 0,  -4,   5 },
+    {  9, 0,  -4,   5 },
+    {  9, 0,  -4,  -5 },
+    {  9, 0,  -4,  -5 },
+    {  9, 0,   6,   2 },
+    {  9, 0,   6,   2 },
+    {  9, 0,   6,  -2 },
+    {  9, 0,   6,  -2 },
+    {  9, 0,  -6,   2 },
+    {  9, 0,  -6,   2 },
+    {  9, 0,  -6,  -2 },
+    {  9, 0,  -6,  -2 },
+    {  9, 0,   2,   6 },
+    {  9, 0,   2,   6 },
+    {  9, 0,   2,  -6 },
+    {  9, 0,   2,  -6 },
+    {  9, 0,  -2,   6 },
+    {  9, 0,  -2,   6 },
+    {  9, 0,  -2,  -6 },
+    {  9, 0,  -2,  -6 },
+    {  9, 0,   6,   3 },
+    {  9, 0,   6,   3 },
+    {  9, 0,   6,  -3 },
+    {  9, 0,   6,  -3 },
+    {  9, 0,  -6,   3 },
+    {  9, 0,  -6,   3 },
+    {  9, 0,  -6,  -3 },
+    {  9, 0,  -6,  -3 },
+    {  8, 0,   4,   0 },
+    {  8, 0,   4,   0 },
+    {  8, 0,   4,   0 },
+    {  8, 0,   4,   0 },
+    {  8, 0,  -4,   0 },
+    {  8, 0,  -4,   0 },
+    {  8, 0,  -4,   0 },
+    {  8, 0,  -4,   0 },
+    {  9, 0,   6,   1 },
+    {  9, 0,   6,   1 },
+    {  9, 0,   6,  -1 },
+    {  9, 0,   6,  -1 },
+    {  9, 0,  -6,   1 },
+    {  9, 0,  -6,   1 },
+    {  9, 0,  -6,  -1 },
+    {  9, 0,  -6,  -1 },
+    {  8, 0,   0,   4 },
+    {  8, 0,   0,   4 },
+    {  8, 0,   0,   4 },
+    {  8, 0,   0,   4 },
+    {  8, 0,   0,  -4 },
+    {  8, 0,   0,  -4 },
+    {  8, 0,   0,  -4 },
+    {  8, 0,   0,  -4 },
+    {  9, 0,   1,   6 },
+    {  9, 0,   1,   6 },
+    {  9, 0,   1,  -6 },
+    {  9, 0,   1,  -6 },
+    {  9, 0,  -1,   6 },
+    {  9, 0,  -1,   6 },
+    {  9, 0,  -1,  -6 },
+    {  9, 0,  -1,  -6 },
+    {  9, 0,   3,   6 },
+    {  9, 0,   3,   6 },
+    {  9, 0,   3,  -6 },
+    {  9, 0,   3,  -6 },
+    {  9, 0,  -3,   6 },
+    {  9, 0,  -3,   6 },
+    {  9, 0,  -3,  -6 },
+    {  9, 0,  -3,  -6 },
+    {  9, 0,   5,   5 },
+    {  9, 0,   5,   5 },
+    {  9, 0,   5,  -5 },
+    {  9, 0,   5,  -5 },
+    {  9, 0,  -5,   5 },
+    {  9, 0,  -5,   5 },
+    {  9, 0,  -5,  -5 },
+    {  9, 0,  -5,  -5 },
+    {  9, 0,   6,   4 },
+    {  9, 0,   6,   4 },
+    {  9, 0,   6,  -4 },
+    {  9, 0,   6,  -4 },
+    {  9, 0,  -6,   4 },
+    {  9, 0,  -6,   4 },
+    {  9, 0,  -6,  -4 },
+    {  9, 0,  -6,  -4 },
+    {  9, 0,   4,   6 },
+    {  9, 0,   4,   6 },
+    {  9, 0,   4,  -6 },
+    {  9, 0,   4,  -6 },
+    {  9, 0,  -4,   6 },
+    {  9, 0,  -4,   6 },
+    {  9, 0,  -4,  -6 },
+    {  9, 0,  -4,  -6 },
+    { 10, 0,   6,   5 },
+    { 10, 0,   6,  -5 },
+    { 10, 0,  -6,   5 },
+    { 10, 0,  -6,  -5 },
+    { 10, 0,   7,   2 },
+    { 10, 0,   7,  -2 },
+    { 10, 0,  -7,   2 },
+    { 10, 0,  -7,  -2 },
+    { 10, 0,   3,   7 },
+    { 10, 0,   3,  -7 },
+    { 10, 0,  -3,   7 },
+    { 10, 0,  -3,  -7 },
+    { 10, 0,   2,   7 },
+    { 10, 0,   2,  -7 },
+    { 10, 0,  -2,   7 },
+    { 10, 0,  -2,  -7 },
+    { 10, 0,   5,   6 },
+    { 10, 0,   5,  -6 },
+    { 10, 0,  -5,   6 },
+    { 10, 0,  -5,  -6 },
+    { 10, 0,   8,   2 },
+    { 10, 0,   8,  -2 },
+    { 10, 0,  -8,   2 },
+    { 10, 0,  -8,  -2 },
+    { 10, 0,   7,   3 },
+    { 10, 0,   7,  -3 },
+    { 10, 0,  -7,   3 },
+    { 10, 0,  -7,  -3 },
+    {  9, 0,   5,   0 },
+    {  9, 0,   5,   0 },
+    {  9, 0,  -5,   0 },
+    {  9, 0,  -5,   0 },
+    { 10, 0,   7,   1 },
+    { 10, 0,   7,  -1 },
+    { 10, 0,  -7,   1 },
+    { 10, 0,  -7,  -1 },
+    {  9, 0,   0,   5 },
+    {  9, 0,   0,   5 },
+    {  9, 0,   0,  -5 },
+    {  9, 0,   0,  -5 },
+    { 10, 0,   8,   1 },
+    { 10, 0,   8,  -1 },
+    { 10, 0,  -8,   1 },
+    { 10, 0,  -8,  -1 },
+    { 10, 0,   1,   7 },
+    { 10, 0,   1,  -7 },
+    { 10, 0,  -1,   7 },
+    { 10, 0,  -1,  -7 },
+    { 10, 0,   8,   3 },
+    { 10, 0,   8,  -3 },
+    { 10, 0,  -8,   3 },
+    { 10, 0,  -8,  -3 },
+    { 10, 0,   7,   4 },
+    { 10, 0,   7,  -4 },
+    { 10, 0,  -7,   4 },
+    { 10, 0,  -7,  -4 },
+    { 10, 0,   4,   7 },
+    { 10, 0,   4,  -7 },
+    { 10, 0,  -4,   7 },
+    { 10, 0,  -4,  -7 },
+    { 10, 0,   2,   8 },
+    { 10, 0,   2,  -8 },
+    { 10, 0,  -2,   8 },
+    { 10, 0,  -2,  -8 },
+    { 10, 0,   6,   6 },
+    { 10, 0,   6,  -6 },
+    { 10, 0,  -6,   6 },
+    { 10, 0,  -6,  -6 },
+    { 10, 0,   7,   5 },
+    { 10, 0,   7,  -5 },
+    { 10, 0,  -7,   5 },
+    { 10, 0,  -7,  -5 },
+    { 10, 0,   1,   8 },
+    { 10, 0,   1,  -8 },
+    { 10, 0,  -1,   8 },
+    { 10, 0,  -1,  -8 },
+    { 10, 0,   3,   8 },
+    { 10, 0,   3,  -8 },
+    { 10, 0,  -3,   8 },
+    { 10, 0,  -3,  -8 },
+    { 10, 0,   8,   4 },
+    { 10, 0,   8,  -4 },
+    { 10, 0,  -8,   4 },
+    { 10, 0,  -8,  -4 },
+    { 10, 0,   4,   8 },
+    { 10, 0,   4,  -8 },
+    { 10, 0,  -4,   8 },
+    { 10, 0,  -4,  -8 },
+    { 10, 0,   5,   7 },
+    { 10, 0,   5,  -7 },
+    { 10, 0,  -5,   7 },
+    { 10, 0,  -5,  -7 },
+    { 10, 0,   8,   5 },
+    { 10, 0,   8,  -5 },
+    { 10, 0,  -8,   5 },
+    { 10, 0,  -8,  -5 },
+    { 10, 0,   5,   8 },
+    { 10, 0,   5,  -8 },
+    { 10, 0,  -5,   8 },
+    { 10, 0,  -5,  -8 },
+    {  9, 1,   7,   6 },
+    {  9, 1,   7,   6 },
+    {  9, 1,   6,   7 },
+    {  9, 1,   6,   7 },
+    {  9, 1,   9,   2 },
+    {  9, 1,   9,   2 },
+    { 10, 0,   6,   0 },
+    { 10, 0,  -6,   0 },
+    {  9, 1,   6,   8 },
+    {  9, 1,   6,   8 },
+    {  9, 1,   9,   3 },
+    {  9, 1,   9,   3 },
+    {  9, 1,   3,   9 },
+    {  9, 1,   3,   9 },
+    {  9, 1,   9,   1 },
+    {  9, 1,   9,   1 },
+    {  9, 1,   2,   9 },
+    {  9, 1,   2,   9 },
+    { 10, 0,   0,   6 },
+    { 10, 0,   0,  -6 },
+    {  9, 1,   8,   6 },
+    {  9, 1,   8,   6 },
+    {  9, 1,   9,   4 },
+    {  9, 1,   9,   4 },
+    {  9, 1,   4,   9 },
+    {  9, 1,   4,   9 },
+    {  9, 1,  10,   2 },
+    {  9, 1,  10,   2 },
+    {  9, 1,   1,   9 },
+    {  9, 1,   1,   9 },
+    {  9, 1,   7,   7 },
+    {  9, 1,   7,   7 },
+    {  9, 1,   8,   7 },
+    {  9, 1,   8,   7 },
+    {  9, 1,   9,   5 },
+    {  9, 1,   9,   5 },
+    {  9, 1,   7,   8 },
+    {  9, 1,   7,   8 },
+    {  9, 1,  10,   3 },
+    {  9, 1,  10,   3 },
+    {  9, 1,   5,   9 },
+    {  9, 1,   5,   9 },
+    {  9, 1,  10,   4 },
+    {  9, 1,  10,   4 },
+    {  9, 1,   2,  10 },
+    {  9, 1,   2,  10 },
+    {  9, 1,  10,   1 },
+    {  9, 1,  10,   1 },
+    {  9, 1,   3,  10 },
+    {  9, 1,   3,  10 },
+    {  9, 1,   9,   6 },
+    {  9, 1,   9,   6 },
+    {  9, 1,   6,   9 },
+    {  9, 1,   6,   9 },
+    { 10, 0,   8,   0 },
+    { 10, 0,  -8,   0 },
+    {  9, 1,   4,  10 },
+    {  9, 1,   4,  10 },
+    { 10, 0,   7,   0 },
+    { 10, 0,  -7,   0 },
+    {  9, 1,  11,   2 },
+    {  9, 1,  11,   2 },
+    { 10, 1,   7,   9 },
+    { 10, 1,  11,   3 },
+    { 10, 1,  10,   6 },
+    { 10, 1,   1,  10 },
+    { 10, 1,  11,   1 },
+    { 10, 1,   9,   7 },
+    { 10, 1,   0,   7 },
+    { 10, 1,   8,   8 },
+    { 10, 1,  10,   5 },
+    { 10, 1,   3,  11 },
+    { 10, 1,   5,  10 },
+    { 10, 1,   8,   9 },
+    { 10, 1,  11,   5 },
+    { 10, 1,   0,   8 },
+    { 10, 1,  11,   4 },
+    { 10, 1,   2,  11 },
+    { 10, 1,   7,  10 },
+    { 10, 1,   6,  10 },
+    { 10, 1,  10,   7 },
+    { 10, 1,   4,  11 },
+    { 10, 1,   1,  11 },
+    { 10, 1,  12,   2 },
+    { 10, 1,   9,   8 },
+    { 10, 1,  12,   3 },
+    { 10, 1,  11,   6 },
+    { 10, 1,   5,  11 },
+    { 10, 1,  12,   4 },
+    { 10, 1,  11,   7 },
+    { 10, 1,  12,   5 },
+    { 10, 1,   3,  12 },
+    { 10, 1,   6,  11 },
+    { 10, 1,   9,   0 },
+    { 10, 1,  10,   8 },
+    { 10, 1,  10,   0 },
+    { 10, 1,  12,   1 },
+    { 10, 1,   0,   9 },
+    { 10, 1,   4,  12 },
+    { 10, 1,   9,   9 },
+    { 10, 1,  12,   6 },
+    { 10, 1,   2,  12 },
+    { 10, 1,   8,  10 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 }
+};
+
+static const hcb_lut_pair hcb11_lut[1024] = {
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  4, 0,   0,   0 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,   1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,   1,  -1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,   1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  6, 0,  -1,  -1 },
+    {  7, 0,  16,  16 },
+    {  7, 0,  16,  16 },
+    {  7, 0,  16,  16 },
+    {  7, 0,  16,  16 },
+    {  7, 0,  16,  16 },
+    {  7, 0,  16,  16 },
+    {  7, 0,  16,  16 },
+    {  7, 0,  16,  16 },
+    {  7, 0,  16, -16 },
+    {  7, 0,  16, -16 },
+    {  7, 0,  16, -16 },
+    {  7, 0,  16, -16 },
+    {  7, 0,  16, -16 },
+    {  7, 0,  16, -16 },
+    {  7, 0,  16, -16 },
+    {  7, 0,  16, -16 },
+    {  7, 0, -16,  16 },
+    {  7, 0, -16,  16 },
+    {  7, 0, -16,  16 },
+    {  7, 0, -16,  16 },
+    {  7, 0, -16,  16 },
+    {  7, 0, -16,  16 },
+    {  7, 0, -16,  16 },
+    {  7, 0, -16,  16 },
+    {  7, 0, -16, -16 },
+    {  7, 0, -16, -16 },
+    {  7, 0, -16, -16 },
+    {  7, 0, -16, -16 },
+    {  7, 0, -16, -16 },
+    {  7, 0, -16, -16 },
+    {  7, 0, -16, -16 },
+    {  7, 0, -16, -16 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,   1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,  -1,   0 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,   1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  6, 0,   0,  -1 },
+    {  7, 0,   2,   1 },
+    {  7, 0,   2,   1 },
+    {  7, 0,   2,   1 },
+    {  7, 0,   2,   1 },
+    {  7, 0,   2,   1 },
+    {  7, 0,   2,   1 },
+    {  7, 0,   2,   1 },
+    {  7, 0,   2,   1 },
+    {  7, 0,   2,  -1 },
+    {  7, 0,   2,  -1 },
+    {  7, 0,   2,  -1 },
+    {  7, 0,   2,  -1 },
+    {  7, 0,   2,  -1 },
+    {  7, 0,   2,  -1 },
+    {  7, 0,   2,  -1 },
+    {  7, 0,   2,  -1 },
+    {  7, 0,  -2,   1 },
+    {  7, 0,  -2,   1 },
+    {  7, 0,  -2,   1 },
+    {  7, 0,  -2,   1 },
+    {  7, 0,  -2,   1 },
+    {  7, 0,  -2,   1 },
+    {  7, 0,  -2,   1 },
+    {  7, 0,  -2,   1 },
+    {  7, 0,  -2,  -1 },
+    {  7, 0,  -2,  -1 },
+    {  7, 0,  -2,  -1 },
+    {  7, 0,  -2,  -1 },
+    {  7, 0,  -2,  -1 },
+    {  7, 0,  -2,  -1 },
+    {  7, 0,  -2,  -1 },
+    {  7, 0,  -2,  -1 },
+    {  7, 0,   1,   2 },
+    {  7, 0,   1,   2 },
+    {  7, 0,   1,   2 },
+    {  7, 0,   1,   2 },
+    {  7, 0,   1,   2 },
+    {  7, 0,   1,   2 },
+    {  7, 0,   1,   2 },
+    {  7, 0,   1,   2 },
+    {  7, 0,   1,  -2 },
+    {  7, 0,   1,  -2 },
+    {  7, 0,   1,  -2 },
+    {  7, 0,   1,  -2 },
+    {  7, 0,   1,  -2 },
+    {  7, 0,   1,  -2 },
+    {  7, 0,   1,  -2 },
+    {  7, 0,   1,  -2 },
+    {  7, 0,  -1,   2 },
+    {  7, 0,  -1,   2 },
+    {  7, 0,  -1,   2 },
+    {  7, 0,  -1,   2 },
+    {  7, 0,  -1,   2 },
+    {  7, 0,  -1,   2 },
+    {  7, 0,  -1,   2 },
+    {  7, 0,  -1,   2 },
+    {  7, 0,  -1,  -2 },
+    {  7, 0,  -1,  -2 },
+    {  7, 0,  -1,  -2 },
+    {  7, 0,  -1,  -2 },
+    {  7, 0,  -1,  -2 },
+    {  7, 0,  -1,  -2 },
+    {  7, 0,  -1,  -2 },
+    {  7, 0,  -1,  -2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,   2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,   2,  -2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,   2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  7, 0,  -2,  -2 },
+    {  8, 0,   1,   3 },
+    {  8, 0,   1,   3 },
+    {  8, 0,   1,   3 },
+    {  8, 0,   1,   3 },
+    {  8, 0,   1,  -3 },
+    {  8, 0,   1,  -3 },
+    {  8, 0,   1,  -3 },
+    {  8, 0,   1,  -3 },
+    {  8, 0,  -1,   3 },
+    {  8, 0,  -1,   3 },
+    {  8, 0,  -1,   3 },
+    {  8, 0,  -1,   3 },
+    {  8, 0,  -1,  -3 },
+    {  8, 0,  -1,  -3 },
+    {  8, 0,  -1,  -3 },
+    {  8, 0,  -1,  -3 },
+    {  8, 0,   3,   1 },
+    {  8, 0,   3,   1 },
+    {  8, 0,   3,   1 },
+    {  8, 0,   3,   1 },
+    {  8, 0,   3,  -1 },
+    {  8, 0,   3,  -1 },
+    {  8, 0,   3,  -1 },
+    {  8, 0,   3,  -1 },
+    {  8, 0,  -3,   1 },
+    {  8, 0,  -3,   1 },
+    {  8, 0,  -3,   1 },
+    {  8, 0,  -3,   1 },
+    {  8, 0,  -3,  -1 },
+    {  8, 0,  -3,  -1 },
+    {  8, 0,  -3,  -1 },
+    {  8, 0,  -3,  -1 },
+    {  8, 0,   3,   2 },
+    {  8, 0,   3,   2 },
+    {  8, 0,   3,   2 },
+    {  8, 0,   3,   2 },
+    {  8, 0,   3,  -2 },
+    {  8, 0,   3,  -2 },
+    {  8, 0,   3,  -2 },
+    {  8, 0,   3,  -2 },
+    {  8, 0,  -3,   2 },
+    {  8, 0,  -3,   2 },
+    {  8, 0,  -3,   2 },
+    {  8, 0,  -3,   2 },
+    {  8, 0,  -3,  -2 },
+    {  8, 0,  -3,  -2 },
+    {  8, 0,  -3,  -2 },
+    {  8, 0,  -3,  -2 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,   2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  7, 0,  -2,   0 },
+    {  8, 0,   2,   3 },
+    {  8, 0,   2,   3 },
+    {  8, 0,   2,   3 },
+    {  8, 0,   2,   3 },
+    {  8, 0,   2,  -3 },
+    {  8, 0,   2,  -3 },
+    {  8, 0,   2,  -3 },
+    {  8, 0,   2,  -3 },
+    {  8, 0,  -2,   3 },
+    {  8, 0,  -2,   3 },
+    {  8, 0,  -2,   3 },
+    {  8, 0,  -2,   3 },
+    {  8, 0,  -2,  -3 },
+    {  8, 0,  -2,  -3 },
+    {  8, 0,  -2,  -3 },
+    {  8, 0,  -2,  -3 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,   2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  7, 0,   0,  -2 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,   3 },
+    {  8, 0,   3,  -3 },
+    {  8, 0,   3,  -3 },
+    {  8, 0,   3,  -3 },
+    {  8, 0,   3,  -3 },
+    {  8, 0,  -3,   3 },
+    {  8, 0,  -3,   3 },
+    {  8, 0,  -3,   3 },
+    {  8, 0,  -3,   3 },
+    {  8, 0,  -3,  -3 },
+    {  8, 0,  -3,  -3 },
+    {  8, 0,  -3,  -3 },
+    {  8, 0,  -3,  -3 },
+    {  9, 0,   4,   1 },
+    {  9, 0,   4,   1 },
+    {  9, 0,   4,  -1 },
+    {  9, 0,   4,  -1 },
+    {  9, 0,  -4,   1 },
+    {  9, 0,  -4,   1 },
+    {  9, 0,  -4,  -1 },
+    {  9, 0,  -4,  -1 },
+    {  9, 0,   1,   4 },
+    {  9, 0,   1,   4 },
+    {  9, 0,   1,  -4 },
+    {  9, 0,   1,  -4 },
+    {  9, 0,  -1,   4 },
+    {  9, 0,  -1,   4 },
+    {  9, 0,  -1,  -4 },
+    {  9, 0,  -1,  -4 },
+    {  9, 0,   4,   2 },
+    {  9, 0,   4,   2 },
+    {  9, 0,   4,  -2 },
+    {  9, 0,   4,  -2 },
+    {  9, 0,  -4,   2 },
+    {  9, 0,  -4,   2 },
+    {  9, 0,  -4,  -2 },
+    {  9, 0,  -4,  -2 },
+    {  9, 0,   2,   4 },
+    {  9, 0,   2,   4 },
+    {  9, 0,   2,  -4 },
+    {  9, 0,   2,  -4 },
+    {  9, 0,  -2,   4 },
+    {  9, 0,  -2,   4 },
+    {  9, 0,  -2,  -4 },
+    {  9, 0,  -2,  -4 },
+    {  9, 0,   4,   3 },
+    {  9, 0,   4,   3 },
+    {  9, 0,   4,  -3 },
+    {  9, 0,   4,  -3 },
+    {  9, 0,  -4,   3 },
+    {  9, 0,  -4,   3 },
+    {  9, 0,  -4,  -3 },
+    {  9, 0,  -4,  -3 },
+    {  9, 0,   3,   4 },
+    {  9, 0,   3,   4 },
+    {  9, 0,   3,  -4 },
+    {  9, 0,   3,  -4 },
+    {  9, 0,  -3,   4 },
+    {  9, 0,  -3,   4 },
+    {  9, 0,  -3,  -4 },
+    {  9, 0,  -3,  -4 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,   3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,  -3,   0 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,   3 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,  -3 },
+    {  8, 0,   0,  -3 },
+    {  9, 0,   5,   1 },
+    {  9, 0,   5,   1 },
+    {  9, 0,   5,  -1 },
+    {  9, 0,   5,  -1 },
+    {  9, 0,  -5,   1 },
+    {  9, 0,  -5,   1 },
+    {  9, 0,  -5,  -1 },
+    {  9, 0,  -5,  -1 },
+    {  9, 0,   5,   2 },
+    {  9, 0,   5,   2 },
+    {  9, 0,   5,  -2 },
+    {  9, 0,   5,  -2 },
+    {  9, 0,  -5,   2 },
+    {  9, 0,  -5,   2 },
+    {  9, 0,  -5,  -2 },
+    {  9, 0,  -5,  -2 },
+    {  9, 0,   2,   5 },
+    {  9, 0,   2,   5 },
+    {  9, 0,   2,  -5 },
+    {  9, 0,   2,  -5 },
+    {  9, 0,  -2,   5 },
+    {  9, 0,  -2,   5 },
+    {  9, 0,  -2,  -5 },
+    {  9, 0,  -2,  -5 },
+    {  9, 0,   4,   4 },
+    {  9, 0,   4,   4 },
+    {  9, 0,   4,  -4 },
+    {  9, 0,   4,  -4 },
+    {  9, 0,  -4,   4 },
+    {  9, 0,  -4,   4 },
+    {  9, 0,  -4,  -4 },
+    {  9, 0,  -4,  -4 },
+    {  9, 0,   1,   5 },
+    {  9, 0,   1,   5 },
+    {  9, 0,   1,  -5 },
+    {  9, 0,   1,  -5 },
+    {  9, 0,  -1,   5 },
+    {  9, 0,  -1,   5 },
+    {  9, 0,  -1,  -5 },
+    {  9, 0,  -1,  -5 },
+    {  9, 0,   5,   3 },
+    {  9, 0,   5,   3 },
+    {  9, 0,   5,  -3 },
+    {  9, 0,   5,  -3 },
+    {  9, 0,  -5,   3 },
+    {  9, 0,  -5,   3 },
+    {  9, 0,  -5,  -3 },
+    {  9, 0,  -5,  -3 },
+    {  9, 0,   3,   5 },
+    {  9, 0,   3,   5 },
+    {  9, 0,   3,  -5 },
+    {  9, 0,   3,  -5 },
+    {  9, 0,  -3,   5 },
+    {  9, 0,  -3,   5 },
+    {  9, 0,  -3,  -5 },
+    {  9, 0,  -3,  -5 },
+    {  9, 0,   5,   4 },
+    {  9, 0,   5,   4 },
+    {  9, 0,   5,  -4 },
+    {  9, 0,   5,  -4 },
+    {  9, 0,  -5,   4 },
+    {  9, 0,  -5,   4 },
+    {  9, 0,  -5,  -4 },
+    {  9, 0,  -5,  -4 },
+    { 10, 0,   4,   5 },
+    { 10, 0,   4,  -5 },
+    { 10, 0,  -4,   5 },
+    { 10, 0,  -4,  -5 },
+    { 10, 0,   6,   2 },
+    { 10, 0,   6,  -2 },
+    { 10, 0,  -6,   2 },
+    { 10, 0,  -6,  -2 },
+    { 10, 0,   2,   6 },
+    { 10, 0,   2,  -6 },
+    { 10, 0,  -2,   6 },
+    { 10, 0,  -2,  -6 },
+    { 10, 0,   6,   1 },
+    { 10, 0,   6,  -1 },
+    { 10, 0,  -6,   1 },
+    { 10, 0,  -6,  -1 },
+    { 10, 0,   6,   3 },
+    { 10, 0,   6,  -3 },
+    { 10, 0,  -6,   3 },
+    { 10, 0,  -6,  -3 },
+    { 10, 0,   3,   6 },
+    { 10, 0,   3,  -6 },
+    { 10, 0,  -3,   6 },
+    { 10, 0,  -3,  -6 },
+    { 10, 0,   1,   6 },
+    { 10, 0,   1,  -6 },
+    { 10, 0,  -1,   6 },
+    { 10, 0,  -1,  -6 },
+    { 10, 0,   4,  16 },
+    { 10, 0,   4, -16 },
+    { 10, 0,  -4,  16 },
+    { 10, 0,  -4, -16 },
+    { 10, 0,   3,  16 },
+    { 10, 0,   3, -16 },
+    { 10, 0,  -3,  16 },
+    { 10, 0,  -3, -16 },
+    { 10, 0,  16,   5 },
+    { 10, 0,  16,  -5 },
+    { 10, 0, -16,   5 },
+    { 10, 0, -16,  -5 },
+    { 10, 0,  16,   3 },
+    { 10, 0,  16,  -3 },
+    { 10, 0, -16,   3 },
+    { 10, 0, -16,  -3 },
+    { 10, 0,  16,   4 },
+    { 10, 0,  16,  -4 },
+    { 10, 0, -16,   4 },
+    { 10, 0, -16,  -4 },
+    { 10, 0,   6,   4 },
+    { 10, 0,   6,  -4 },
+    { 10, 0,  -6,   4 },
+    { 10, 0,  -6,  -4 },
+    { 10, 0,  16,   6 },
+    { 10, 0,  16,  -6 },
+    { 10, 0, -16,   6 },
+    { 10, 0, -16,  -6 },
+    {  9, 0,   4,   0 },
+    {  9, 0,   4,   0 },
+    {  9, 0,  -4,   0 },
+    {  9, 0,  -4,   0 },
+    { 10, 0,   4,   6 },
+    { 10, 0,   4,  -6 },
+    { 10, 0,  -4,   6 },
+    { 10, 0,  -4,  -6 },
+    {  9, 0,   0,   4 },
+    {  9, 0,   0,   4 },
+    {  9, 0,   0,  -4 },
+    {  9, 0,   0,  -4 },
+    { 10, 0,   2,  16 },
+    { 10, 0,   2, -16 },
+    { 10, 0,  -2,  16 },
+    { 10, 0,  -2, -16 },
+    { 10, 0,   5,   5 },
+    { 10, 0,   5,  -5 },
+    { 10, 0,  -5,   5 },
+    { 10, 0,  -5,  -5 },
+    { 10, 0,   5,  16 },
+    { 10, 0,   5, -16 },
+    { 10, 0,  -5,  16 },
+    { 10, 0,  -5, -16 },
+    { 10, 0,  16,   7 },
+    { 10, 0,  16,  -7 },
+    { 10, 0, -16,   7 },
+    { 10, 0, -16,  -7 },
+    { 10, 0,  16,   2 },
+    { 10, 0,  16,  -2 },
+    { 10, 0, -16,   2 },
+    { 10, 0, -16,  -2 },
+    { 10, 0,  16,   8 },
+    { 10, 0,  16,  -8 },
+    { 10, 0, -16,   8 },
+    { 10, 0, -16,  -8 },
+    { 10, 0,   2,   7 },
+    { 10, 0,   2,  -7 },
+    { 10, 0,  -2,   7 },
+    { 10, 0,  -2,  -7 },
+    { 10, 0,   7,   2 },
+    { 10, 0,   7,  -2 },
+    { 10, 0,  -7,   2 },
+    { 10, 0,  -7,  -2 },
+    { 10, 0,   3,   7 },
+    { 10, 0,   3,  -7 },
+    { 10, 0,  -3,   7 },
+    { 10, 0,  -3,  -7 },
+    { 10, 0,   6,   5 },
+    { 10, 0,   6,  -5 },
+    { 10, 0,  -6,   5 },
+    { 10, 0,  -6,  -5 },
+    { 10, 0,   5,   6 },
+    { 10, 0,   5,  -6 },
+    { 10, 0,  -5,   6 },
+    { 10, 0,  -5,  -6 },
+    { 10, 0,   6,  16 },
+    { 10, 0,   6, -16 },
+    { 10, 0,  -6,  16 },
+    { 10, 0,  -6, -16 },
+    { 10, 0,  16,  10 },
+    { 10, 0,  16, -10 },
+    { 10, 0, -16,  10 },
+    { 10, 0, -16, -10 },
+    { 10, 0,   7,   3 },
+    { 10, 0,   7,  -3 },
+    { 10, 0,  -7,   3 },
+    { 10, 0,  -7,  -3 },
+    { 10, 0,   7,   1 },
+    { 10, 0,   7,  -1 },
+    { 10, 0,  -7,   1 },
+    { 10, 0,  -7,  -1 },
+    { 10, 0,  16,   9 },
+    { 10, 0,  16,  -9 },
+    { 10, 0, -16,   9 },
+    { 10, 0, -16,  -9 },
+    { 10, 0,   7,  16 },
+    { 10, 0,   7, -16 },
+    { 10, 0,  -7,  16 },
+    { 10, 0,  -7, -16 },
+    { 10, 0,   1,  16 },
+    { 10, 0,   1, -16 },
+    { 10, 0,  -1,  16 },
+    { 10, 0,  -1, -16 },
+    { 10, 0,   1,   7 },
+    { 10, 0,   1,  -7 },
+    { 10, 0,  -1,   7 },
+    { 10, 0,  -1,  -7 },
+    { 10, 0,   4,   7 },
+    { 10, 0,   4,  -7 },
+    { 10, 0,  -4,   7 },
+    { 10, 0,  -4,  -7 },
+    { 10, 0,  16,  11 },
+    { 10, 0,  16, -11 },
+    { 10, 0, -16,  11 },
+    { 10, 0, -16, -11 },
+    { 10, 0,   7,   4 },
+    { 10, 0,   7,  -4 },
+    { 10, 0,  -7,   4 },
+    { 10, 0,  -7,  -4 },
+    { 10, 0,  16,  12 },
+    { 10, 0,  16, -12 },
+    { 10, 0, -16,  12 },
+    { 10, 0, -16, -12 },
+    { 10, 0,   8,  16 },
+    { 10, 0,   8, -16 },
+    { 10, 0,  -8,  16 },
+    { 10, 0,  -8, -16 },
+    { 10, 0,  16,   1 },
+    { 10, 0,  16,  -1 },
+    { 10, 0, -16,   1 },
+    { 10, 0, -16,  -1 },
+    { 10, 0,   6,   6 },
+    { 10, 0,   6,  -6 },
+    { 10, 0,  -6,   6 },
+    { 10, 0,  -6,  -6 },
+    { 10, 0,   9,  16 },
+    { 10, 0,   9, -16 },
+    { 10, 0,  -9,  16 },
+    { 10, 0,  -9, -16 },
+    { 10, 0,   2,   8 },
+    { 10, 0,   2,  -8 },
+    { 10, 0,  -2,   8 },
+    { 10, 0,  -2,  -8 },
+    { 10, 0,   5,   7 },
+    { 10, 0,   5,  -7 },
+    { 10, 0,  -5,   7 },
+    { 10, 0,  -5,  -7 },
+    { 10, 0,  10,  16 },
+    { 10, 0,  10, -16 },
+    { 10, 0, -10,  16 },
+    { 10, 0, -10, -16 },
+    { 10, 0,  16,  13 },
+    { 10, 0,  16, -13 },
+    { 10, 0, -16,  13 },
+    { 10, 0, -16, -13 },
+    { 10, 0,   8,   3 },
+    { 10, 0,   8,  -3 },
+    { 10, 0,  -8,   3 },
+    { 10, 0,  -8,  -3 },
+    { 10, 0,   8,   2 },
+    { 10, 0,   8,  -2 },
+    { 10, 0,  -8,   2 },
+    { 10, 0,  -8,  -2 },
+    { 10, 0,   3,   8 },
+    { 10, 0,   3,  -8 },
+    { 10, 0,  -3,   8 },
+    { 10, 0,  -3,  -8 },
+    {  9, 0,   5,   0 },
+    {  9, 0,   5,   0 },
+    {  9, 0,  -5,   0 },
+    {  9, 0,  -5,   0 },
+    { 10, 0,  16,  14 },
+    { 10, 0,  16, -14 },
+    { 10, 0, -16,  14 },
+    { 10, 0, -16, -14 },
+    { 10, 0,  11,  16 },
+    { 10, 0,  11, -16 },
+    { 10, 0, -11,  16 },
+    { 10, 0, -11, -16 },
+    { 10, 0,   7,   5 },
+    { 10, 0,   7,  -5 },
+    { 10, 0,  -7,   5 },
+    { 10, 0,  -7,  -5 },
+    { 10, 0,   4,   8 },
+    { 10, 0,   4,  -8 },
+    { 10, 0,  -4,   8 },
+    { 10, 0,  -4,  -8 },
+    { 10, 0,   6,   7 },
+    { 10, 0,   6,  -7 },
+    { 10, 0,  -6,   7 },
+    { 10, 0,  -6,  -7 },
+    { 10, 0,   7,   6 },
+    { 10, 0,   7,  -6 },
+    { 10, 0,  -7,   6 },
+    { 10, 0,  -7,  -6 },
+    {  9, 0,   0,   5 },
+    {  9, 0,   0,   5 },
+    {  9, 0,   0,  -5 },
+    {  9, 0,   0,  -5 },
+    {  9, 1,   8,   4 },
+    {  9, 1,   8,   4 },
+    {  9, 1,  16,  15 },
+    {  9, 1,  16,  15 },
+    {  9, 1,  12,  16 },
+    {  9, 1,  12,  16 },
+    {  9, 1,   1,   8 },
+    {  9, 1,   1,   8 },
+    {  9, 1,   8,   1 },
+    {  9, 1,   8,   1 },
+    {  9, 1,  14,  16 },
+    {  9, 1,  14,  16 },
+    {  9, 1,   5,   8 },
+    {  9, 1,   5,   8 },
+    {  9, 1,  13,  16 },
+    {  9, 1,  13,  16 },
+    {  9, 1,   3,   9 },
+    {  9, 1,   3,   9 },
+    {  9, 1,   8,   5 },
+    {  9, 1,   8,   5 },
+    {  9, 1,   7,   7 },
+    {  9, 1,   7,   7 },
+    {  9, 1,   2,   9 },
+    {  9, 1,   2,   9 },
+    {  9, 1,   8,   6 },
+    {  9, 1,   8,   6 },
+    {  9, 1,   9,   2 },
+    {  9, 1,   9,   2 },
+    {  9, 1,   9,   3 },
+    {  9, 1,   9,   3 },
+    {  9, 1,  15,  16 },
+    {  9, 1,  15,  16 },
+    {  9, 1,   4,   9 },
+    {  9, 1,   4,   9 },
+    {  9, 1,   6,   8 },
+    {  9, 1,   6,   8 },
+    { 10, 0,   6,   0 },
+    { 10, 0,  -6,   0 },
+    {  9, 1,   9,   4 },
+    {  9, 1,   9,   4 },
+    {  9, 1,   5,   9 },
+    {  9, 1,   5,   9 },
+    {  9, 1,   8,   7 },
+    {  9, 1,   8,   7 },
+    {  9, 1,   7,   8 },
+    {  9, 1,   7,   8 },
+    {  9, 1,   1,   9 },
+    {  9, 1,   1,   9 },
+    {  9, 1,  10,   3 },
+    {  9, 1,  10,   3 },
+    { 10, 0,   0,   6 },
+    { 10, 0,   0,  -6 },
+    {  9, 1,  10,   2 },
+    {  9, 1,  10,   2 },
+    {  9, 1,   9,   1 },
+    {  9, 1,   9,   1 },
+    {  9, 1,   9,   5 },
+    {  9, 1,   9,   5 },
+    {  9, 1,   4,  10 },
+    {  9, 1,   4,  10 },
+    {  9, 1,   2,  10 },
+    {  9, 1,   2,  10 },
+    {  9, 1,   9,   6 },
+    {  9, 1,   9,   6 },
+    {  9, 1,   3,  10 },
+    {  9, 1,   3,  10 },
+    {  9, 1,   6,   9 },
+    {  9, 1,   6,   9 },
+    {  9, 1,  10,   4 },
+    {  9, 1,  10,   4 },
+    {  9, 1,   8,   8 },
+    {  9, 1,   8,   8 },
+    {  9, 1,  10,   5 },
+    {  9, 1,  10,   5 },
+    {  9, 1,   9,   7 },
+    {  9, 1,   9,   7 },
+    {  9, 1,  11,   3 },
+    {  9, 1,  11,   3 },
+    {  9, 1,   1,  10 },
+    {  9, 1,   1,  10 },
+    { 10, 0,   7,   0 },
+    { 10, 0,  -7,   0 },
+    {  9, 1,  10,   6 },
+    {  9, 1,  10,   6 },
+    {  9, 1,   7,   9 },
+    {  9, 1,   7,   9 },
+    {  9, 1,   3,  11 },
+    {  9, 1,   3,  11 },
+    {  9, 1,   5,  10 },
+    {  9, 1,   5,  10 },
+    {  9, 1,  10,   1 },
+    {  9, 1,  10,   1 },
+    {  9, 1,   4,  11 },
+    {  9, 1,   4,  11 },
+    {  9, 1,  11,   2 },
+    {  9, 1,  11,   2 },
+    {  9, 1,  13,   2 },
+    {  9, 1,  13,   2 },
+    {  9, 1,   6,  10 },
+    {  9, 1,   6,  10 },
+    {  9, 1,  13,   3 },
+    {  9, 1,  13,   3 },
+    {  9, 1,   2,  11 },
+    {  9, 1,   2,  11 },
+    { 10, 0,  16,   0 },
+    { 10, 0, -16,   0 },
+    {  9, 1,   5,  11 },
+    {  9, 1,   5,  11 },
+    {  9, 1,  11,   5 },
+    {  9, 1,  11,   5 },
+    { 10, 1,  11,   4 },
+    { 10, 1,   9,   8 },
+    { 10, 1,   7,  10 },
+    { 10, 1,   8,   9 },
+    { 10, 1,   0,  16 },
+    { 10, 1,   4,  13 },
+    { 10, 1,   0,   7 },
+    { 10, 1,   3,  13 },
+    { 10, 1,  11,   6 },
+    { 10, 1,  13,   1 },
+    { 10, 1,  13,   4 },
+    { 10, 1,  12,   3 },
+    { 10, 1,   2,  13 },
+    { 10, 1,  13,   5 },
+    { 10, 1,   8,  10 },
+    { 10, 1,   6,  11 },
+    { 10, 1,  10,   8 },
+    { 10, 1,  10,   7 },
+    { 10, 1,  14,   2 },
+    { 10, 1,  12,   4 },
+    { 10, 1,   1,  11 },
+    { 10, 1,   4,  12 },
+    { 10, 1,  11,   1 },
+    { 10, 1,   3,  12 },
+    { 10, 1,   1,  13 },
+    { 10, 1,  12,   2 },
+    { 10, 1,   7,  11 },
+    { 10, 1,   3,  14 },
+    { 10, 1,   5,  12 },
+    { 10, 1,   5,  13 },
+    { 10, 1,  14,   4 },
+    { 10, 1,   4,  14 },
+    { 10, 1,  11,   7 },
+    { 10, 1,  14,   3 },
+    { 10, 1,  12,   5 },
+    { 10, 1,  13,   6 },
+    { 10, 1,  12,   6 },
+    { 10, 1,   8,   0 },
+    { 10, 1,  11,   8 },
+    { 10, 1,   2,  12 },
+    { 10, 1,   9,   9 },
+    { 10, 1,  14,   5 },
+    { 10, 1,   6,  13 },
+    { 10, 1,  10,  10 },
+    { 10, 1,  15,   2 },
+    { 10, 1,   8,  11 },
+    { 10, 1,   9,  10 },
+    { 10, 1,  14,   6 },
+    { 10, 1,  10,   9 },
+    { 10, 1,   5,  14 },
+    { 10, 1,  11,   9 },
+    { 10, 1,  14,   1 },
+    { 10, 1,   2,  14 },
+    { 10, 1,   6,  12 },
+    { 10, 1,   1,  12 },
+    { 10, 1,  13,   8 },
+    { 10, 1,   0,   8 },
+    { 10, 1,  13,   7 },
+    { 10, 1,   7,  12 },
+    { 10, 1,  12,   7 },
+    { 10, 1,   7,  13 },
+    { 10, 1,  15,   3 },
+    { 10, 1,  12,   1 },
+    { 10, 1,   6,  14 },
+    { 10, 1,   2,  15 },
+    { 10, 1,  15,   5 },
+    { 10, 1,  15,   4 },
+    { 10, 1,   1,  14 },
+    { 10, 1,   9,  11 },
+    { 10, 1,   4,  15 },
+    { 10, 1,  14,   7 },
+    { 10, 1,   8,  13 },
+    { 10, 1,  13,   9 },
+    { 10, 1,   8,  12 },
+    { 10, 1,   5,  15 },
+    { 10, 1,   3,  15 },
+    { 10, 1,  10,  11 },
+    { 10, 1,  11,  10 },
+    { 10, 1,  12,   8 },
+    { 10, 1,  15,   6 },
+    { 10, 1,  15,   7 },
+    { 10, 1,   8,  14 },
+    { 10, 1,  15,   1 },
+    { 10, 1,   7,  14 },
+    { 10, 1,   9,   0 },
+    { 10, 1,   0,   9 },
+    { 10, 1,   9,  13 },
+    { 10, 1,   9,  12 },
+    { 10, 1,  12,   9 },
+    { 10, 1,  14,   8 },
+    { 10, 1,  10,  13 },
+    { 10, 1,  14,   9 },
+    { 10, 1,  12,  10 },
+    { 10, 1,   6,  15 },
+    { 10, 1,   7,  15 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 },
+    {  0, 0,   0,   0 }
+};
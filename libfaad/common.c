@@ -36,6 +36,14 @@
 #include <stdlib.h>
 #include "syntax.h"
 
+#ifdef USE_SSE
+# ifdef _MSC_VER
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+# endif
+#endif
+
 
 /* Returns the sample rate index based on the samplerate */
 uint8_t get_sr_index(const uint32_t samplerate)
@@ -171,7 +179,10 @@ int8_t can_decode_ot(const uint8_t object_type)
     return -1;
 }
 
-void *faad_malloc(size_t size)
+/* blocks are kept aligned for any of the internal data types */
+#define MEM_ALIGN 16
+
+static void *sys_malloc(size_t size)
 {
 #if 0 // defined(_WIN32) && !defined(_WIN32_WCE)
     return _aligned_malloc(size, 16);
@@ -180,15 +191,142 @@ void *faad_malloc(size_t size)
 #endif  // #ifdef 0
 }
 
-/* common free function */
-void faad_free(void *b)
+static void sys_free(void *b)
 {
 #if 0 // defined(_WIN32) && !defined(_WIN32_WCE)
     _aligned_free(b);
 #else
     free(b);
+#endif
+}
+
+static void *arena_malloc(allocator_info *alloc, size_t size)
+{
+    size_t start = (alloc->arena_used + MEM_ALIGN - 1) & ~(size_t)(MEM_ALIGN - 1);
+
+    if ((start > alloc->arena_size) || (size > alloc->arena_size - start))
+        return NULL;
+
+    alloc->arena_last = start;
+    alloc->arena_used = start + size;
+
+    return alloc->arena + start;
+}
+
+static void arena_free(allocator_info *alloc, void *b)
+{
+    /* only the most recent block can be given back, everything else is
+     * reclaimed when the arena itself is released by the caller */
+    if ((uint8_t*)b == alloc->arena + alloc->arena_last)
+    {
+        alloc->arena_used = alloc->arena_last;
+    }
 }
+
+/* common malloc function, alloc is NULL for scratch memory that does not
+ * belong to a decoder instance */
+void *faad_malloc(allocator_info *alloc, size_t size)
+{
+    uint8_t *b;
+
+    if (alloc == NULL)
+        return sys_malloc(size);
+
+    if (alloc->arena != NULL)
+        return arena_malloc(alloc, size);
+
+    /* instance blocks carry their size in front of them,
+     * so that the memory usage can be kept up to date */
+    if (alloc->cb.alloc != NULL)
+        b = (uint8_t*)alloc->cb.alloc(alloc->cb.user_data, (unsigned long)(size + MEM_ALIGN));
+    else
+        b = (uint8_t*)sys_malloc(size + MEM_ALIGN);
+    if (b == NULL)
+        return NULL;
+
+    *(size_t*)b = size;
+    alloc->bytes_used += size;
+
+    return b + MEM_ALIGN;
+}
+
+/* common free function */
+void faad_free(allocator_info *alloc, void *b)
+{
+    if (alloc == NULL)
+    {
+        sys_free(b);
+        return;
+    }
+
+    if (alloc->arena != NULL)
+    {
+        arena_free(alloc, b);
+        return;
+    }
+
+    if (b == NULL)
+        return;
+
+    b = (uint8_t*)b - MEM_ALIGN;
+    alloc->bytes_used -= *(size_t*)b;
+
+    if (alloc->cb.free != NULL)
+        alloc->cb.free(alloc->cb.user_data, b);
+    else
+        sys_free(b);
+}
+
+/* bytes currently held by the instance that owns alloc */
+size_t faad_memory_used(allocator_info *alloc)
+{
+    if (alloc->arena != NULL)
+        return alloc->arena_used;
+
+    return alloc->bytes_used;
+}
+
+/* 1 when the SSE code paths can be used on this CPU */
+uint8_t cpu_has_sse(void)
+{
+#ifdef USE_SSE
+# ifdef _MSC_VER
+    int info[4];
+
+    __cpuid(info, 1);
+    return (info[3] >> 25) & 1;
+# else
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+    return (edx >> 25) & 1;
+# endif
+#else
+    return 0;
+#endif
+}
+
+/* 1 when the SSE2 code paths can be used on this CPU */
+uint8_t cpu_has_sse2(void)
+{
+#ifdef USE_SSE
+# ifdef _MSC_VER
+    int info[4];
+
+    __cpuid(info, 1);
+    return (info[3] >> 26) & 1;
+# else
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+    return (edx >> 26) & 1;
+# endif
+#else
+    return 0;
 #endif
+}
 
 static const  uint8_t    Parity [256] = {  // parity
     0,1,1,0,1,0,0,1,1,0,0,1,0,1,1,0,1,0,0,1,0,1,1,0,0,1,1,0,1,0,0,1,
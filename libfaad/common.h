@@ -47,6 +47,15 @@ extern "C" {
 #define INLINE inline
 #endif
 
+/* for code that only makes sense when inlined into its caller */
+#if defined(_MSC_VER)
+#define ALWAYS_INLINE __forceinline
+#elif defined(__GNUC__)
+#define ALWAYS_INLINE __inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE INLINE
+#endif
+
 #if 0 //defined(_WIN32) && !defined(_WIN32_WCE)
 #define ALIGN __declspec(align(16))
 #else
@@ -128,6 +137,13 @@ extern "C" {
 // Define SBR_LOW_POWER if you want only low power SBR decoding without PS.
 //#define SBR_LOW_POWER
 
+// Define SBR_SPLIT_QMF to store the SBR QMF matrices with separate real and
+// imaginary arrays per time slot instead of interleaved complex values.
+//#define SBR_SPLIT_QMF
+#ifdef SBR_LOW_POWER
+# undef SBR_SPLIT_QMF
+#endif
+
 #ifndef DISABLE_SBR
 # define SBR_DEC
 # ifndef SBR_LOW_POWER
@@ -163,6 +179,34 @@ extern "C" {
 #define DIV_F(A, B) ((A)/(B))
 #endif
 
+// Define USE_THREADS to allow decoding parts of a frame on a pool of worker
+// threads, see NeAACDecSetThreads. Uses pthreads, or the Win32 API on Windows.
+//#define USE_THREADS
+
+// Define DISABLE_SSE if you don't want the SSE code paths.
+//#define DISABLE_SSE
+
+/* SSE versions of the floating point kernels, used when the CPU has SSE */
+#if !defined(FIXED_POINT) && !defined(USE_DOUBLE_PRECISION) && !defined(DISABLE_SSE)
+# if (defined(__i386__) || defined(__x86_64__)) && defined(__GNUC__)
+#  define USE_SSE
+#  ifdef __SSE__
+#   define SSE_TARGET
+#  else
+#   define SSE_TARGET __attribute__((target("sse")))
+#  endif
+#  ifdef __SSE2__
+#   define SSE2_TARGET
+#  else
+#   define SSE2_TARGET __attribute__((target("sse2")))
+#  endif
+# elif defined(_M_IX86) || defined(_M_X64)
+#  define USE_SSE
+#  define SSE_TARGET
+#  define SSE2_TARGET
+# endif
+#endif
+
 #ifndef SBR_LOW_POWER
 #define qmf_t complex_t
 #define QMF_RE(A) RE(A)
@@ -298,6 +342,29 @@ typedef float float32_t;
       *y2 = MUL_F(x2, c1) - MUL_F(x1, c2);
   }
 
+  /* 1/sqrt(x) for normal x > 0 from the exponent bits and two
+     Newton-Raphson steps, relative error below 1e-5; used by the
+     fast math mode of the SBR and PS code */
+  static INLINE real_t faad_rsqrt(real_t x)
+  {
+      union { float f; uint32_t i; } u;
+      real_t y;
+
+      u.f = x;
+      u.i = 0x5f375a86 - (u.i >> 1);
+      y = u.f;
+      y = y * (1.5f - 0.5f * x * y * y);
+      y = y * (1.5f - 0.5f * x * y * y);
+
+      return y;
+  }
+
+  /* sqrt(x) for x >= 0 */
+  static INLINE real_t faad_sqrt_fast(real_t x)
+  {
+      return (x > 0) ? x * faad_rsqrt(x) : 0;
+  }
+
 
   #if defined(_WIN32) && defined(_M_IX86) && !defined(__MINGW32__)
     #ifndef HAVE_LRINTF
@@ -391,9 +458,56 @@ typedef real_t complex_t[2];
 #define RE(A) (A)[0]
 #define IM(A) (A)[1]
 
+/* One time slot of the 64 band SBR QMF matrices. With SBR_SPLIT_QMF the
+   real and imaginary parts are kept in separate arrays, elements are
+   accessed through QMF_RE_AT/QMF_IM_AT in both layouts */
+#ifdef SBR_SPLIT_QMF
+typedef struct
+{
+    real_t re[64];
+    real_t im[64];
+} qmf_row_t;
+#define QMF_RE_AT(R, k) ((R).re[k])
+#define QMF_IM_AT(R, k) ((R).im[k])
+#else
+typedef qmf_t qmf_row_t[64];
+#define QMF_RE_AT(R, k) QMF_RE((R)[k])
+#define QMF_IM_AT(R, k) QMF_IM((R)[k])
+#endif
+
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+#include <xmmintrin.h>
+
+/* load subbands k..k+3 of a QMF row as separate real and imaginary vectors */
+static ALWAYS_INLINE SSE_TARGET void load_qmf4(qmf_row_t *row, uint8_t k, __m128 *re, __m128 *im)
+{
+#ifdef SBR_SPLIT_QMF
+    *re = _mm_loadu_ps(&row->re[k]);
+    *im = _mm_loadu_ps(&row->im[k]);
+#else
+    __m128 a = _mm_loadu_ps(&QMF_RE((*row)[k]));
+    __m128 b = _mm_loadu_ps(&QMF_RE((*row)[k+2]));
+    *re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+#endif
+}
+
+static ALWAYS_INLINE SSE_TARGET void store_qmf4(qmf_row_t *row, uint8_t k, __m128 re, __m128 im)
+{
+#ifdef SBR_SPLIT_QMF
+    _mm_storeu_ps(&row->re[k], re);
+    _mm_storeu_ps(&row->im[k], im);
+#else
+    _mm_storeu_ps(&QMF_RE((*row)[k]), _mm_unpacklo_ps(re, im));
+    _mm_storeu_ps(&QMF_RE((*row)[k+2]), _mm_unpackhi_ps(re, im));
+#endif
+}
+#endif
+
 
 /* common functions */
 uint8_t cpu_has_sse(void);
+uint8_t cpu_has_sse2(void);
 uint32_t ne_rng(uint32_t *__r1, uint32_t *__r2);
 #ifdef FIXED_POINT
 uint32_t wl_min_lzc(uint32_t x);
@@ -409,8 +523,25 @@ uint8_t max_tns_sfb(const uint8_t sr_index, const uint8_t object_type,
 uint32_t get_sample_rate(const uint8_t sr_index);
 int8_t can_decode_ot(const uint8_t object_type);
 
-void *faad_malloc(size_t size);
-void faad_free(void *b);
+/* Memory source of a decoder instance: either the user callbacks or a
+ * caller-provided arena; with neither set the system allocator is used.
+ */
+typedef struct
+{
+    NeAACDecAllocator cb;
+
+    uint8_t *arena;
+    size_t arena_size;
+    size_t arena_used;
+    size_t arena_last;
+
+    /* bytes handed out through the callbacks or the system allocator */
+    size_t bytes_used;
+} allocator_info;
+
+void *faad_malloc(allocator_info *alloc, size_t size);
+void faad_free(allocator_info *alloc, void *b);
+size_t faad_memory_used(allocator_info *alloc);
 
 //#define PROFILE
 #ifdef PROFILE
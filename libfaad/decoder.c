@@ -34,9 +34,13 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 #include "mp4.h"
 #include "syntax.h"
+#include "specrec.h"
 #include "error.h"
 #include "output.h"
 #include "filtbank.h"
@@ -48,6 +52,9 @@
 #ifdef SSR_DEC
 #include "ssr.h"
 #endif
+#ifdef ERROR_RESILIENCE
+#include "rvlc.h"
+#endif
 
 #ifdef ANALYSIS
 uint16_t dbg_count;
@@ -64,8 +71,23 @@ static void* aac_frame_decode(NeAACDecStruct *hDecoder,
                               unsigned long buffer_size,
                               void **sample_buffer2,
                               unsigned long sample_buffer_size);
+static uint8_t aac_frame_parse(NeAACDecStruct *hDecoder,
+                               NeAACDecFrameInfo *hInfo,
+                               parsed_frame *frame,
+                               unsigned char *buffer,
+                               unsigned long buffer_size,
+                               uint8_t grow);
+static void* aac_frame_synthesize(NeAACDecStruct *hDecoder,
+                                  NeAACDecFrameInfo *hInfo,
+                                  void **sample_buffer2,
+                                  unsigned long sample_buffer_size);
 static void create_channel_config(NeAACDecStruct *hDecoder,
                                   NeAACDecFrameInfo *hInfo);
+static void output_rate_init(NeAACDecStruct *hDecoder, unsigned long *samplerate);
+#ifndef FIXED_POINT
+static uint16_t resample_setup(NeAACDecStruct *hDecoder, uint8_t channels,
+                               uint32_t rate, uint16_t frame_len);
+#endif
 
 
 int NeAACDecGetVersion(char **faad_id_string,
@@ -120,21 +142,187 @@ unsigned long NeAACDecGetCapabilities(void)
 }
 
 const unsigned char mes[] = { 0x67,0x20,0x61,0x20,0x20,0x20,0x6f,0x20,0x72,0x20,0x65,0x20,0x6e,0x20,0x20,0x20,0x74,0x20,0x68,0x20,0x67,0x20,0x69,0x20,0x72,0x20,0x79,0x20,0x70,0x20,0x6f,0x20,0x63 };
-NeAACDecHandle NeAACDecOpen(void)
+/* reference counting of the shared context, decoders can be opened and
+   closed from different threads */
+static long shared_retain(NeAACDecSharedStruct *shared)
+{
+#if defined(_MSC_VER)
+    return _InterlockedIncrement(&shared->refcount);
+#elif defined(__GNUC__)
+    return __sync_add_and_fetch(&shared->refcount, 1);
+#else
+    return ++shared->refcount;
+#endif
+}
+
+static long shared_release(NeAACDecSharedStruct *shared)
+{
+#if defined(_MSC_VER)
+    return _InterlockedDecrement(&shared->refcount);
+#elif defined(__GNUC__)
+    return __sync_sub_and_fetch(&shared->refcount, 1);
+#else
+    return --shared->refcount;
+#endif
+}
+
+/* counters of the split decoding queue, each is written by one side and read
+   by the other; the increment publishes the frame it counts */
+static long frame_count_get(long *count)
+{
+#if defined(_MSC_VER)
+    /* volatile reads have acquire semantics with MSVC */
+    return *(volatile long*)count;
+#elif defined(__GNUC__)
+    return __atomic_load_n(count, __ATOMIC_ACQUIRE);
+#else
+    return *count;
+#endif
+}
+
+static void frame_count_next(long *count)
+{
+#if defined(_MSC_VER)
+    _InterlockedIncrement(count);
+#elif defined(__GNUC__)
+    __atomic_add_fetch(count, 1, __ATOMIC_RELEASE);
+#else
+    ++*count;
+#endif
+}
+
+static void parsed_frames_end(NeAACDecStruct *hDecoder)
+{
+    uint8_t i, j;
+
+    for (i = 0; i < PARSED_FRAMES; i++)
+    {
+        parsed_frame *frame = hDecoder->parsed[i];
+
+        if (frame == NULL)
+            continue;
+
+        for (j = 0; j < MAX_SYNTAX_ELEMENTS; j++)
+        {
+            if (frame->ele[j])
+                faad_free(&hDecoder->alloc, frame->ele[j]);
+        }
+        if (frame->data)
+            faad_free(&hDecoder->alloc, frame->data);
+        faad_free(&hDecoder->alloc, frame);
+        hDecoder->parsed[i] = NULL;
+    }
+}
+
+static void shared_end(NeAACDecSharedStruct *shared)
+{
+    allocator_info alloc = shared->alloc;
+
+    filter_bank_end(&alloc, shared->fb);
+#ifdef ALLOW_SMALL_FRAMELENGTH
+    filter_bank_end(&alloc, shared->fb960);
+#endif
+
+    faad_free(&alloc, shared);
+}
+
+NeAACDecSharedHandle NeAACDecSharedOpen(void)
+{
+    allocator_info alloc;
+    NeAACDecSharedStruct *shared;
+
+    memset(&alloc, 0, sizeof(allocator_info));
+
+    if ((shared = (NeAACDecSharedStruct*)faad_malloc(&alloc, sizeof(NeAACDecSharedStruct))) == NULL)
+        return NULL;
+
+    memset(shared, 0, sizeof(NeAACDecSharedStruct));
+    shared->alloc = alloc;
+    shared->refcount = 1;
+
+    /* both frame lengths the decoder can be initialised with */
+    shared->fb = filter_bank_init(&shared->alloc, 1024);
+#ifdef ALLOW_SMALL_FRAMELENGTH
+    shared->fb960 = filter_bank_init(&shared->alloc, 960);
+#endif
+    if ((shared->fb == NULL)
+#ifdef ALLOW_SMALL_FRAMELENGTH
+        || (shared->fb960 == NULL)
+#endif
+        )
+    {
+        shared_end(shared);
+        return NULL;
+    }
+
+    return shared;
+}
+
+void NeAACDecSharedClose(NeAACDecSharedHandle hpShared)
+{
+    NeAACDecSharedStruct *shared = (NeAACDecSharedStruct*)hpShared;
+
+    if (shared && shared_release(shared) == 0)
+        shared_end(shared);
+}
+
+/* filterbank for the current frame length, taken from the shared context when possible */
+static fb_info *decoder_filter_bank(NeAACDecStruct *hDecoder)
+{
+    if (hDecoder->shared != NULL)
+    {
+        if (hDecoder->frameLength == 1024)
+            return hDecoder->shared->fb;
+#ifdef ALLOW_SMALL_FRAMELENGTH
+        if (hDecoder->frameLength == 960)
+            return hDecoder->shared->fb960;
+#endif
+    }
+
+    return filter_bank_init(&hDecoder->alloc, hDecoder->frameLength);
+}
+
+static void decoder_filter_bank_end(NeAACDecStruct *hDecoder)
+{
+    if (hDecoder->shared != NULL)
+    {
+        if (hDecoder->fb == hDecoder->shared->fb)
+            return;
+#ifdef ALLOW_SMALL_FRAMELENGTH
+        if (hDecoder->fb == hDecoder->shared->fb960)
+            return;
+#endif
+    }
+
+    filter_bank_end(&hDecoder->alloc, hDecoder->fb);
+}
+
+static NeAACDecHandle decoder_open(allocator_info *alloc, NeAACDecSharedStruct *shared)
 {
     uint8_t i;
     NeAACDecStruct *hDecoder = NULL;
 
-    if ((hDecoder = (NeAACDecStruct*)faad_malloc(sizeof(NeAACDecStruct))) == NULL)
+    if ((hDecoder = (NeAACDecStruct*)faad_malloc(alloc, sizeof(NeAACDecStruct))) == NULL)
         return NULL;
 
     memset(hDecoder, 0, sizeof(NeAACDecStruct));
 
+    /* the instance owns its allocator from here on */
+    hDecoder->alloc = *alloc;
+
+    if (shared != NULL)
+    {
+        shared_retain(shared);
+        hDecoder->shared = shared;
+    }
+
     hDecoder->cmes = mes;
     hDecoder->config.outputFormat  = FAAD_FMT_16BIT;
     hDecoder->config.defObjectType = MAIN;
     hDecoder->config.defSampleRate = 44100; /* Default: 44.1kHz */
     hDecoder->config.downMatrix = 0;
+    hDecoder->config.skipChannels = 0;
+    hDecoder->config.outputSampleRate = 0;
     hDecoder->adts_header_present = 0;
     hDecoder->adif_header_present = 0;
     hDecoder->latm_header_present = 0;
@@ -152,6 +340,11 @@ NeAACDecHandle NeAACDecOpen(void)
     hDecoder->__r1 = 0x2bb431ea;
     hDecoder->__r2 = 0x206155b7;
 
+#ifdef USE_SSE
+    hDecoder->sse = cpu_has_sse();
+    hDecoder->sse2 = cpu_has_sse2();
+#endif
+
     for (i = 0; i < MAX_CHANNELS; i++)
     {
         hDecoder->element_id[i] = INVALID_ELEMENT_ID;
@@ -178,11 +371,66 @@ NeAACDecHandle NeAACDecOpen(void)
     }
 #endif
 
-    hDecoder->drc = drc_init(REAL_CONST(1.0), REAL_CONST(1.0));
+    hDecoder->drc = drc_init(&hDecoder->alloc, REAL_CONST(1.0), REAL_CONST(1.0));
+    if (hDecoder->drc == NULL)
+    {
+        if (shared != NULL && shared_release(shared) == 0)
+            shared_end(shared);
+        faad_free(alloc, hDecoder);
+        return NULL;
+    }
 
     return hDecoder;
 }
 
+NeAACDecHandle NeAACDecOpen(void)
+{
+    allocator_info alloc;
+
+    memset(&alloc, 0, sizeof(allocator_info));
+
+    return decoder_open(&alloc, NULL);
+}
+
+NeAACDecHandle NeAACDecOpenShared(NeAACDecSharedHandle hpShared)
+{
+    allocator_info alloc;
+
+    if (hpShared == NULL)
+        return NULL;
+
+    memset(&alloc, 0, sizeof(allocator_info));
+
+    return decoder_open(&alloc, (NeAACDecSharedStruct*)hpShared);
+}
+
+NeAACDecHandle NeAACDecOpenWithAllocator(const NeAACDecAllocator *allocator)
+{
+    allocator_info alloc;
+
+    if (allocator == NULL || allocator->alloc == NULL || allocator->free == NULL)
+        return NULL;
+
+    memset(&alloc, 0, sizeof(allocator_info));
+    alloc.cb = *allocator;
+
+    return decoder_open(&alloc, NULL);
+}
+
+NeAACDecHandle NeAACDecOpenWithArena(void *arena, unsigned long arena_size)
+{
+    allocator_info alloc;
+
+    if (arena == NULL)
+        return NULL;
+
+    memset(&alloc, 0, sizeof(allocator_info));
+    alloc.arena = (uint8_t*)arena;
+    alloc.arena_size = arena_size;
+
+    return decoder_open(&alloc, NULL);
+}
+
 NeAACDecConfigurationPtr NeAACDecGetCurrentConfiguration(NeAACDecHandle hpDecoder)
 {
     NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
@@ -196,6 +444,89 @@ NeAACDecConfigurationPtr NeAACDecGetCurrentConfiguration(NeAACDecHandle hpDecode
     return NULL;
 }
 
+unsigned long NeAACDecGetMemoryUsage(NeAACDecHandle hpDecoder)
+{
+    NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
+    if (hDecoder)
+        return (unsigned long)faad_memory_used(&hDecoder->alloc);
+
+    return 0;
+}
+
+unsigned char NeAACDecSetDownmixMatrix(NeAACDecHandle hpDecoder,
+                                       const float *matrix,
+                                       unsigned char in_channels,
+                                       unsigned char out_channels)
+{
+    uint16_t i;
+    NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
+
+    if (hDecoder == NULL)
+        return 0;
+
+    if (matrix == NULL)
+    {
+        hDecoder->dmx_in_channels = 0;
+        hDecoder->dmx_out_channels = 0;
+        return 1;
+    }
+
+    if ((in_channels == 0) || (in_channels > MAX_CHANNELS) ||
+        (out_channels == 0) || (out_channels > DMX_MAX_OUT))
+    {
+        return 0;
+    }
+
+    for (i = 0; i < in_channels*out_channels; i++)
+        hDecoder->dmx_matrix[i] = matrix[i];
+    hDecoder->dmx_in_channels = in_channels;
+    hDecoder->dmx_out_channels = out_channels;
+
+    return 1;
+}
+
+unsigned char NeAACDecSetThreads(NeAACDecHandle hpDecoder, unsigned char threads)
+{
+    NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
+    if (hDecoder == NULL || threads == 0)
+        return 0;
+
+    tpool_end(&hDecoder->alloc, hDecoder->pool);
+    hDecoder->pool = NULL;
+
+    if (threads > 1)
+    {
+        /* fails as well when built without thread support */
+        hDecoder->pool = tpool_init(&hDecoder->alloc, threads);
+        if (hDecoder->pool == NULL)
+            return 0;
+    }
+
+    return 1;
+}
+
+unsigned char NeAACDecSetScheduler(NeAACDecHandle hpDecoder,
+                                   const NeAACDecScheduler *scheduler)
+{
+    NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
+    if (hDecoder == NULL)
+        return 0;
+
+    tpool_end(&hDecoder->alloc, hDecoder->pool);
+    hDecoder->pool = NULL;
+
+    if (scheduler != NULL)
+    {
+        if (scheduler->run == NULL)
+            return 0;
+        hDecoder->pool = tpool_init_scheduler(&hDecoder->alloc, scheduler);
+        if (hDecoder->pool == NULL)
+            return 0;
+    }
+
+    return 1;
+}
+
 unsigned char NeAACDecSetConfiguration(NeAACDecHandle hpDecoder,
                                                    NeAACDecConfigurationPtr config)
 {
@@ -222,10 +553,40 @@ unsigned char NeAACDecSetConfiguration(NeAACDecHandle hpDecoder,
 #endif
         hDecoder->config.outputFormat = config->outputFormat;
 
-        if (config->downMatrix > 1)
+        if (config->downMatrix > FAAD_DMX_5_1)
             return 0;
         hDecoder->config.downMatrix = config->downMatrix;
 
+        if (config->preallocate > 1)
+            return 0;
+        hDecoder->config.preallocate = config->preallocate;
+
+        /* real valued SBR; always on in SBR_LOW_POWER builds */
+        if (config->useLowPowerSBR > 1)
+            return 0;
+        hDecoder->config.useLowPowerSBR = config->useLowPowerSBR;
+
+        /* approximate SBR/PS math; ignored by fixed point and double builds */
+        if (config->useFastMathSBR > 1)
+            return 0;
+        hDecoder->config.useFastMathSBR = config->useFastMathSBR;
+
+        /* channels of which the caller does not need the output */
+        hDecoder->config.skipChannels = config->skipChannels;
+
+        /* sample rate conversion of the output, 0 is off */
+#ifdef FIXED_POINT
+        if (config->outputSampleRate != 0)
+            return 0;
+#else
+        if ((config->outputSampleRate != 0) &&
+            ((config->outputSampleRate < 8000) || (config->outputSampleRate > 192000)))
+        {
+            return 0;
+        }
+#endif
+        hDecoder->config.outputSampleRate = config->outputSampleRate;
+
         /* OK */
         return 1;
     }
@@ -267,6 +628,7 @@ long NeAACDecInit(NeAACDecHandle hpDecoder,
                               unsigned char *channels)
 {
     uint32_t bits = 0;
+    uint8_t channel_config = 0;
     bitfile ld;
     adif_header adif;
     adts_header adts;
@@ -337,6 +699,7 @@ long NeAACDecInit(NeAACDecHandle hpDecoder,
             *samplerate = get_sample_rate(hDecoder->sf_index);
             *channels = (adts.channel_configuration > 6) ?
                 2 : adts.channel_configuration;
+            channel_config = adts.channel_configuration;
         }
 
         if (ld.error)
@@ -372,13 +735,17 @@ long NeAACDecInit(NeAACDecHandle hpDecoder,
     }
 #endif
 
+    output_rate_init(hDecoder, samplerate);
+
     /* must be done before frameLength is divided by 2 for LD */
 #ifdef SSR_DEC
     if (hDecoder->object_type == SSR)
-        hDecoder->fb = ssr_filter_bank_init(hDecoder->frameLength/SSR_BANDS);
+        hDecoder->fb = ssr_filter_bank_init(&hDecoder->alloc, hDecoder->frameLength/SSR_BANDS);
     else
 #endif
-        hDecoder->fb = filter_bank_init(hDecoder->frameLength);
+        hDecoder->fb = decoder_filter_bank(hDecoder);
+    if (hDecoder->fb == NULL)
+        return -1;
 
 #ifdef LD_DEC
     if (hDecoder->object_type == LD)
@@ -388,6 +755,12 @@ long NeAACDecInit(NeAACDecHandle hpDecoder,
     if (can_decode_ot(hDecoder->object_type) < 0)
         return -1;
 
+    if (hDecoder->config.preallocate)
+    {
+        if (preallocate_elements(hDecoder, channel_config) > 0)
+            return -1;
+    }
+
     return bits;
 }
 
@@ -461,6 +834,7 @@ char NeAACDecInit2(NeAACDecHandle hpDecoder,
     {
         return rc;
     }
+    output_rate_init(hDecoder, samplerate);
     hDecoder->channelConfiguration = mp4ASC.channelsConfiguration;
     if (mp4ASC.frameLengthFlag)
 #ifdef ALLOW_SMALL_FRAMELENGTH
@@ -472,16 +846,33 @@ char NeAACDecInit2(NeAACDecHandle hpDecoder,
     /* must be done before frameLength is divided by 2 for LD */
 #ifdef SSR_DEC
     if (hDecoder->object_type == SSR)
-        hDecoder->fb = ssr_filter_bank_init(hDecoder->frameLength/SSR_BANDS);
+        hDecoder->fb = ssr_filter_bank_init(&hDecoder->alloc, hDecoder->frameLength/SSR_BANDS);
     else
 #endif
-        hDecoder->fb = filter_bank_init(hDecoder->frameLength);
+        hDecoder->fb = decoder_filter_bank(hDecoder);
+    if (hDecoder->fb == NULL)
+        return -1;
 
 #ifdef LD_DEC
     if (hDecoder->object_type == LD)
         hDecoder->frameLength >>= 1;
 #endif
 
+#ifdef ERROR_RESILIENCE
+    if (hDecoder->aacScalefactorDataResilienceFlag && (hDecoder->rvlc_buffer == NULL))
+    {
+        hDecoder->rvlc_buffer = (uint8_t*)faad_malloc(&hDecoder->alloc, RVLC_BUFFER_SIZE);
+        if (hDecoder->rvlc_buffer == NULL)
+            return -1;
+    }
+#endif
+
+    if (hDecoder->config.preallocate)
+    {
+        if (preallocate_elements(hDecoder, mp4ASC.channelsConfiguration) > 0)
+            return -1;
+    }
+
     return 0;
 }
 
@@ -491,12 +882,33 @@ char NeAACDecInitDRM(NeAACDecHandle *hpDecoder,
                                  unsigned char channels)
 {
     NeAACDecStruct** hDecoder = (NeAACDecStruct**)hpDecoder;
+    NeAACDecSharedStruct *shared = NULL;
+    allocator_info alloc;
+
     if (hDecoder == NULL)
         return 1; /* error */
 
+    /* the new instance uses the memory and shared context of the old one */
+    memset(&alloc, 0, sizeof(allocator_info));
+    if (*hDecoder != NULL)
+    {
+        alloc.cb = (*hDecoder)->alloc.cb;
+        alloc.arena = (*hDecoder)->alloc.arena;
+        alloc.arena_size = (*hDecoder)->alloc.arena_size;
+
+        shared = (*hDecoder)->shared;
+        if (shared != NULL)
+            shared_retain(shared);
+    }
+
     NeAACDecClose(*hDecoder);
 
-    *hDecoder = NeAACDecOpen();
+    *hDecoder = decoder_open(&alloc, shared);
+
+    if (shared != NULL && shared_release(shared) == 0)
+        shared_end(shared);
+    if (*hDecoder == NULL)
+        return 1;
 
     /* Special object type defined for DRM */
     (*hDecoder)->config.defObjectType = DRM_ER_LC;
@@ -523,7 +935,9 @@ char NeAACDecInitDRM(NeAACDecHandle *hpDecoder,
         (*hDecoder)->sbr_present_flag = 1;
 #endif
 
-    (*hDecoder)->fb = filter_bank_init((*hDecoder)->frameLength);
+    (*hDecoder)->fb = decoder_filter_bank(*hDecoder);
+    if ((*hDecoder)->fb == NULL)
+        return 1;
 
     return 0;
 }
@@ -532,6 +946,8 @@ char NeAACDecInitDRM(NeAACDecHandle *hpDecoder,
 void NeAACDecClose(NeAACDecHandle hpDecoder)
 {
     uint8_t i;
+    allocator_info alloc;
+    NeAACDecSharedStruct *shared;
     NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
 
     if (hDecoder == NULL)
@@ -547,30 +963,42 @@ void NeAACDecClose(NeAACDecHandle hpDecoder)
 
     for (i = 0; i < MAX_CHANNELS; i++)
     {
-        if (hDecoder->time_out[i]) faad_free(hDecoder->time_out[i]);
-        if (hDecoder->fb_intermed[i]) faad_free(hDecoder->fb_intermed[i]);
+        if (hDecoder->time_out[i]) faad_free(&hDecoder->alloc, hDecoder->time_out[i]);
+        if (hDecoder->fb_intermed[i]) faad_free(&hDecoder->alloc, hDecoder->fb_intermed[i]);
 #ifdef SSR_DEC
-        if (hDecoder->ssr_overlap[i]) faad_free(hDecoder->ssr_overlap[i]);
-        if (hDecoder->prev_fmd[i]) faad_free(hDecoder->prev_fmd[i]);
+        if (hDecoder->ssr_overlap[i]) faad_free(&hDecoder->alloc, hDecoder->ssr_overlap[i]);
+        if (hDecoder->prev_fmd[i]) faad_free(&hDecoder->alloc, hDecoder->prev_fmd[i]);
 #endif
 #ifdef MAIN_DEC
-        if (hDecoder->pred_stat[i]) faad_free(hDecoder->pred_stat[i]);
+        if (hDecoder->pred_stat[i]) faad_free(&hDecoder->alloc, hDecoder->pred_stat[i]);
 #endif
 #ifdef LTP_DEC
-        if (hDecoder->lt_pred_stat[i]) faad_free(hDecoder->lt_pred_stat[i]);
+        if (hDecoder->lt_pred_stat[i]) faad_free(&hDecoder->alloc, hDecoder->lt_pred_stat[i]);
 #endif
     }
 
 #ifdef SSR_DEC
     if (hDecoder->object_type == SSR)
-        ssr_filter_bank_end(hDecoder->fb);
+        ssr_filter_bank_end(&hDecoder->alloc, hDecoder->fb);
     else
 #endif
-        filter_bank_end(hDecoder->fb);
+        decoder_filter_bank_end(hDecoder);
+
+    drc_end(&hDecoder->alloc, hDecoder->drc);
 
-    drc_end(hDecoder->drc);
+    tpool_end(&hDecoder->alloc, hDecoder->pool);
+
+    parsed_frames_end(hDecoder);
+
+#ifndef FIXED_POINT
+    resample_end(&hDecoder->alloc, hDecoder->resample);
+#endif
+
+#ifdef ERROR_RESILIENCE
+    if (hDecoder->rvlc_buffer) faad_free(&hDecoder->alloc, hDecoder->rvlc_buffer);
+#endif
 
-    if (hDecoder->sample_buffer) faad_free(hDecoder->sample_buffer);
+    if (hDecoder->sample_buffer) faad_free(&hDecoder->alloc, hDecoder->sample_buffer);
 
 #ifdef SBR_DEC
     for (i = 0; i < MAX_SYNTAX_ELEMENTS; i++)
@@ -580,7 +1008,13 @@ void NeAACDecClose(NeAACDecHandle hpDecoder)
     }
 #endif
 
-    if (hDecoder) faad_free(hDecoder);
+    /* the allocator lives inside the instance being released */
+    alloc = hDecoder->alloc;
+    shared = hDecoder->shared;
+    faad_free(&alloc, hDecoder);
+
+    if (shared != NULL && shared_release(shared) == 0)
+        shared_end(shared);
 }
 
 void NeAACDecPostSeekReset(NeAACDecHandle hpDecoder, long frame)
@@ -592,8 +1026,78 @@ void NeAACDecPostSeekReset(NeAACDecHandle hpDecoder, long frame)
 
         if (frame != -1)
             hDecoder->frame = frame;
+
+        /* frames parsed before the seek are dropped; no NeAACDecParse or
+         * NeAACDecSynthesize call may be in flight, so both ends of the
+         * queue are reset together
+         */
+        hDecoder->parse_count = 0;
+        hDecoder->synth_count = 0;
+
+#ifndef FIXED_POINT
+        if (hDecoder->resample != NULL)
+            resample_reset(hDecoder->resample);
+#endif
+    }
+}
+
+/* output at config.outputSampleRate: SBR that would be synthesized at
+ * twice the AAC core rate and then converted down to a rate not above the
+ * core rate is synthesized at the core rate by the 32 band QMF bank instead
+ */
+static void output_rate_init(NeAACDecStruct *hDecoder, unsigned long *samplerate)
+{
+    if (hDecoder->config.outputSampleRate == 0)
+        return;
+
+#ifdef SBR_DEC
+    if (hDecoder->config.outputSampleRate <= get_sample_rate(hDecoder->sf_index))
+    {
+        hDecoder->downSampledSBR = 1;
+        hDecoder->forceUpSampling = 0;
+    }
+#endif
+
+    *samplerate = hDecoder->config.outputSampleRate;
+}
+
+#ifndef FIXED_POINT
+/* sets up the conversion of the decoded channels to config.outputSampleRate,
+ * returns the most samples per channel of the converted frame, 0 when the
+ * conversion is not possible
+ */
+static uint16_t resample_setup(NeAACDecStruct *hDecoder, uint8_t channels,
+                               uint32_t rate, uint16_t frame_len)
+{
+    resampler *rs = hDecoder->resample;
+    uint32_t out_rate = hDecoder->config.outputSampleRate;
+    uint8_t sse = 0;
+
+    if ((out_rate == 0) || (out_rate == rate))
+    {
+        resample_end(&hDecoder->alloc, rs);
+        hDecoder->resample = NULL;
+        return frame_len;
+    }
+
+    if ((rs != NULL) && (rs->in_rate == rate) && (rs->out_rate == out_rate) &&
+        (rs->frame_len == frame_len) && (rs->channels == channels))
+    {
+        return rs->max_out;
     }
+
+#ifdef USE_SSE
+    sse = hDecoder->sse;
+#endif
+    resample_end(&hDecoder->alloc, rs);
+    hDecoder->resample = rs = resample_init(&hDecoder->alloc, rate, out_rate,
+        frame_len, channels, sse);
+    if (rs == NULL)
+        return 0;
+
+    return rs->max_out;
 }
+#endif
 
 static void create_channel_config(NeAACDecStruct *hDecoder, NeAACDecFrameInfo *hInfo)
 {
@@ -605,9 +1109,22 @@ static void create_channel_config(NeAACDecStruct *hDecoder, NeAACDecFrameInfo *h
 
     if (hDecoder->downMatrix)
     {
-        hInfo->num_front_channels = 2;
-        hInfo->channel_position[0] = FRONT_CHANNEL_LEFT;
-        hInfo->channel_position[1] = FRONT_CHANNEL_RIGHT;
+        uint8_t i;
+
+        for (i = 0; i < hDecoder->dmx.out_channels; i++)
+        {
+            uint8_t pos = hDecoder->dmx.position[i];
+
+            hInfo->channel_position[i] = pos;
+            if (pos == LFE_CHANNEL)
+                hInfo->num_lfe_channels++;
+            else if (pos >= BACK_CHANNEL_LEFT)
+                hInfo->num_back_channels++;
+            else if (pos >= SIDE_CHANNEL_LEFT)
+                hInfo->num_side_channels++;
+            else if (pos != UNKNOWN_CHANNEL)
+                hInfo->num_front_channels++;
+        }
         return;
     }
 
@@ -845,6 +1362,327 @@ void* NeAACDecDecode2(NeAACDecHandle hpDecoder,
         sample_buffer, sample_buffer_size);
 }
 
+void** NeAACDecDecodePlanar(NeAACDecHandle hpDecoder,
+                            NeAACDecFrameInfo *hInfo,
+                            unsigned char *buffer,
+                            unsigned long buffer_size,
+                            void **channel_buffers,
+                            unsigned char channel_count,
+                            unsigned long channel_buffer_size)
+{
+    void *sample_buffer;
+    NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
+
+    if ((hDecoder == NULL) || (hInfo == NULL))
+        return NULL;
+
+    if ((channel_buffer_size == 0) || (channel_buffers == NULL) || (channel_count == 0))
+    {
+        hInfo->error = 27;
+        return NULL;
+    }
+
+    hDecoder->output_layout = OUTPUT_PLANAR;
+    hDecoder->planar_buffer = channel_buffers;
+    hDecoder->planar_channels = channel_count;
+    sample_buffer = aac_frame_decode(hDecoder, hInfo, buffer, buffer_size,
+        NULL, channel_buffer_size);
+    hDecoder->output_layout = OUTPUT_INTERLEAVED;
+    hDecoder->planar_buffer = NULL;
+
+    return (void**)sample_buffer;
+}
+
+const float* const* NeAACDecDecodeZeroCopy(NeAACDecHandle hpDecoder,
+                                           NeAACDecFrameInfo *hInfo,
+                                           unsigned char *buffer,
+                                           unsigned long buffer_size)
+{
+#ifndef FIXED_POINT
+    void *sample_buffer;
+#endif
+    NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
+
+    if ((hDecoder == NULL) || (hInfo == NULL))
+        return NULL;
+
+#ifdef FIXED_POINT
+    /* the internal buffers are not float in a fixed point build */
+    memset(hInfo, 0, sizeof(NeAACDecFrameInfo));
+    hInfo->error = 37;
+    return NULL;
+#else
+    hDecoder->output_layout = OUTPUT_TIME_OUT;
+    sample_buffer = aac_frame_decode(hDecoder, hInfo, buffer, buffer_size, NULL, 0);
+    hDecoder->output_layout = OUTPUT_INTERLEAVED;
+
+    return (const float* const*)sample_buffer;
+#endif
+}
+
+/* streams of a NeAACDecDecodeBatch call that go through a stage together */
+#define BATCH_STREAMS 32
+
+unsigned long NeAACDecDecodeBatch(NeAACDecBatchItem *items,
+                                  unsigned long count)
+{
+    unsigned long i, first, last;
+    unsigned long decoded = 0;
+    uint8_t queued[BATCH_STREAMS];
+
+    if (items == NULL)
+        return 0;
+
+    /* The streams are decoded one stage at a time: the parse stage
+     * (bitstream and Huffman decoding) of up to BATCH_STREAMS streams runs
+     * first, then the synthesis stage (inverse quantization, tools,
+     * filterbank, SBR) of the same streams, so the tables of each stage
+     * stay hot in cache across the streams. Frames that can not go through
+     * the parse queue (DRM, preallocated decoders, a queue that is in use)
+     * are decoded in one go in the synthesis pass.
+     */
+    for (first = 0; first < count; first = last)
+    {
+        last = (count - first > BATCH_STREAMS) ? first + BATCH_STREAMS : count;
+
+        for (i = first; i < last; i++)
+        {
+            NeAACDecBatchItem *item = &items[i];
+            NeAACDecStruct* hDecoder = (NeAACDecStruct*)item->hDecoder;
+
+            memset(&item->frameInfo, 0, sizeof(NeAACDecFrameInfo));
+            item->samples = NULL;
+            queued[i - first] = 0;
+
+            if (hDecoder == NULL || item->buffer == NULL)
+                continue;
+            if (item->sample_buffer_size != 0 && item->sample_buffer == NULL)
+                continue;
+            /* the parse queue allocates memory on first use */
+            if (hDecoder->config.preallocate || hDecoder->parse_count != hDecoder->synth_count)
+                continue;
+
+            queued[i - first] = NeAACDecParse(hDecoder, &item->frameInfo,
+                item->buffer, item->buffer_size);
+        }
+
+        for (i = first; i < last; i++)
+        {
+            NeAACDecBatchItem *item = &items[i];
+            NeAACDecStruct* hDecoder = (NeAACDecStruct*)item->hDecoder;
+            void **sample_buffer = NULL;
+
+            if (hDecoder == NULL || item->buffer == NULL)
+                continue;
+
+            if (item->sample_buffer_size != 0)
+            {
+                if (item->sample_buffer == NULL)
+                {
+                    item->frameInfo.error = 27;
+                    continue;
+                }
+                sample_buffer = &item->sample_buffer;
+            }
+
+            if (queued[i - first])
+            {
+                item->samples = aac_frame_synthesize(hDecoder, &item->frameInfo,
+                    sample_buffer, item->sample_buffer_size);
+            } else {
+                item->samples = aac_frame_decode(hDecoder, &item->frameInfo,
+                    item->buffer, item->buffer_size,
+                    sample_buffer, item->sample_buffer_size);
+            }
+
+            if (item->frameInfo.error == 0)
+                decoded++;
+        }
+    }
+
+    return decoded;
+}
+
+unsigned char NeAACDecParse(NeAACDecHandle hpDecoder,
+                            NeAACDecFrameInfo *hInfo,
+                            unsigned char *buffer,
+                            unsigned long buffer_size)
+{
+    uint8_t i, grow;
+    long synth_count;
+    NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
+
+    if ((hDecoder == NULL) || (hInfo == NULL) || (buffer == NULL))
+        return 0;
+
+    memset(hInfo, 0, sizeof(NeAACDecFrameInfo));
+
+#ifdef DRM
+    if (hDecoder->object_type == DRM_ER_LC)
+    {
+        hInfo->error = 36;
+        return 0;
+    }
+#endif
+
+    synth_count = frame_count_get(&hDecoder->synth_count);
+    if ((unsigned long)(hDecoder->parse_count - synth_count) >= PARSED_FRAMES)
+    {
+        hInfo->error = 34;
+        return 0;
+    }
+
+    /* memory of the queue only changes while no frame of it can be in
+       synthesis */
+    grow = (hDecoder->parse_count == synth_count);
+
+    if (hDecoder->parsed[0] == NULL)
+    {
+        for (i = 0; i < PARSED_FRAMES; i++)
+        {
+            parsed_frame *frame = (parsed_frame*)faad_malloc(&hDecoder->alloc, sizeof(parsed_frame));
+            if (frame == NULL)
+            {
+                parsed_frames_end(hDecoder);
+                hInfo->error = 34;
+                return 0;
+            }
+            memset(frame, 0, sizeof(parsed_frame));
+            hDecoder->parsed[i] = frame;
+
+            /* room for the largest valid frame */
+            frame->data_alloc = FAAD_MIN_STREAMSIZE*MAX_CHANNELS;
+            if ((frame->data = (uint8_t*)faad_malloc(&hDecoder->alloc, frame->data_alloc)) == NULL)
+            {
+                parsed_frames_end(hDecoder);
+                hInfo->error = 34;
+                return 0;
+            }
+        }
+    }
+
+    if (!aac_frame_parse(hDecoder, hInfo,
+        hDecoder->parsed[hDecoder->parse_count % PARSED_FRAMES],
+        buffer, buffer_size, grow))
+    {
+        hInfo->error = 34;
+        return 0;
+    }
+
+    frame_count_next(&hDecoder->parse_count);
+
+    return 1;
+}
+
+void* NeAACDecSynthesize(NeAACDecHandle hpDecoder,
+                         NeAACDecFrameInfo *hInfo)
+{
+    NeAACDecStruct* hDecoder = (NeAACDecStruct*)hpDecoder;
+
+    if ((hDecoder == NULL) || (hInfo == NULL))
+        return NULL;
+
+    if (frame_count_get(&hDecoder->parse_count) == hDecoder->synth_count)
+    {
+        memset(hInfo, 0, sizeof(NeAACDecFrameInfo));
+        hInfo->error = 35;
+        return NULL;
+    }
+
+    return aac_frame_synthesize(hDecoder, hInfo, NULL, 0);
+}
+
+/* Synthesis stage of the split decoding interface, decodes the oldest
+   queued frame. */
+static void* aac_frame_synthesize(NeAACDecStruct *hDecoder,
+                                  NeAACDecFrameInfo *hInfo,
+                                  void **sample_buffer2,
+                                  unsigned long sample_buffer_size)
+{
+    void *sample_buffer;
+    parsed_frame *frame;
+
+    frame = hDecoder->parsed[hDecoder->synth_count % PARSED_FRAMES];
+    frame->ele_next = 0;
+
+    /* the frame is decoded from its saved bytes as in NeAACDecDecode(),
+       with the channel elements taken from the parse stage */
+    hDecoder->replay = frame;
+    sample_buffer = aac_frame_decode(hDecoder, hInfo, frame->data, frame->data_size,
+        sample_buffer2, sample_buffer_size);
+    hDecoder->replay = NULL;
+
+    frame_count_next(&hDecoder->synth_count);
+
+    return sample_buffer;
+}
+
+/* Parse stage of the split decoding interface, the frame is read up to
+   and including the Huffman decoding of its channel elements.
+   Returns 0 when the frame could not be queued. */
+static uint8_t aac_frame_parse(NeAACDecStruct *hDecoder,
+                               NeAACDecFrameInfo *hInfo,
+                               parsed_frame *frame,
+                               unsigned char *buffer,
+                               unsigned long buffer_size,
+                               uint8_t grow)
+{
+    bitfile ld;
+    uint32_t bytes = 0;
+    uint32_t size;
+
+    frame->ele_count = 0;
+    frame->ele_next = 0;
+    frame->error = 0;
+
+    /* ID3 */
+    if ((buffer_size >= 128) && (memcmp(buffer, "TAG", 3) == 0))
+    {
+        hInfo->bytesconsumed = 128;
+        bytes = 128;
+    } else {
+        faad_initbits(&ld, buffer, buffer_size);
+        if (ld.error == 0)
+        {
+            if (hDecoder->adts_header_present)
+            {
+                adts_header adts;
+
+                adts.old_format = hDecoder->config.useOldADTSFormat;
+                hInfo->error = adts_frame(&adts, &ld);
+            }
+
+            if (hInfo->error == 0)
+                hInfo->error = raw_data_block_parse(hDecoder, &ld, frame, grow);
+
+            /* the element records could not be added */
+            if (hInfo->error == 34)
+                return 0;
+
+            bytes = bit2byte(faad_get_processed_bits(&ld));
+            if (hInfo->error == 0)
+                hInfo->bytesconsumed = bytes;
+            faad_endbits(&ld);
+        }
+    }
+
+    /* the synthesis stage reads at most up to where the parsing went,
+       the last bits may only have been looked at */
+    size = (uint32_t)min(buffer_size, (unsigned long)bytes + 8);
+    if (size > frame->data_alloc)
+    {
+        hInfo->error = 14;
+        hInfo->bytesconsumed = 0;
+        frame->ele_count = 0;
+        size = frame->data_alloc;
+    }
+    memcpy(frame->data, buffer, size);
+    frame->data_size = size;
+    frame->error = hInfo->error;
+
+    return 1;
+}
+
 static void* aac_frame_decode(NeAACDecStruct *hDecoder,
                               NeAACDecFrameInfo *hInfo,
                               unsigned char *buffer,
@@ -859,6 +1697,7 @@ static void* aac_frame_decode(NeAACDecStruct *hDecoder,
     uint32_t bitsconsumed;
     uint16_t frame_len;
     void *sample_buffer;
+    real_t **input;
 #if 0
     uint32_t startbit=0, endbit=0, payload_bits=0;
 #endif
@@ -921,13 +1760,12 @@ static void* aac_frame_decode(NeAACDecStruct *hDecoder,
         int i;
         for (i = 0; i < ((buffer_size+3)>>2); i++)
         {
-            uint8_t *buf;
+            uint8_t buf[5];
             uint32_t temp = 0;
-            buf = faad_getbitbuffer(&ld, 32);
+            faad_getbitbuffer(&ld, buf, 32);
             //temp = getdword((void*)buf);
             temp = *((uint32_t*)buf);
             printf("0x%.8X\n", temp);
-            free(buf);
         }
         faad_endbits(&ld);
         faad_initbits(&ld, buffer, buffer_size);
@@ -992,6 +1830,16 @@ static void* aac_frame_decode(NeAACDecStruct *hDecoder,
     }
 #endif
 
+#ifdef SBR_DEC
+    /* SBR of the elements of this frame, on the worker pool */
+    if (hDecoder->pool != NULL)
+    {
+        uint8_t sbr_error = sbr_decode_elements(hDecoder);
+        if (hInfo->error == 0)
+            hInfo->error = sbr_error;
+    }
+#endif
+
 #if 0
     if(hDecoder->latm_header_present)
     {
@@ -1044,18 +1892,16 @@ static void* aac_frame_decode(NeAACDecStruct *hDecoder,
             hDecoder->channelConfiguration = 0;
     }
 
-    if ((channels == 5 || channels == 6) && hDecoder->config.downMatrix)
-    {
-        hDecoder->downMatrix = 1;
-        output_channels = 2;
-    } else {
+    /* downmix from NeAACDecSetDownmixMatrix or the downMatrix mode */
+    output_channels = downmix_setup(hDecoder, channels);
+    hDecoder->downMatrix = (output_channels != 0);
+    if (!hDecoder->downMatrix)
         output_channels = channels;
-    }
 
 #if (defined(PS_DEC) || defined(DRM_PS))
     hDecoder->upMatrix = 0;
     /* check if we have a mono file */
-    if (output_channels == 1)
+    if ((output_channels == 1) && !hDecoder->downMatrix)
     {
         /* upMatrix to 2 channels for implicit signalling of PS */
         hDecoder->upMatrix = 1;
@@ -1112,38 +1958,79 @@ static void* aac_frame_decode(NeAACDecStruct *hDecoder,
             sizeof(int16_t), sizeof(int16_t), 0, 0, 0
         };
         uint8_t stride = str[hDecoder->config.outputFormat-1];
+        uint16_t out_len = frame_len;
+        uint32_t out_rate = get_sample_rate(hDecoder->sf_index);
 #ifdef SBR_DEC
         if (((hDecoder->sbr_present_flag == 1)&&(!hDecoder->downSampledSBR)) || (hDecoder->forceUpSampling == 1))
         {
-            stride = 2 * stride;
+            out_len *= 2;
+            out_rate *= 2;
         }
 #endif
-        required_buffer_size = frame_len*output_channels*stride;
-    }
-
-    /* check if we want to use internal sample_buffer */
-    if (sample_buffer_size == 0)
-    {
-        /* allocate the buffer for the final samples */
-        if (hDecoder->sample_buffer_size != required_buffer_size) 
+#ifndef FIXED_POINT
+        /* the output holds the longest frame of the rate conversion */
+        out_len = resample_setup(hDecoder, channels, out_rate, out_len);
+        if (out_len == 0)
         {
-            if (hDecoder->sample_buffer)
-                faad_free(hDecoder->sample_buffer);
-            hDecoder->sample_buffer = NULL;
-            hDecoder->sample_buffer = faad_malloc(required_buffer_size);
-            hDecoder->sample_buffer_size = required_buffer_size;
+            hInfo->error = 38;
+            goto error;
         }
-    } else if (sample_buffer_size < required_buffer_size) {
-        /* provided sample buffer is not big enough */
-        hInfo->error = 27;
-        return NULL;
+#else
+        (void)out_rate;
+#endif
+        required_buffer_size = out_len*output_channels*stride;
     }
 
-    if (sample_buffer_size == 0)
+    if (hDecoder->output_layout == OUTPUT_TIME_OUT)
     {
-        sample_buffer = hDecoder->sample_buffer;
+        /* a downmix can not be handed out without computing it */
+        if (hDecoder->downMatrix)
+        {
+            hInfo->error = 37;
+            return NULL;
+        }
+        sample_buffer = (void*)hDecoder->time_out_ref;
+    } else if (hDecoder->output_layout == OUTPUT_PLANAR) {
+        /* every channel buffer must hold the whole frame */
+        if ((output_channels > hDecoder->planar_channels) ||
+            (sample_buffer_size < required_buffer_size/output_channels))
+        {
+            hInfo->error = 27;
+            return NULL;
+        }
+        sample_buffer = (void*)hDecoder->planar_buffer;
     } else {
-        sample_buffer = *sample_buffer2;
+        /* check if we want to use internal sample_buffer */
+        if (sample_buffer_size == 0)
+        {
+            /* allocate the buffer for the final samples,
+               a preallocated one is kept as long as it is big enough */
+            if ((hDecoder->sample_buffer_size != required_buffer_size) &&
+                ((hDecoder->prealloc_channels == 0) || (hDecoder->sample_buffer_size < required_buffer_size)))
+            {
+                if (hDecoder->sample_buffer)
+                    faad_free(&hDecoder->alloc, hDecoder->sample_buffer);
+                hDecoder->sample_buffer_size = 0;
+                hDecoder->sample_buffer = faad_malloc(&hDecoder->alloc, required_buffer_size);
+                if (hDecoder->sample_buffer == NULL)
+                {
+                    hInfo->error = 39;
+                    goto error;
+                }
+                hDecoder->sample_buffer_size = required_buffer_size;
+            }
+        } else if (sample_buffer_size < required_buffer_size) {
+            /* provided sample buffer is not big enough */
+            hInfo->error = 27;
+            return NULL;
+        }
+
+        if (sample_buffer_size == 0)
+        {
+            sample_buffer = hDecoder->sample_buffer;
+        } else {
+            sample_buffer = *sample_buffer2;
+        }
     }
 
 #ifdef SBR_DEC
@@ -1184,9 +2071,35 @@ static void* aac_frame_decode(NeAACDecStruct *hDecoder,
     }
 #endif
 
+    input = hDecoder->time_out;
+#ifndef FIXED_POINT
+    /* sample rate conversion of the decoded channels */
+    if (hDecoder->resample != NULL)
+    {
+        frame_len = resample_frame(hDecoder->resample, hDecoder->time_out, frame_len);
+        input = hDecoder->resample->out;
+        hInfo->samples = frame_len*output_channels;
+        hInfo->samplerate = hDecoder->resample->out_rate;
+    }
+#endif
 
-    sample_buffer = output_to_PCM(hDecoder, hDecoder->time_out, sample_buffer,
-        output_channels, frame_len, hDecoder->config.outputFormat);
+    if (hDecoder->output_layout == OUTPUT_TIME_OUT)
+    {
+        /* no copy, the channels are the filterbank or rate conversion
+           output itself */
+        for (i = 0; i < output_channels; i++)
+        {
+            hDecoder->time_out_ref[i] =
+                input[hDecoder->internal_channel[hDecoder->upMatrix ? 0 : i]];
+        }
+    } else if (hDecoder->output_layout == OUTPUT_PLANAR) {
+        sample_buffer = output_to_PCM_planar(hDecoder, input,
+            (void**)sample_buffer, output_channels, frame_len,
+            hDecoder->config.outputFormat);
+    } else {
+        sample_buffer = output_to_PCM(hDecoder, input, sample_buffer,
+            output_channels, frame_len, hDecoder->config.outputFormat);
+    }
 
 
 #ifdef DRM
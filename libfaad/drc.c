@@ -35,9 +35,11 @@
 #include "syntax.h"
 #include "drc.h"
 
-drc_info *drc_init(real_t cut, real_t boost)
+drc_info *drc_init(allocator_info *alloc, real_t cut, real_t boost)
 {
-    drc_info *drc = (drc_info*)faad_malloc(sizeof(drc_info));
+    drc_info *drc = (drc_info*)faad_malloc(alloc, sizeof(drc_info));
+    if (drc == NULL)
+        return NULL;
     memset(drc, 0, sizeof(drc_info));
 
     drc->ctrl1 = cut;
@@ -51,9 +53,9 @@ drc_info *drc_init(real_t cut, real_t boost)
     return drc;
 }
 
-void drc_end(drc_info *drc)
+void drc_end(allocator_info *alloc, drc_info *drc)
 {
-    if (drc) faad_free(drc);
+    if (drc) faad_free(alloc, drc);
 }
 
 #ifdef FIXED_POINT
@@ -119,12 +121,13 @@ void drc_decode(drc_info *drc, real_t *spec)
 #endif
     uint16_t bottom = 0;
 
-    if (drc->num_bands == 1)
-        drc->band_top[0] = 1024/4 - 1;
-
+    /* drc is only read here, both channels of a CPE can use it at once */
     for (bd = 0; bd < drc->num_bands; bd++)
     {
-        top = 4 * (drc->band_top[bd] + 1);
+        if (drc->num_bands == 1)
+            top = 1024;
+        else
+            top = 4 * (drc->band_top[bd] + 1);
 
 #ifndef FIXED_POINT
         /* Decode DRC gain factor */
@@ -38,8 +38,8 @@ extern "C" {
 #define DRC_REF_LEVEL 20*4 /* -20 dB */
 
 
-drc_info *drc_init(real_t cut, real_t boost);
-void drc_end(drc_info *drc);
+drc_info *drc_init(allocator_info *alloc, real_t cut, real_t boost);
+void drc_end(allocator_info *alloc, drc_info *drc);
 void drc_decode(drc_info *drc, real_t *spec);
 
 
@@ -65,6 +65,12 @@ char *err_msg[] = {
     "No standard extension payload allowed in DRM",
     "PCE shall be the first element in a frame",
     "Bitstream value not allowed by specification",
-	"MAIN prediction not initialised"
+	"MAIN prediction not initialised",
+    "Parsed frame queue is full",
+    "No parsed frame to synthesize",
+    "Split parse and synthesis not available for DRM",
+    "Zero-copy output not available with downmatrix or fixed point",
+    "Output sample rate conversion not possible between these rates",
+    "Memory allocation failed"
 };
 
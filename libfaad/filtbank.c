@@ -44,24 +44,39 @@
 #include "sine_win.h"
 #include "mdct.h"
 
+#ifdef USE_SSE
+#include <xmmintrin.h>
+#endif
+
 
-fb_info *filter_bank_init(uint16_t frame_len)
+fb_info *filter_bank_init(allocator_info *alloc, uint16_t frame_len)
 {
     uint16_t nshort = frame_len/8;
 #ifdef LD_DEC
     uint16_t frame_len_ld = frame_len/2;
 #endif
 
-    fb_info *fb = (fb_info*)faad_malloc(sizeof(fb_info));
+    fb_info *fb = (fb_info*)faad_malloc(alloc, sizeof(fb_info));
+    if (fb == NULL)
+        return NULL;
     memset(fb, 0, sizeof(fb_info));
 
     /* normal */
-    fb->mdct256 = faad_mdct_init(2*nshort);
-    fb->mdct2048 = faad_mdct_init(2*frame_len);
+    fb->mdct256 = faad_mdct_init(alloc, 2*nshort);
+    fb->mdct2048 = faad_mdct_init(alloc, 2*frame_len);
 #ifdef LD_DEC
     /* LD */
-    fb->mdct1024 = faad_mdct_init(2*frame_len_ld);
+    fb->mdct1024 = faad_mdct_init(alloc, 2*frame_len_ld);
+#endif
+    if ((fb->mdct256 == NULL) || (fb->mdct2048 == NULL)
+#ifdef LD_DEC
+        || (fb->mdct1024 == NULL)
 #endif
+        )
+    {
+        filter_bank_end(alloc, fb);
+        return NULL;
+    }
 
 #ifdef ALLOW_SMALL_FRAMELENGTH
     if (frame_len == 1024)
@@ -88,10 +103,14 @@ fb_info *filter_bank_init(uint16_t frame_len)
     }
 #endif
 
+#ifdef USE_SSE
+    fb->sse = cpu_has_sse();
+#endif
+
     return fb;
 }
 
-void filter_bank_end(fb_info *fb)
+void filter_bank_end(allocator_info *alloc, fb_info *fb)
 {
     if (fb != NULL)
     {
@@ -99,40 +118,98 @@ void filter_bank_end(fb_info *fb)
         printf("FB:                 %I64d cycles\n", fb->cycles);
 #endif
 
-        faad_mdct_end(fb->mdct256);
-        faad_mdct_end(fb->mdct2048);
+        faad_mdct_end(alloc, fb->mdct256);
+        faad_mdct_end(alloc, fb->mdct2048);
 #ifdef LD_DEC
-        faad_mdct_end(fb->mdct1024);
+        faad_mdct_end(alloc, fb->mdct1024);
 #endif
 
-        faad_free(fb);
+        faad_free(alloc, fb);
     }
 }
 
-static INLINE void imdct_long(fb_info *fb, real_t *in_data, real_t *out_data, uint16_t len)
+static INLINE mdct_info *long_mdct(fb_info *fb, uint16_t len)
 {
 #ifdef LD_DEC
-    mdct_info *mdct = NULL;
-
     switch (len)
     {
-    case 2048:
-    case 1920:
-        mdct = fb->mdct2048;
-        break;
     case 1024:
     case 960:
-        mdct = fb->mdct1024;
-        break;
+        return fb->mdct1024;
     }
-
-    faad_imdct(mdct, in_data, out_data);
 #else
     (void)len;
-    faad_imdct(fb->mdct2048, in_data, out_data);
 #endif
+    return fb->mdct2048;
+}
+
+static INLINE void imdct_long(fb_info *fb, real_t *in_data, real_t *out_data, uint16_t len)
+{
+    faad_imdct(long_mdct(fb, len), in_data, out_data);
 }
 
+#ifdef USE_SSE
+/* window and overlap-add the eight short blocks of transf_buf, same as the
+ * scalar code in ifilter_bank, four samples at a time */
+static SSE_TARGET void eight_short_ola_sse(const real_t *transf_buf, real_t *time_out,
+                                           real_t *overlap, const real_t *window_short,
+                                           const real_t *window_short_prev, uint16_t nlong)
+{
+    uint16_t i, w;
+    uint16_t nshort = nlong/8;
+    uint16_t trans = nshort/2;
+    uint16_t nflat_ls = (nlong-nshort)/2;
+
+    for (i = 0; i < nflat_ls; i++)
+        time_out[i] = overlap[i];
+
+    for (i = 0; i < nshort; i += 4)
+    {
+        __m128 rise = _mm_loadu_ps(&window_short[i]);
+        __m128 fall = _mm_loadu_ps(&window_short[nshort-4-i]);
+        __m128 t[16], sum;
+
+        fall = _mm_shuffle_ps(fall, fall, _MM_SHUFFLE(0,1,2,3));
+
+        for (w = 0; w < 16; w++)
+            t[w] = _mm_loadu_ps(&transf_buf[nshort*w+i]);
+
+        /* overlap[nflat_ls+i] is overwritten below, so read it first */
+        sum = _mm_add_ps(_mm_loadu_ps(&overlap[nflat_ls+i]),
+            _mm_mul_ps(t[0], _mm_loadu_ps(&window_short_prev[i])));
+        _mm_storeu_ps(&time_out[nflat_ls+i], sum);
+
+        for (w = 1; w < 4; w++)
+        {
+            sum = _mm_add_ps(_mm_loadu_ps(&overlap[nflat_ls+w*nshort+i]),
+                _mm_mul_ps(t[2*w-1], fall));
+            sum = _mm_add_ps(sum, _mm_mul_ps(t[2*w], rise));
+            _mm_storeu_ps(&time_out[nflat_ls+w*nshort+i], sum);
+        }
+
+        if (i < trans)
+        {
+            sum = _mm_add_ps(_mm_loadu_ps(&overlap[nflat_ls+4*nshort+i]),
+                _mm_mul_ps(t[7], fall));
+            sum = _mm_add_ps(sum, _mm_mul_ps(t[8], rise));
+            _mm_storeu_ps(&time_out[nflat_ls+4*nshort+i], sum);
+        } else {
+            sum = _mm_add_ps(_mm_mul_ps(t[7], fall), _mm_mul_ps(t[8], rise));
+            _mm_storeu_ps(&overlap[nflat_ls+4*nshort+i-nlong], sum);
+        }
+
+        for (w = 5; w < 8; w++)
+        {
+            sum = _mm_add_ps(_mm_mul_ps(t[2*w-1], fall), _mm_mul_ps(t[2*w], rise));
+            _mm_storeu_ps(&overlap[nflat_ls+w*nshort+i-nlong], sum);
+        }
+        _mm_storeu_ps(&overlap[nflat_ls+8*nshort+i-nlong], _mm_mul_ps(t[15], fall));
+    }
+
+    for (i = 0; i < nflat_ls; i++)
+        overlap[nflat_ls+nshort+i] = 0;
+}
+#endif
 
 #ifdef LTP_DEC
 static INLINE void mdct(fb_info *fb, real_t *in_data, real_t *out_data, uint16_t len)
@@ -167,7 +244,8 @@ void ifilter_bank(fb_info *fb, uint8_t window_sequence, uint8_t window_shape,
                   uint8_t object_type, uint16_t frame_len)
 {
     int16_t i;
-    ALIGN real_t transf_buf[2*1024] = {0};
+    ALIGN real_t transf_buf[2*1024];
+    imdct_ola ola;
 
     const real_t *window_long = NULL;
     const real_t *window_long_prev = NULL;
@@ -216,26 +294,14 @@ void ifilter_bank(fb_info *fb, uint8_t window_sequence, uint8_t window_shape,
     switch (window_sequence)
     {
     case ONLY_LONG_SEQUENCE:
-        /* perform iMDCT */
-        imdct_long(fb, freq_in, transf_buf, 2*nlong);
-
-        /* add second half output of previous frame to windowed output of current frame */
-        for (i = 0; i < nlong; i+=4)
-        {
-            time_out[i]   = overlap[i]   + MUL_F(transf_buf[i],window_long_prev[i]);
-            time_out[i+1] = overlap[i+1] + MUL_F(transf_buf[i+1],window_long_prev[i+1]);
-            time_out[i+2] = overlap[i+2] + MUL_F(transf_buf[i+2],window_long_prev[i+2]);
-            time_out[i+3] = overlap[i+3] + MUL_F(transf_buf[i+3],window_long_prev[i+3]);
-        }
-
-        /* window the second half and save as overlap for next frame */
-        for (i = 0; i < nlong; i+=4)
-        {
-            overlap[i]   = MUL_F(transf_buf[nlong+i],window_long[nlong-1-i]);
-            overlap[i+1] = MUL_F(transf_buf[nlong+i+1],window_long[nlong-2-i]);
-            overlap[i+2] = MUL_F(transf_buf[nlong+i+2],window_long[nlong-3-i]);
-            overlap[i+3] = MUL_F(transf_buf[nlong+i+3],window_long[nlong-4-i]);
-        }
+        /* perform iMDCT, add second half output of previous frame to the
+         * windowed first half and save the windowed second half as overlap
+         * for next frame, all in the IMDCT output loop */
+        ola.time_out = time_out;
+        ola.overlap = overlap;
+        ola.window_prev = window_long_prev;
+        ola.window = window_long;
+        faad_imdct_ola(long_mdct(fb, 2*nlong), freq_in, &ola);
         break;
 
     case LONG_START_SEQUENCE:
@@ -272,6 +338,15 @@ void ifilter_bank(fb_info *fb, uint8_t window_sequence, uint8_t window_shape,
         faad_imdct(fb->mdct256, freq_in+6*nshort, transf_buf+2*nshort*6);
         faad_imdct(fb->mdct256, freq_in+7*nshort, transf_buf+2*nshort*7);
 
+#ifdef USE_SSE
+        if (fb->sse)
+        {
+            eight_short_ola_sse(transf_buf, time_out, overlap, window_short,
+                window_short_prev, nlong);
+            break;
+        }
+#endif
+
         /* add second half output of previous frame to windowed output of current frame */
         for (i = 0; i < nflat_ls; i++)
             time_out[i] = overlap[i];
@@ -36,8 +36,8 @@ extern "C" {
 #endif
 
 
-fb_info *filter_bank_init(uint16_t frame_len);
-void filter_bank_end(fb_info *fb);
+fb_info *filter_bank_init(allocator_info *alloc, uint16_t frame_len);
+void filter_bank_end(allocator_info *alloc, fb_info *fb);
 
 #ifdef LTP_DEC
 void filter_bank_ltp(fb_info *fb,
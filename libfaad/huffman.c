@@ -82,6 +82,10 @@ static const hcb_2_pair* hcb_2_pair_table[LAST_CB_IDX + 1] =
 {NULL,   NULL,   NULL, NULL,   NULL, NULL, hcb6_2, NULL, hcb8_2, NULL, hcb10_2, hcb11_2};
 static const hcb_bin_pair* hcb_bin_table[LAST_CB_IDX + 1] =
 {NULL,   NULL,   NULL, NULL,   NULL, hcb5,   NULL, hcb7,   NULL, hcb9,    NULL,    NULL};
+static const hcb_lut_quad* hcb_lut_quad_table[LAST_CB_IDX + 1] =
+{NULL, hcb1_lut, hcb2_lut, hcb3_lut, hcb4_lut, NULL, NULL, NULL, NULL, NULL, NULL, NULL};
+static const hcb_lut_pair* hcb_lut_pair_table[LAST_CB_IDX + 1] =
+{NULL, NULL, NULL, NULL, NULL, hcb5_lut, hcb6_lut, hcb7_lut, hcb8_lut, hcb9_lut, hcb10_lut, hcb11_lut};
 /*                     hcb3 is the unique case */
 
 /* defines whether a huffman codebook is unsigned or not */
@@ -397,6 +401,93 @@ uint8_t huffman_spectral_data(uint8_t cb, bitfile *ld, int16_t *sp)
     /* return 0; */
 }
 
+/* Decode the len spectral values of a section coded with codebook cb.
+ * Codewords of at most HCB_LUT_BITS bits (in most cases together with
+ * their sign bits) take a single table lookup, longer ones go through
+ * huffman_spectral_data(). */
+uint8_t huffman_spectral_section(uint8_t cb, bitfile *ld, int16_t *sp, uint16_t len)
+{
+    uint16_t k;
+    uint8_t err;
+
+    switch (cb)
+    {
+    case 1: /* data quadruples */
+    case 2:
+    case 3:
+    case 4:
+    {
+        const hcb_lut_quad *lut = hcb_lut_quad_table[cb];
+
+        for (k = 0; k < len; k += QUAD_LEN)
+        {
+            const hcb_lut_quad *e = &lut[faad_showbits(ld, HCB_LUT_BITS)];
+
+            if (e->bits == 0)
+            {
+                if ((err = huffman_spectral_data(cb, ld, &sp[k])) > 0)
+                    return err;
+                continue;
+            }
+
+            faad_flushbits(ld, e->bits);
+            sp[k]   = e->x;
+            sp[k+1] = e->y;
+            sp[k+2] = e->v;
+            sp[k+3] = e->w;
+            if (e->sign)
+                huffman_sign_bits(ld, &sp[k], QUAD_LEN);
+        }
+        return 0;
+    }
+    case 5: /* data pairs */
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    {
+        const hcb_lut_pair *lut = hcb_lut_pair_table[cb];
+
+        for (k = 0; k < len; k += PAIR_LEN)
+        {
+            const hcb_lut_pair *e = &lut[faad_showbits(ld, HCB_LUT_BITS)];
+
+            if (e->bits == 0)
+            {
+                if ((err = huffman_spectral_data(cb, ld, &sp[k])) > 0)
+                    return err;
+                continue;
+            }
+
+            faad_flushbits(ld, e->bits);
+            sp[k]   = e->x;
+            sp[k+1] = e->y;
+            if (e->sign)
+                huffman_sign_bits(ld, &sp[k], PAIR_LEN);
+
+            if (cb == ESC_HCB)
+            {
+                if ((err = huffman_getescape(ld, &sp[k])) > 0)
+                    return err;
+                if ((err = huffman_getescape(ld, &sp[k+1])) > 0)
+                    return err;
+            }
+        }
+        return 0;
+    }
+    default:
+        /* VCB11 and invalid codebooks */
+        for (k = 0; k < len; k += (cb >= FIRST_PAIR_HCB) ? PAIR_LEN : QUAD_LEN)
+        {
+            if ((err = huffman_spectral_data(cb, ld, &sp[k])) > 0)
+                return err;
+        }
+        return 0;
+    }
+}
+
 
 #ifdef ERROR_RESILIENCE
 
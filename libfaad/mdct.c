@@ -59,12 +59,15 @@
 #include "mdct_tab.h"
 
 
-mdct_info *faad_mdct_init(uint16_t N)
+mdct_info *faad_mdct_init(allocator_info *alloc, uint16_t N)
 {
-    mdct_info *mdct = (mdct_info*)faad_malloc(sizeof(mdct_info));
+    mdct_info *mdct = (mdct_info*)faad_malloc(alloc, sizeof(mdct_info));
 
     assert(N % 8 == 0);
 
+    if (mdct == NULL)
+        return NULL;
+
     mdct->N = N;
 
     /* NOTE: For "small framelengths" in FIXED_POINT the coefficients need to be
@@ -94,7 +97,12 @@ mdct_info *faad_mdct_init(uint16_t N)
     }
 
     /* initialise fft */
-    mdct->cfft = cffti(N/4);
+    mdct->cfft = cffti(alloc, N/4);
+    if (mdct->cfft == NULL)
+    {
+        faad_free(alloc, mdct);
+        return NULL;
+    }
 
 #ifdef PROFILE
     mdct->cycles = 0;
@@ -104,7 +112,7 @@ mdct_info *faad_mdct_init(uint16_t N)
     return mdct;
 }
 
-void faad_mdct_end(mdct_info *mdct)
+void faad_mdct_end(allocator_info *alloc, mdct_info *mdct)
 {
     if (mdct != NULL)
     {
@@ -113,17 +121,23 @@ void faad_mdct_end(mdct_info *mdct)
         printf("CFFT[%.4d]:         %I64d cycles\n", mdct->N/4, mdct->fft_cycles);
 #endif
 
-        cfftu(mdct->cfft);
+        cfftu(alloc, mdct->cfft);
 
-        faad_free(mdct);
+        faad_free(alloc, mdct);
     }
 }
 
-void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
+/* The IMDCT body. It is inlined into one function per transform size
+ * (see imdct_dispatch), so that all loop counts are constants there.
+ * With ola == NULL the N output samples go to X_out. Otherwise the first
+ * half is windowed and added to the overlap into time_out, and the second
+ * half is windowed into overlap, which saves the separate windowing pass
+ * over an N sample buffer. */
+static ALWAYS_INLINE void imdct_kernel(mdct_info *mdct, real_t *X_in, real_t *X_out,
+                                       const imdct_ola *ola, const uint16_t N)
 {
     uint16_t k;
 
-    complex_t x;
 #ifdef ALLOW_SMALL_FRAMELENGTH
 #ifdef FIXED_POINT
     real_t scale = 0, b_scale = 0;
@@ -132,10 +146,9 @@ void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
     ALIGN complex_t Z1[512];
     complex_t *sincos = mdct->sincos;
 
-    uint16_t N  = mdct->N;
-    uint16_t N2 = N >> 1;
-    uint16_t N4 = N >> 2;
-    uint16_t N8 = N >> 3;
+    const uint16_t N2 = N >> 1;
+    const uint16_t N4 = N >> 2;
+    const uint16_t N8 = N >> 3;
 
 #ifdef PROFILE
     int64_t count1, count2 = faad_get_ts();
@@ -172,52 +185,70 @@ void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
     count1 = faad_get_ts() - count1;
 #endif
 
-    /* post-IFFT complex multiplication */
-    for (k = 0; k < N4; k++)
+    /* post-IFFT complex multiplication and reordering in one loop;
+     * Z1[k], Z1[N8-1-k], Z1[N8+k] and Z1[N4-1-k] are all that the
+     * outputs at 2*k and 2*(N8-1-k) in each quarter depend on */
+    for (k = 0; k < N8/2; k++)
     {
-        RE(x) = RE(Z1[k]);
-        IM(x) = IM(Z1[k]);
-        ComplexMult(&IM(Z1[k]), &RE(Z1[k]),
-            IM(x), RE(x), RE(sincos[k]), IM(sincos[k]));
+        uint16_t m = N8 - 1 - k;
+        complex_t x, z[4];
+        uint16_t idx[4], pos[8];
+        real_t lo[8], hi[8];
+        uint8_t j;
+
+        idx[0] = k;
+        idx[1] = m;
+        idx[2] = N8 + k;
+        idx[3] = N8 + m;
+
+        for (j = 0; j < 4; j++)
+        {
+            RE(x) = RE(Z1[idx[j]]);
+            IM(x) = IM(Z1[idx[j]]);
+            ComplexMult(&IM(z[j]), &RE(z[j]),
+                IM(x), RE(x), RE(sincos[idx[j]]), IM(sincos[idx[j]]));
 
 #ifdef ALLOW_SMALL_FRAMELENGTH
 #ifdef FIXED_POINT
-        /* non-power of 2 MDCT scaling */
-        if (b_scale)
-        {
-            RE(Z1[k]) = MUL_C(RE(Z1[k]), scale);
-            IM(Z1[k]) = MUL_C(IM(Z1[k]), scale);
-        }
+            /* non-power of 2 MDCT scaling */
+            if (b_scale)
+            {
+                RE(z[j]) = MUL_C(RE(z[j]), scale);
+                IM(z[j]) = MUL_C(IM(z[j]), scale);
+            }
 #endif
 #endif
-    }
-
-    /* reordering */
-    for (k = 0; k < N8; k+=2)
-    {
-        X_out[              2*k] =  IM(Z1[N8 +     k]);
-        X_out[          2 + 2*k] =  IM(Z1[N8 + 1 + k]);
-
-        X_out[          1 + 2*k] = -RE(Z1[N8 - 1 - k]);
-        X_out[          3 + 2*k] = -RE(Z1[N8 - 2 - k]);
-
-        X_out[N4 +          2*k] =  RE(Z1[         k]);
-        X_out[N4 +    + 2 + 2*k] =  RE(Z1[     1 + k]);
-
-        X_out[N4 +      1 + 2*k] = -IM(Z1[N4 - 1 - k]);
-        X_out[N4 +      3 + 2*k] = -IM(Z1[N4 - 2 - k]);
-
-        X_out[N2 +          2*k] =  RE(Z1[N8 +     k]);
-        X_out[N2 +    + 2 + 2*k] =  RE(Z1[N8 + 1 + k]);
+        }
 
-        X_out[N2 +      1 + 2*k] = -IM(Z1[N8 - 1 - k]);
-        X_out[N2 +      3 + 2*k] = -IM(Z1[N8 - 2 - k]);
+        /* z[0] = Z1[k], z[1] = Z1[N8-1-k], z[2] = Z1[N8+k], z[3] = Z1[N4-1-k];
+         * lo[j] is the output at pos[j], hi[j] the one at N2 + pos[j] */
+        pos[0] =          2*k; lo[0] =  IM(z[2]); hi[0] =  RE(z[2]);
+        pos[1] =      1 + 2*k; lo[1] = -RE(z[1]); hi[1] = -IM(z[1]);
+        pos[2] = N4 +     2*k; lo[2] =  RE(z[0]); hi[2] = -IM(z[0]);
+        pos[3] = N4 + 1 + 2*k; lo[3] = -IM(z[3]); hi[3] =  RE(z[3]);
 
-        X_out[N2 + N4 +     2*k] = -IM(Z1[         k]);
-        X_out[N2 + N4 + 2 + 2*k] = -IM(Z1[     1 + k]);
+        /* the same with k and N8-1-k swapped */
+        pos[4] =          2*m; lo[4] =  IM(z[3]); hi[4] =  RE(z[3]);
+        pos[5] =      1 + 2*m; lo[5] = -RE(z[0]); hi[5] = -IM(z[0]);
+        pos[6] = N4 +     2*m; lo[6] =  RE(z[1]); hi[6] = -IM(z[1]);
+        pos[7] = N4 + 1 + 2*m; lo[7] = -IM(z[2]); hi[7] =  RE(z[2]);
 
-        X_out[N2 + N4 + 1 + 2*k] =  RE(Z1[N4 - 1 - k]);
-        X_out[N2 + N4 + 3 + 2*k] =  RE(Z1[N4 - 2 - k]);
+        if (ola == NULL)
+        {
+            for (j = 0; j < 8; j++)
+            {
+                X_out[pos[j]]      = lo[j];
+                X_out[N2 + pos[j]] = hi[j];
+            }
+        } else {
+            for (j = 0; j < 8; j++)
+            {
+                uint16_t p = pos[j];
+
+                ola->time_out[p] = ola->overlap[p] + MUL_F(lo[j], ola->window_prev[p]);
+                ola->overlap[p]  = MUL_F(hi[j], ola->window[N2 - 1 - p]);
+            }
+        }
     }
 
 #ifdef PROFILE
@@ -227,6 +258,37 @@ void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
 #endif
 }
 
+static ALWAYS_INLINE void imdct_dispatch(mdct_info *mdct, real_t *X_in, real_t *X_out,
+                                         const imdct_ola *ola)
+{
+    switch (mdct->N)
+    {
+    case 2048: imdct_kernel(mdct, X_in, X_out, ola, 2048); break;
+    case 256:  imdct_kernel(mdct, X_in, X_out, ola, 256);  break;
+#ifdef LD_DEC
+    case 1024: imdct_kernel(mdct, X_in, X_out, ola, 1024); break;
+#endif
+#ifdef ALLOW_SMALL_FRAMELENGTH
+    case 1920: imdct_kernel(mdct, X_in, X_out, ola, 1920); break;
+    case 240:  imdct_kernel(mdct, X_in, X_out, ola, 240);  break;
+#ifdef LD_DEC
+    case 960:  imdct_kernel(mdct, X_in, X_out, ola, 960);  break;
+#endif
+#endif
+    default:   imdct_kernel(mdct, X_in, X_out, ola, mdct->N); break;
+    }
+}
+
+void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
+{
+    imdct_dispatch(mdct, X_in, X_out, NULL);
+}
+
+void faad_imdct_ola(mdct_info *mdct, real_t *X_in, const imdct_ola *ola)
+{
+    imdct_dispatch(mdct, X_in, NULL, ola);
+}
+
 #ifdef LTP_DEC
 void faad_mdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
 {
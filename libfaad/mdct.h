@@ -36,9 +36,20 @@ extern "C" {
 #endif
 
 
-mdct_info *faad_mdct_init(uint16_t N);
-void faad_mdct_end(mdct_info *mdct);
+/* windowed overlap-add target of faad_imdct_ola */
+typedef struct
+{
+    real_t *time_out;
+    real_t *overlap;
+    const real_t *window_prev;
+    const real_t *window;
+} imdct_ola;
+
+
+mdct_info *faad_mdct_init(allocator_info *alloc, uint16_t N);
+void faad_mdct_end(allocator_info *alloc, mdct_info *mdct);
 void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out);
+void faad_imdct_ola(mdct_info *mdct, real_t *X_in, const imdct_ola *ola);
 void faad_mdct(mdct_info *mdct, real_t *X_in, real_t *X_out);
 
 
@@ -33,31 +33,202 @@
 
 #include "output.h"
 
-#ifndef FIXED_POINT
+#ifdef USE_SSE
+#include <emmintrin.h>
+#endif
 
+#define DMX_RSQRT2 0.7071067811865475244 // 1/sqrt(2)
 
-#define FLOAT_SCALE (1.0f/(1<<15))
+/* matrix-mixdown of 3/2 channels to stereo (ISO/IEC 14496-3, 4.5.1.2.2),
+   indexed by matrix_mixdown_idx: the surround gain A and the
+   normalisation 1/(1 + 1/sqrt(2) + 2*A). Index 0 is the default downmix.
+ */
+static const double dmx_a[4] = {
+    0.7071067811865475244, 0.5, 0.3535533905932737622, 0.0
+};
+static const double dmx_norm[4] = {
+    0.3203772410170407, 0.3693980625181293, 0.4142135623730950, 0.5857864376269050
+};
+
+/* stereo rows of a 5.0, 5.1 or 7.1 downmix, the side and back channels
+   of 7.1 are folded into one surround channel each at -3 dB */
+static void downmix_stereo(NeAACDecStruct *hDecoder, uint8_t channels,
+                           double m[][MAX_CHANNELS], double *g)
+{
+    uint8_t idx = 0, pseudo = 0;
+    uint8_t k, surr = (channels == 8) ? 2 : 1;
+    double a;
+
+    if (hDecoder->pce_set && hDecoder->pce.matrix_mixdown_idx_present)
+    {
+        idx = hDecoder->pce.matrix_mixdown_idx;
+        pseudo = hDecoder->pce.pseudo_surround_enable;
+    }
+    a = dmx_a[idx];
+    if (surr == 2)
+        a *= DMX_RSQRT2;
 
-#define DM_MUL REAL_CONST(0.3203772410170407) // 1/(1+sqrt(2) + 1/sqrt(2))
-#define RSQRT2 REAL_CONST(0.7071067811865475244) // 1/sqrt(2)
+    g[0] = g[1] = dmx_norm[idx];
+    m[0][0] = m[1][0] = DMX_RSQRT2;
+    m[0][1] = 1.0;
+    m[1][2] = 1.0;
+    for (k = 0; k < surr; k++)
+    {
+        uint8_t ls = 3 + 2*k, rs = 4 + 2*k;
 
+        if (pseudo)
+        {
+            /* matrix encoded surround, L gets -A*(Ls+Rs) and R +A*(Ls+Rs) */
+            m[0][ls] = m[0][rs] = -a;
+            m[1][ls] = m[1][rs] = a;
+        } else {
+            m[0][ls] = a;
+            m[1][rs] = a;
+        }
+    }
+}
 
-static INLINE real_t get_sample(real_t **input, uint8_t channel, uint16_t sample,
-                                uint8_t down_matrix, uint8_t *internal_channel)
+/* Sets up hDecoder->dmx for a frame with the given number of channels,
+   from the matrix of NeAACDecSetDownmixMatrix or the downMatrix mode.
+   Returns the number of output channels, 0 when there is no downmix.
+ */
+uint8_t downmix_setup(NeAACDecStruct *hDecoder, uint8_t channels)
 {
-    if (!down_matrix)
-        return input[internal_channel[channel]][sample];
+    double m[DMX_MAX_OUT][MAX_CHANNELS];
+    double g[DMX_MAX_OUT];
+    downmix_info *dmx = &hDecoder->dmx;
+    uint8_t o, i, out = 0;
 
-    if (channel == 0)
+    memset(m, 0, sizeof(m));
+    memset(dmx->position, UNKNOWN_CHANNEL, sizeof(dmx->position));
+
+    if (hDecoder->dmx_in_channels && (channels == hDecoder->dmx_in_channels))
     {
-        return DM_MUL * (input[internal_channel[1]][sample] +
-            input[internal_channel[0]][sample] * RSQRT2 +
-            input[internal_channel[3]][sample] * RSQRT2);
+        out = hDecoder->dmx_out_channels;
+        for (o = 0; o < out; o++)
+        {
+            g[o] = 1.0;
+            for (i = 0; i < channels; i++)
+                m[o][i] = hDecoder->dmx_matrix[o*channels + i];
+        }
     } else {
-        return DM_MUL * (input[internal_channel[2]][sample] +
-            input[internal_channel[0]][sample] * RSQRT2 +
-            input[internal_channel[4]][sample] * RSQRT2);
+        switch (hDecoder->config.downMatrix)
+        {
+        case FAAD_DMX_STEREO:
+            if ((channels == 5) || (channels == 6) || (channels == 8))
+            {
+                downmix_stereo(hDecoder, channels, m, g);
+                dmx->position[0] = FRONT_CHANNEL_LEFT;
+                dmx->position[1] = FRONT_CHANNEL_RIGHT;
+                out = 2;
+            }
+            break;
+        case FAAD_DMX_MONO:
+            if (channels == 1)
+            {
+                /* stays mono instead of the stereo output for PS */
+                g[0] = 1.0;
+                m[0][0] = 1.0;
+                dmx->position[0] = FRONT_CHANNEL_CENTER;
+                out = 1;
+            } else if ((channels == 2) || (channels == 5) || (channels == 6) || (channels == 8)) {
+                /* average of the stereo downmix */
+                if (channels == 2)
+                {
+                    g[0] = 1.0;
+                    m[0][0] = 1.0;
+                    m[1][1] = 1.0;
+                } else {
+                    downmix_stereo(hDecoder, channels, m, g);
+                }
+                g[0] *= 0.5;
+                for (i = 0; i < channels; i++)
+                    m[0][i] += m[1][i];
+                dmx->position[0] = FRONT_CHANNEL_CENTER;
+                out = 1;
+            }
+            break;
+        case FAAD_DMX_5_1:
+            if (channels == 8)
+            {
+                static const uint8_t pos[6] = {
+                    FRONT_CHANNEL_CENTER, FRONT_CHANNEL_LEFT, FRONT_CHANNEL_RIGHT,
+                    BACK_CHANNEL_LEFT, BACK_CHANNEL_RIGHT, LFE_CHANNEL
+                };
+
+                /* side and back channels are folded together at -3 dB */
+                for (o = 0; o < 6; o++)
+                {
+                    g[o] = 1.0;
+                    dmx->position[o] = pos[o];
+                }
+                m[0][0] = m[1][1] = m[2][2] = m[5][7] = 1.0;
+                m[3][3] = m[3][5] = DMX_RSQRT2;
+                m[4][4] = m[4][6] = DMX_RSQRT2;
+                out = 6;
+            }
+            break;
+        }
     }
+
+    /* keep the non zero gains only, in input channel order */
+    for (o = 0; o < out; o++)
+    {
+        uint8_t k = 0;
+
+        for (i = 0; i < channels; i++)
+        {
+            if (m[o][i] == 0.0)
+                continue;
+
+            dmx->in[o][k] = hDecoder->internal_channel[i];
+#ifndef FIXED_POINT
+            dmx->coef[o][k] = (real_t)m[o][i];
+#else
+            {
+                double c = g[o] * m[o][i];
+
+                if (c >= 1.0)
+                    dmx->coef[o][k] = FRAC_CONST(1.0);
+                else if (c <= -1.0)
+                    dmx->coef[o][k] = -FRAC_CONST(1.0);
+                else
+                    dmx->coef[o][k] = FRAC_CONST(c);
+            }
+#endif
+            k++;
+        }
+        dmx->terms[o] = k;
+#ifndef FIXED_POINT
+        dmx->gain[o] = (real_t)g[o];
+#else
+        dmx->gain[o] = FRAC_CONST(1.0);
+#endif
+    }
+    dmx->out_channels = out;
+
+    return out;
+}
+
+#ifndef FIXED_POINT
+
+
+#define FLOAT_SCALE (1.0f/(1<<15))
+
+static INLINE real_t get_sample(NeAACDecStruct *hDecoder, real_t **input,
+                                uint8_t channel, uint16_t sample)
+{
+    const downmix_info *dmx = &hDecoder->dmx;
+    real_t acc = 0;
+    uint8_t k;
+
+    if (!hDecoder->downMatrix)
+        return input[hDecoder->internal_channel[channel]][sample];
+
+    for (k = 0; k < dmx->terms[channel]; k++)
+        acc += dmx->coef[channel][k] * input[dmx->in[channel][k]][sample];
+
+    return acc * dmx->gain[channel];
 }
 
 #ifndef HAS_LRINTF
@@ -96,7 +267,6 @@ static void to_PCM_16bit(NeAACDecStruct *hDecoder, real_t **input,
     switch (CONV(channels,hDecoder->downMatrix))
     {
     case CONV(1,0):
-    case CONV(1,1):
         for(i = 0; i < frame_len; i++)
         {
             real_t inp = input[hDecoder->internal_channel[0]][i];
@@ -140,7 +310,7 @@ static void to_PCM_16bit(NeAACDecStruct *hDecoder, real_t **input,
         {
             for(i = 0; i < frame_len; i++)
             {
-                real_t inp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                real_t inp = get_sample(hDecoder, input, ch, i);
 
                 CLIP(inp, 32767.0f, -32768.0f);
 
@@ -161,7 +331,6 @@ static void to_PCM_24bit(NeAACDecStruct *hDecoder, real_t **input,
     switch (CONV(channels,hDecoder->downMatrix))
     {
     case CONV(1,0):
-    case CONV(1,1):
         for(i = 0; i < frame_len; i++)
         {
             real_t inp = input[hDecoder->internal_channel[0]][i];
@@ -209,7 +378,7 @@ static void to_PCM_24bit(NeAACDecStruct *hDecoder, real_t **input,
         {
             for(i = 0; i < frame_len; i++)
             {
-                real_t inp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                real_t inp = get_sample(hDecoder, input, ch, i);
 
                 inp *= 256.0f;
                 CLIP(inp, 8388607.0f, -8388608.0f);
@@ -231,7 +400,6 @@ static void to_PCM_32bit(NeAACDecStruct *hDecoder, real_t **input,
     switch (CONV(channels,hDecoder->downMatrix))
     {
     case CONV(1,0):
-    case CONV(1,1):
         for(i = 0; i < frame_len; i++)
         {
             real_t inp = input[hDecoder->internal_channel[0]][i];
@@ -279,7 +447,7 @@ static void to_PCM_32bit(NeAACDecStruct *hDecoder, real_t **input,
         {
             for(i = 0; i < frame_len; i++)
             {
-                real_t inp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                real_t inp = get_sample(hDecoder, input, ch, i);
 
                 inp *= 65536.0f;
                 CLIP(inp, 2147483647.0f, -2147483648.0f);
@@ -301,7 +469,6 @@ static void to_PCM_float(NeAACDecStruct *hDecoder, real_t **input,
     switch (CONV(channels,hDecoder->downMatrix))
     {
     case CONV(1,0):
-    case CONV(1,1):
         for(i = 0; i < frame_len; i++)
         {
             real_t inp = input[hDecoder->internal_channel[0]][i];
@@ -335,7 +502,7 @@ static void to_PCM_float(NeAACDecStruct *hDecoder, real_t **input,
         {
             for(i = 0; i < frame_len; i++)
             {
-                real_t inp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                real_t inp = get_sample(hDecoder, input, ch, i);
                 (*sample_buffer)[(i*channels)+ch] = inp*FLOAT_SCALE;
             }
         }
@@ -353,7 +520,6 @@ static void to_PCM_double(NeAACDecStruct *hDecoder, real_t **input,
     switch (CONV(channels,hDecoder->downMatrix))
     {
     case CONV(1,0):
-    case CONV(1,1):
         for(i = 0; i < frame_len; i++)
         {
             real_t inp = input[hDecoder->internal_channel[0]][i];
@@ -387,7 +553,7 @@ static void to_PCM_double(NeAACDecStruct *hDecoder, real_t **input,
         {
             for(i = 0; i < frame_len; i++)
             {
-                real_t inp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                real_t inp = get_sample(hDecoder, input, ch, i);
                 (*sample_buffer)[(i*channels)+ch] = (double)inp*FLOAT_SCALE;
             }
         }
@@ -395,6 +561,285 @@ static void to_PCM_double(NeAACDecStruct *hDecoder, real_t **input,
     }
 }
 
+static INLINE int16_t pcm_16bit(real_t inp)
+{
+    CLIP(inp, 32767.0f, -32768.0f);
+    return (int16_t)lrintf(inp);
+}
+
+static INLINE int32_t pcm_24bit(real_t inp)
+{
+    inp *= 256.0f;
+    CLIP(inp, 8388607.0f, -8388608.0f);
+    return (int32_t)lrintf(inp);
+}
+
+static INLINE int32_t pcm_32bit(real_t inp)
+{
+    inp *= 65536.0f;
+    CLIP(inp, 2147483647.0f, -2147483648.0f);
+    return (int32_t)lrintf(inp);
+}
+
+/* Planar output, every channel goes to its own buffer. Without downmatrix
+   the source channel is converted in a single pass, otherwise the stereo
+   downmix is computed per sample as in the interleaved case.
+ */
+#define PLANAR_LOOP(type, conv)                                               \
+{                                                                             \
+    type *out = (type*)sample_buffer[ch];                                     \
+    if (inp != NULL)                                                          \
+    {                                                                         \
+        for(i = 0; i < frame_len; i++)                                        \
+            out[i] = conv(inp[i]);                                            \
+    } else {                                                                  \
+        for(i = 0; i < frame_len; i++)                                        \
+            out[i] = conv(get_sample(hDecoder, input, ch, i));                \
+    }                                                                         \
+}
+
+#define PCM_FLOAT(a) ((a)*FLOAT_SCALE)
+#define PCM_DOUBLE(a) ((double)(a)*FLOAT_SCALE)
+
+void **output_to_PCM_planar(NeAACDecStruct *hDecoder,
+                            real_t **input, void **sample_buffer, uint8_t channels,
+                            uint16_t frame_len, uint8_t format)
+{
+    uint8_t ch;
+    uint16_t i;
+
+#ifdef PROFILE
+    int64_t count = faad_get_ts();
+#endif
+
+    for (ch = 0; ch < channels; ch++)
+    {
+        real_t *inp = NULL;
+
+        if (!hDecoder->downMatrix)
+            inp = input[hDecoder->internal_channel[hDecoder->upMatrix ? 0 : ch]];
+
+        switch (format)
+        {
+        case FAAD_FMT_16BIT:
+            PLANAR_LOOP(int16_t, pcm_16bit)
+            break;
+        case FAAD_FMT_24BIT:
+            PLANAR_LOOP(int32_t, pcm_24bit)
+            break;
+        case FAAD_FMT_32BIT:
+            PLANAR_LOOP(int32_t, pcm_32bit)
+            break;
+        case FAAD_FMT_FLOAT:
+            PLANAR_LOOP(float32_t, PCM_FLOAT)
+            break;
+        case FAAD_FMT_DOUBLE:
+            PLANAR_LOOP(double, PCM_DOUBLE)
+            break;
+        }
+    }
+
+#ifdef PROFILE
+    count = faad_get_ts() - count;
+    hDecoder->output_cycles += count;
+#endif
+
+    return sample_buffer;
+}
+
+#ifdef USE_SSE
+/* converts 4 values to int32, rounding as lrintf() does, or as CLIP() does
+   when lrintf() is a cast */
+#ifdef HAS_LRINTF
+#define SSE_ROUND(a) _mm_cvtps_epi32(a)
+#else
+#define SSE_ROUND(a) _mm_cvttps_epi32(_mm_add_ps(a, \
+    _mm_or_ps(_mm_and_ps(a, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f))))
+#endif
+
+/* Writes 4+n_hi consecutive output values starting at value pos; lo holds
+   the first 4, hi the remaining 0, 2 or 4. Gives the same results as the
+   scalar CLIP() and lrintf() code.
+ */
+static INLINE SSE2_TARGET void store_sse2(void *sample_buffer, uint32_t pos,
+                                          __m128 lo, __m128 hi, uint8_t n_hi,
+                                          uint8_t format)
+{
+    switch (format)
+    {
+    case FAAD_FMT_16BIT:
+        {
+            /* only the upper clip is needed, negative overflow converts
+               to 0x80000000 which the saturating pack turns into -32768 */
+            const __m128 max = _mm_set1_ps(32767.0f);
+            int16_t *out = (int16_t*)sample_buffer + pos;
+            __m128i v = _mm_packs_epi32(SSE_ROUND(_mm_min_ps(lo, max)),
+                SSE_ROUND(_mm_min_ps(hi, max)));
+
+            if (n_hi == 4)
+            {
+                _mm_storeu_si128((__m128i*)out, v);
+            } else {
+                _mm_storel_epi64((__m128i*)out, v);
+                if (n_hi == 2)
+                {
+                    int32_t t = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+                    memcpy(out + 4, &t, sizeof(t));
+                }
+            }
+        }
+        break;
+    case FAAD_FMT_24BIT:
+    case FAAD_FMT_32BIT:
+        {
+            __m128i vlo, vhi;
+            int32_t *out = (int32_t*)sample_buffer + pos;
+
+            if (format == FAAD_FMT_24BIT)
+            {
+                const __m128 scale = _mm_set1_ps(256.0f);
+                const __m128 max = _mm_set1_ps(8388607.0f);
+                const __m128 min = _mm_set1_ps(-8388608.0f);
+                vlo = SSE_ROUND(_mm_max_ps(_mm_min_ps(_mm_mul_ps(lo, scale), max), min));
+                vhi = SSE_ROUND(_mm_max_ps(_mm_min_ps(_mm_mul_ps(hi, scale), max), min));
+            } else {
+                /* the scalar clip to +-2^31 converts to 0x80000000 as
+                   any out of range value does here */
+                const __m128 scale = _mm_set1_ps(65536.0f);
+                vlo = SSE_ROUND(_mm_mul_ps(lo, scale));
+                vhi = SSE_ROUND(_mm_mul_ps(hi, scale));
+            }
+
+            _mm_storeu_si128((__m128i*)out, vlo);
+            if (n_hi == 4)
+                _mm_storeu_si128((__m128i*)(out + 4), vhi);
+            else if (n_hi == 2)
+                _mm_storel_epi64((__m128i*)(out + 4), vhi);
+        }
+        break;
+    case FAAD_FMT_FLOAT:
+        {
+            const __m128 scale = _mm_set1_ps(FLOAT_SCALE);
+            float32_t *out = (float32_t*)sample_buffer + pos;
+
+            _mm_storeu_ps(out, _mm_mul_ps(lo, scale));
+            if (n_hi == 4)
+                _mm_storeu_ps(out + 4, _mm_mul_ps(hi, scale));
+            else if (n_hi == 2)
+                _mm_storel_pi((__m64*)(out + 4), _mm_mul_ps(hi, scale));
+        }
+        break;
+    }
+}
+
+/* 4 samples of downmix output channel o, summed in the same order as
+   get_sample() */
+static INLINE SSE2_TARGET __m128 mix_sse2(const downmix_info *dmx, real_t **input,
+                                          uint8_t o, uint16_t i)
+{
+    __m128 acc = _mm_setzero_ps();
+    uint8_t k;
+
+    for (k = 0; k < dmx->terms[o]; k++)
+    {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(dmx->coef[o][k]),
+            _mm_loadu_ps(input[dmx->in[o][k]] + i)));
+    }
+
+    return _mm_mul_ps(acc, _mm_set1_ps(dmx->gain[o]));
+}
+
+/* 4 samples of output channel c, downmixed or as decoded */
+#define LOAD_SSE2(c) \
+    (hDecoder->downMatrix ? mix_sse2(&hDecoder->dmx, input, c, i) : _mm_loadu_ps(src[c] + i))
+
+/* Interleaves and converts 4 samples of every channel at a time, the
+   channels are transposed while still float so every output frame is
+   converted and stored with packed instructions. A downmix is computed
+   in the same pass. Handles 1, 2, 6 and 8 output channels; returns 0 for
+   anything else.
+ */
+static SSE2_TARGET uint8_t to_PCM_sse2(NeAACDecStruct *hDecoder, real_t **input,
+                                       uint8_t channels, uint16_t frame_len,
+                                       uint8_t format, void *sample_buffer)
+{
+    const real_t *src[8];
+    uint8_t ch;
+    uint16_t i;
+
+    if ((frame_len & 3) || (format > FAAD_FMT_FLOAT))
+        return 0;
+    if ((channels != 1) && (channels != 2) && (channels != 6) && (channels != 8))
+        return 0;
+
+    for (ch = 0; ch < channels; ch++)
+        src[ch] = input[hDecoder->internal_channel[hDecoder->upMatrix ? 0 : ch]];
+
+    switch (channels)
+    {
+    case 1:
+        for (i = 0; i < frame_len; i += 4)
+        {
+            __m128 c0 = LOAD_SSE2(0);
+            store_sse2(sample_buffer, i, c0, c0, 0, format);
+        }
+        break;
+    case 2:
+        for (i = 0; i < frame_len; i += 4)
+        {
+            __m128 c0 = LOAD_SSE2(0);
+            __m128 c1 = LOAD_SSE2(1);
+            store_sse2(sample_buffer, 2*i, _mm_unpacklo_ps(c0, c1),
+                _mm_unpackhi_ps(c0, c1), 4, format);
+        }
+        break;
+    case 6:
+        for (i = 0; i < frame_len; i += 4)
+        {
+            __m128 c0 = LOAD_SSE2(0);
+            __m128 c1 = LOAD_SSE2(1);
+            __m128 c2 = LOAD_SSE2(2);
+            __m128 c3 = LOAD_SSE2(3);
+            __m128 c4 = LOAD_SSE2(4);
+            __m128 c5 = LOAD_SSE2(5);
+            __m128 h0 = _mm_unpacklo_ps(c4, c5);
+            __m128 h1 = _mm_unpackhi_ps(c4, c5);
+            uint32_t pos = 6*(uint32_t)i;
+
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+            store_sse2(sample_buffer, pos,    c0, h0, 2, format);
+            store_sse2(sample_buffer, pos+6,  c1, _mm_movehl_ps(h0, h0), 2, format);
+            store_sse2(sample_buffer, pos+12, c2, h1, 2, format);
+            store_sse2(sample_buffer, pos+18, c3, _mm_movehl_ps(h1, h1), 2, format);
+        }
+        break;
+    case 8:
+        for (i = 0; i < frame_len; i += 4)
+        {
+            __m128 c0 = LOAD_SSE2(0);
+            __m128 c1 = LOAD_SSE2(1);
+            __m128 c2 = LOAD_SSE2(2);
+            __m128 c3 = LOAD_SSE2(3);
+            __m128 c4 = LOAD_SSE2(4);
+            __m128 c5 = LOAD_SSE2(5);
+            __m128 c6 = LOAD_SSE2(6);
+            __m128 c7 = LOAD_SSE2(7);
+            uint32_t pos = 8*(uint32_t)i;
+
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+            _MM_TRANSPOSE4_PS(c4, c5, c6, c7);
+            store_sse2(sample_buffer, pos,    c0, c4, 4, format);
+            store_sse2(sample_buffer, pos+8,  c1, c5, 4, format);
+            store_sse2(sample_buffer, pos+16, c2, c6, 4, format);
+            store_sse2(sample_buffer, pos+24, c3, c7, 4, format);
+        }
+        break;
+    }
+
+    return 1;
+}
+#endif
+
 void *output_to_PCM(NeAACDecStruct *hDecoder,
                     real_t **input, void *sample_buffer, uint8_t channels,
                     uint16_t frame_len, uint8_t format)
@@ -408,6 +853,15 @@ void *output_to_PCM(NeAACDecStruct *hDecoder,
     int64_t count = faad_get_ts();
 #endif
 
+#ifdef USE_SSE
+    if (hDecoder->sse2 &&
+        to_PCM_sse2(hDecoder, input, channels, frame_len, format, sample_buffer))
+    {
+        /* converted, skip the scalar code below */
+        format = 0;
+    }
+#endif
+
     /* Copy output to a standard PCM buffer */
     switch (format)
     {
@@ -438,123 +892,136 @@ void *output_to_PCM(NeAACDecStruct *hDecoder,
 
 #else
 
-#define DM_MUL FRAC_CONST(0.3203772410170407) // 1/(1+sqrt(2) + 1/sqrt(2))
-#define RSQRT2 FRAC_CONST(0.7071067811865475244) // 1/sqrt(2)
-#define BOTH FRAC_CONST(0.2265409196609864215998) // 1/(sqrt(2) + 2 + 1)
-
-static INLINE real_t get_sample(real_t **input, uint8_t channel, uint16_t sample,
-                                uint8_t down_matrix, uint8_t up_matrix,
-                                uint8_t *internal_channel)
+static INLINE real_t get_sample(NeAACDecStruct *hDecoder, real_t **input,
+                                uint8_t channel, uint16_t sample)
 {
-    real_t C;
-    if (up_matrix == 1)
-        return input[internal_channel[0]][sample];
+    const downmix_info *dmx = &hDecoder->dmx;
+    real_t acc = 0;
+    uint8_t k;
 
-    if (!down_matrix)
-        return input[internal_channel[channel]][sample];
+    if (hDecoder->upMatrix == 1)
+        return input[hDecoder->internal_channel[0]][sample];
 
-    C = MUL_F(input[internal_channel[0]][sample], BOTH);
-    if (channel == 0)
-    {
-        real_t L_S = MUL_F(input[internal_channel[3]][sample], BOTH);
-        real_t core = MUL_F(input[internal_channel[1]][sample], DM_MUL);
-        return core + C + L_S;
-    } else {
-        real_t R_S = MUL_F(input[internal_channel[4]][sample], BOTH);
-        real_t core = MUL_F(input[internal_channel[2]][sample], DM_MUL);
-        return core + C + R_S;
-    }
+    if (!hDecoder->downMatrix)
+        return input[hDecoder->internal_channel[channel]][sample];
+
+    for (k = 0; k < dmx->terms[channel]; k++)
+        acc += MUL_F(input[dmx->in[channel][k]][sample], dmx->coef[channel][k]);
+
+    return acc;
 }
 
-void* output_to_PCM(NeAACDecStruct *hDecoder,
-                    real_t **input, void *sample_buffer, uint8_t channels,
-                    uint16_t frame_len, uint8_t format)
+/* Converts one output channel, sample i is written to
+   sample_buffer[(i*stride)+offset] */
+static void to_PCM_channel(NeAACDecStruct *hDecoder, real_t **input,
+                           uint8_t ch, uint16_t frame_len, uint8_t format,
+                           void *sample_buffer, uint8_t offset, uint8_t stride)
 {
-    uint8_t ch;
     uint16_t i;
     int16_t *short_sample_buffer = (int16_t*)sample_buffer;
     int32_t *int_sample_buffer = (int32_t*)sample_buffer;
     int32_t exp, half, sat_shift_mask;
 
-    /* Copy output to a standard PCM buffer */
-    for (ch = 0; ch < channels; ch++)
+    switch (format)
     {
-        switch (format)
+    case FAAD_FMT_16BIT:
+        for(i = 0; i < frame_len; i++)
         {
-        case FAAD_FMT_16BIT:
-            for(i = 0; i < frame_len; i++)
+            int32_t tmp = get_sample(hDecoder, input, ch, i);
+            if (tmp >= 0)
             {
-                int32_t tmp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->upMatrix,
-                    hDecoder->internal_channel);
-                if (tmp >= 0)
+                tmp += (1 << (REAL_BITS-1));
+                if (tmp >= REAL_CONST(32767))
                 {
-                    tmp += (1 << (REAL_BITS-1));
-                    if (tmp >= REAL_CONST(32767))
-                    {
-                        tmp = REAL_CONST(32767);
-                    }
-                } else {
-                    tmp += -(1 << (REAL_BITS-1));
-                    if (tmp <= REAL_CONST(-32768))
-                    {
-                        tmp = REAL_CONST(-32768);
-                    }
+                    tmp = REAL_CONST(32767);
                 }
-                tmp >>= REAL_BITS;
-                short_sample_buffer[(i*channels)+ch] = (int16_t)tmp;
-            }
-            break;
-        case FAAD_FMT_24BIT:
-            for(i = 0; i < frame_len; i++)
-            {
-                int32_t tmp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->upMatrix,
-                    hDecoder->internal_channel);
-                if (tmp >= 0)
+            } else {
+                tmp += -(1 << (REAL_BITS-1));
+                if (tmp <= REAL_CONST(-32768))
                 {
-                    tmp += (1 << (REAL_BITS-9));
-                    tmp >>= (REAL_BITS-8);
-                    if (tmp >= 8388607)
-                    {
-                        tmp = 8388607;
-                    }
-                } else {
-                    tmp += -(1 << (REAL_BITS-9));
-                    tmp >>= (REAL_BITS-8);
-                    if (tmp <= -8388608)
-                    {
-                        tmp = -8388608;
-                    }
+                    tmp = REAL_CONST(-32768);
                 }
-                int_sample_buffer[(i*channels)+ch] = (int32_t)tmp;
             }
-            break;
-        case FAAD_FMT_32BIT:
-            exp = 16 - REAL_BITS;
-            half = 1 << (exp - 1);
-            sat_shift_mask = SAT_SHIFT_MASK(exp);
-            for(i = 0; i < frame_len; i++)
+            tmp >>= REAL_BITS;
+            short_sample_buffer[(i*stride)+offset] = (int16_t)tmp;
+        }
+        break;
+    case FAAD_FMT_24BIT:
+        for(i = 0; i < frame_len; i++)
+        {
+            int32_t tmp = get_sample(hDecoder, input, ch, i);
+            if (tmp >= 0)
             {
-                int32_t tmp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->upMatrix,
-                    hDecoder->internal_channel);
-                if (tmp >= 0)
+                tmp += (1 << (REAL_BITS-9));
+                tmp >>= (REAL_BITS-8);
+                if (tmp >= 8388607)
                 {
-                    tmp += half;
-                } else {
-                    tmp += -half;
+                    tmp = 8388607;
+                }
+            } else {
+                tmp += -(1 << (REAL_BITS-9));
+                tmp >>= (REAL_BITS-8);
+                if (tmp <= -8388608)
+                {
+                    tmp = -8388608;
                 }
-                tmp = SAT_SHIFT(tmp, exp, sat_shift_mask);
-                int_sample_buffer[(i*channels)+ch] = tmp;
             }
-            break;
-        case FAAD_FMT_FIXED:
-            for(i = 0; i < frame_len; i++)
+            int_sample_buffer[(i*stride)+offset] = (int32_t)tmp;
+        }
+        break;
+    case FAAD_FMT_32BIT:
+        exp = 16 - REAL_BITS;
+        half = 1 << (exp - 1);
+        sat_shift_mask = SAT_SHIFT_MASK(exp);
+        for(i = 0; i < frame_len; i++)
+        {
+            int32_t tmp = get_sample(hDecoder, input, ch, i);
+            if (tmp >= 0)
             {
-                real_t tmp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->upMatrix,
-                    hDecoder->internal_channel);
-                int_sample_buffer[(i*channels)+ch] = (int32_t)tmp;
+                tmp += half;
+            } else {
+                tmp += -half;
             }
-            break;
+            tmp = SAT_SHIFT(tmp, exp, sat_shift_mask);
+            int_sample_buffer[(i*stride)+offset] = tmp;
+        }
+        break;
+    case FAAD_FMT_FIXED:
+        for(i = 0; i < frame_len; i++)
+        {
+            real_t tmp = get_sample(hDecoder, input, ch, i);
+            int_sample_buffer[(i*stride)+offset] = (int32_t)tmp;
         }
+        break;
+    }
+}
+
+void* output_to_PCM(NeAACDecStruct *hDecoder,
+                    real_t **input, void *sample_buffer, uint8_t channels,
+                    uint16_t frame_len, uint8_t format)
+{
+    uint8_t ch;
+
+    /* Copy output to a standard PCM buffer */
+    for (ch = 0; ch < channels; ch++)
+    {
+        to_PCM_channel(hDecoder, input, ch, frame_len, format,
+            sample_buffer, ch, channels);
+    }
+
+    return sample_buffer;
+}
+
+void **output_to_PCM_planar(NeAACDecStruct *hDecoder,
+                            real_t **input, void **sample_buffer, uint8_t channels,
+                            uint16_t frame_len, uint8_t format)
+{
+    uint8_t ch;
+
+    for (ch = 0; ch < channels; ch++)
+    {
+        to_PCM_channel(hDecoder, input, ch, frame_len, format,
+            sample_buffer[ch], 0, 1);
     }
 
     return sample_buffer;
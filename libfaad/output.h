@@ -35,6 +35,8 @@
 extern "C" {
 #endif
 
+uint8_t downmix_setup(NeAACDecStruct *hDecoder, uint8_t channels);
+
 void* output_to_PCM(NeAACDecStruct *hDecoder,
                     real_t **input,
                     void *samplebuffer,
@@ -42,6 +44,13 @@ void* output_to_PCM(NeAACDecStruct *hDecoder,
                     uint16_t frame_len,
                     uint8_t format);
 
+void **output_to_PCM_planar(NeAACDecStruct *hDecoder,
+                            real_t **input,
+                            void **samplebuffer,
+                            uint8_t channels,
+                            uint16_t frame_len,
+                            uint8_t format);
+
 #ifdef __cplusplus
 }
 #endif
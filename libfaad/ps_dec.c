@@ -37,6 +37,10 @@
 #include "ps_dec.h"
 #include "ps_tables.h"
 
+#ifdef USE_SSE
+#include <xmmintrin.h>
+#endif
+
 /* constants */
 #define NEGATE_IPD_MASK            (0x1000)
 #define DECAY_SLOPE                FRAC_CONST(0.05)
@@ -159,19 +163,24 @@ typedef struct
     qmf_t *work;
     qmf_t **buffer;
     qmf_t **temp;
+
+#ifdef USE_SSE
+    uint8_t sse;
+#endif
 } hyb_info;
 
 /* static function declarations */
 static void ps_data_decode(ps_info *ps);
-static hyb_info *hybrid_init(uint8_t numTimeSlotsRate);
+static hyb_info *hybrid_init(allocator_info *alloc, uint8_t numTimeSlotsRate);
+static void hybrid_free(allocator_info *alloc, hyb_info *hyb);
 static void channel_filter2(hyb_info *hyb, uint8_t frame_len, const real_t *filter,
                             qmf_t *buffer, qmf_t **X_hybrid);
 static void INLINE DCT3_4_unscaled(real_t *y, real_t *x);
 static void channel_filter8(hyb_info *hyb, uint8_t frame_len, const real_t *filter,
                             qmf_t *buffer, qmf_t **X_hybrid);
-static void hybrid_analysis(hyb_info *hyb, qmf_t X[32][64], qmf_t X_hybrid[32][32],
+static void hybrid_analysis(hyb_info *hyb, qmf_row_t X[32], qmf_t X_hybrid[32][32],
                             uint8_t use34, uint8_t numTimeSlotsRate);
-static void hybrid_synthesis(hyb_info *hyb, qmf_t X[32][64], qmf_t X_hybrid[32][32],
+static void hybrid_synthesis(hyb_info *hyb, qmf_row_t X[32], qmf_t X_hybrid[32][32],
                              uint8_t use34, uint8_t numTimeSlotsRate);
 static int8_t delta_clip(int8_t i, int8_t min, int8_t max);
 static void delta_decode(uint8_t enable, int8_t *index, int8_t *index_prev,
@@ -185,19 +194,23 @@ static void map20indexto34(int8_t *index, uint8_t bins);
 static void map34indexto20(int8_t *index, uint8_t bins);
 #endif
 static void ps_data_decode(ps_info *ps);
-static void ps_decorrelate(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64],
+static void ps_decorrelate(ps_info *ps, qmf_row_t X_left[38], qmf_row_t X_right[38],
                            qmf_t X_hybrid_left[32][32], qmf_t X_hybrid_right[32][32]);
-static void ps_mix_phase(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64],
+static void ps_mix_phase(ps_info *ps, qmf_row_t X_left[38], qmf_row_t X_right[38],
                          qmf_t X_hybrid_left[32][32], qmf_t X_hybrid_right[32][32]);
 
 /*  */
 
 
-static hyb_info *hybrid_init(uint8_t numTimeSlotsRate)
+static hyb_info *hybrid_init(allocator_info *alloc, uint8_t numTimeSlotsRate)
 {
     uint8_t i;
 
-    hyb_info *hyb = (hyb_info*)faad_malloc(sizeof(hyb_info));
+    hyb_info *hyb = (hyb_info*)faad_malloc(alloc, sizeof(hyb_info));
+
+    if (hyb == NULL)
+        return NULL;
+    memset(hyb, 0, sizeof(hyb_info));
 
     hyb->resolution34[0] = 12;
     hyb->resolution34[1] = 8;
@@ -211,51 +224,71 @@ static hyb_info *hybrid_init(uint8_t numTimeSlotsRate)
 
     hyb->frame_len = numTimeSlotsRate;
 
-    hyb->work = (qmf_t*)faad_malloc((hyb->frame_len+12) * sizeof(qmf_t));
+    hyb->work = (qmf_t*)faad_malloc(alloc, (hyb->frame_len+12) * sizeof(qmf_t));
+    if (hyb->work == NULL)
+        goto error;
     memset(hyb->work, 0, (hyb->frame_len+12) * sizeof(qmf_t));
 
-    hyb->buffer = (qmf_t**)faad_malloc(5 * sizeof(qmf_t*));
+    hyb->buffer = (qmf_t**)faad_malloc(alloc, 5 * sizeof(qmf_t*));
+    if (hyb->buffer == NULL)
+        goto error;
+    memset(hyb->buffer, 0, 5 * sizeof(qmf_t*));
     for (i = 0; i < 5; i++)
     {
-        hyb->buffer[i] = (qmf_t*)faad_malloc(hyb->frame_len * sizeof(qmf_t));
+        hyb->buffer[i] = (qmf_t*)faad_malloc(alloc, hyb->frame_len * sizeof(qmf_t));
+        if (hyb->buffer[i] == NULL)
+            goto error;
         memset(hyb->buffer[i], 0, hyb->frame_len * sizeof(qmf_t));
     }
 
-    hyb->temp = (qmf_t**)faad_malloc(hyb->frame_len * sizeof(qmf_t*));
+    hyb->temp = (qmf_t**)faad_malloc(alloc, hyb->frame_len * sizeof(qmf_t*));
+    if (hyb->temp == NULL)
+        goto error;
+    memset(hyb->temp, 0, hyb->frame_len * sizeof(qmf_t*));
     for (i = 0; i < hyb->frame_len; i++)
     {
-        hyb->temp[i] = (qmf_t*)faad_malloc(12 /*max*/ * sizeof(qmf_t));
+        hyb->temp[i] = (qmf_t*)faad_malloc(alloc, 12 /*max*/ * sizeof(qmf_t));
+        if (hyb->temp[i] == NULL)
+            goto error;
     }
 
     return hyb;
+
+error:
+    hybrid_free(alloc, hyb);
+    return NULL;
 }
 
-static void hybrid_free(hyb_info *hyb)
+static void hybrid_free(allocator_info *alloc, hyb_info *hyb)
 {
     uint8_t i;
 
 	if (!hyb) return;
 
     if (hyb->work)
-        faad_free(hyb->work);
+        faad_free(alloc, hyb->work);
 
-    for (i = 0; i < 5; i++)
+    if (hyb->buffer)
     {
-        if (hyb->buffer[i])
-            faad_free(hyb->buffer[i]);
+        for (i = 0; i < 5; i++)
+        {
+            if (hyb->buffer[i])
+                faad_free(alloc, hyb->buffer[i]);
+        }
+        faad_free(alloc, hyb->buffer);
     }
-    if (hyb->buffer)
-        faad_free(hyb->buffer);
 
-    for (i = 0; i < hyb->frame_len; i++)
+    if (hyb->temp)
     {
-        if (hyb->temp[i])
-            faad_free(hyb->temp[i]);
+        for (i = 0; i < hyb->frame_len; i++)
+        {
+            if (hyb->temp[i])
+                faad_free(alloc, hyb->temp[i]);
+        }
+        faad_free(alloc, hyb->temp);
     }
-    if (hyb->temp)
-        faad_free(hyb->temp);
 
-    faad_free(hyb);
+    faad_free(alloc, hyb);
 }
 
 /* real filter, size 2 */
@@ -506,13 +539,336 @@ static void channel_filter12(hyb_info *hyb, uint8_t frame_len, const real_t *fil
     }
 }
 
+#ifdef USE_SSE
+/* load samples 0..3 of a complex array as separate real and imaginary vectors */
+static INLINE SSE_TARGET void load_cplx4(complex_t *x, __m128 *re, __m128 *im)
+{
+    __m128 a = _mm_loadu_ps(&RE(x[0]));
+    __m128 b = _mm_loadu_ps(&RE(x[2]));
+    *re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static INLINE SSE_TARGET void store_cplx4(complex_t *x, __m128 re, __m128 im)
+{
+    _mm_storeu_ps(&RE(x[0]), _mm_unpacklo_ps(re, im));
+    _mm_storeu_ps(&RE(x[2]), _mm_unpackhi_ps(re, im));
+}
+
+static INLINE SSE_TARGET __m128 neg_ps(__m128 x)
+{
+    return _mm_xor_ps(x, _mm_set1_ps(-0.0f));
+}
+
+/* store output q of 4 consecutive time slots, one lane per time slot */
+static INLINE SSE_TARGET void store_hyb4(qmf_t **X_hybrid, uint8_t q, __m128 re, __m128 im)
+{
+    __m128 lo = _mm_unpacklo_ps(re, im);
+    __m128 hi = _mm_unpackhi_ps(re, im);
+
+    _mm_storel_pi((__m64*)&QMF_RE(X_hybrid[0][q]), lo);
+    _mm_storeh_pi((__m64*)&QMF_RE(X_hybrid[1][q]), lo);
+    _mm_storel_pi((__m64*)&QMF_RE(X_hybrid[2][q]), hi);
+    _mm_storeh_pi((__m64*)&QMF_RE(X_hybrid[3][q]), hi);
+}
+
+/* the 13 filter taps of 4 consecutive time slots */
+static INLINE SSE_TARGET void load_taps4(qmf_t *buffer, __m128 re[13], __m128 im[13])
+{
+    uint8_t k;
+
+    for (k = 0; k < 13; k++)
+        load_cplx4(&buffer[k], &re[k], &im[k]);
+}
+
+/* The SSE channel filters below run 4 time slots at once, one per lane, with
+ * the same operation order as the scalar filters. They return the number of
+ * time slots done, the scalar filters handle the rest.
+ */
+static SSE_TARGET uint8_t channel_filter2_sse(uint8_t frame_len, const real_t *filter,
+                                              qmf_t *buffer, qmf_t **X_hybrid)
+{
+    uint8_t i, k;
+
+    for (i = 0; i + 4 <= frame_len; i += 4)
+    {
+        __m128 br[13], bi[13], r[7], im[7];
+
+        load_taps4(&buffer[i], br, bi);
+
+        for (k = 0; k < 6; k++)
+        {
+            __m128 f = _mm_set1_ps(filter[k]);
+            r[k] = _mm_mul_ps(f, _mm_add_ps(br[k], br[12-k]));
+            im[k] = _mm_mul_ps(f, _mm_add_ps(bi[k], bi[12-k]));
+        }
+        r[6] = _mm_mul_ps(_mm_set1_ps(filter[6]), br[6]);
+        im[6] = _mm_mul_ps(_mm_set1_ps(filter[6]), bi[6]);
+
+        /* q = 0 */
+        store_hyb4(&X_hybrid[i], 0,
+            _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(
+                r[0], r[1]), r[2]), r[3]), r[4]), r[5]), r[6]),
+            _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(
+                im[0], im[1]), im[2]), im[3]), im[4]), im[5]), im[6]));
+
+        /* q = 1 */
+        store_hyb4(&X_hybrid[i], 1,
+            _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_sub_ps(
+                r[0], r[1]), r[2]), r[3]), r[4]), r[5]), r[6]),
+            _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_sub_ps(
+                im[0], im[1]), im[2]), im[3]), im[4]), im[5]), im[6]));
+    }
+
+    return i;
+}
+
+/* input_re1/input_im2 of channel_filter4 from the real/imaginary taps x */
+static INLINE SSE_TARGET void filter4_sum_sse(const real_t *filter, const __m128 x[13], __m128 y[2])
+{
+    y[0] = _mm_add_ps(neg_ps(_mm_mul_ps(_mm_set1_ps(filter[2]), _mm_add_ps(x[2], x[10]))),
+        _mm_mul_ps(_mm_set1_ps(filter[6]), x[6]));
+    y[1] = _mm_mul_ps(_mm_set1_ps(FRAC_CONST(-0.70710678118655)),
+        _mm_sub_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(filter[1]), _mm_add_ps(x[1], x[11])),
+        _mm_mul_ps(_mm_set1_ps(filter[3]), _mm_add_ps(x[3], x[9]))),
+        _mm_mul_ps(_mm_set1_ps(filter[5]), _mm_add_ps(x[5], x[7]))));
+}
+
+/* input_im1/input_re2 of channel_filter4 from the imaginary/real taps x */
+static INLINE SSE_TARGET void filter4_diff_sse(const real_t *filter, const __m128 x[13], __m128 y[2])
+{
+    y[0] = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(filter[0]), _mm_sub_ps(x[0], x[12])),
+        _mm_mul_ps(_mm_set1_ps(filter[4]), _mm_sub_ps(x[4], x[8])));
+    y[1] = _mm_mul_ps(_mm_set1_ps(FRAC_CONST(0.70710678118655)),
+        _mm_sub_ps(_mm_sub_ps(
+        _mm_mul_ps(_mm_set1_ps(filter[1]), _mm_sub_ps(x[1], x[11])),
+        _mm_mul_ps(_mm_set1_ps(filter[3]), _mm_sub_ps(x[3], x[9]))),
+        _mm_mul_ps(_mm_set1_ps(filter[5]), _mm_sub_ps(x[5], x[7]))));
+}
+
+static SSE_TARGET uint8_t channel_filter4_sse(uint8_t frame_len, const real_t *filter,
+                                              qmf_t *buffer, qmf_t **X_hybrid)
+{
+    uint8_t i;
+
+    for (i = 0; i + 4 <= frame_len; i += 4)
+    {
+        __m128 br[13], bi[13];
+        __m128 re1[2], re2[2], im1[2], im2[2];
+
+        load_taps4(&buffer[i], br, bi);
+
+        filter4_sum_sse(filter, br, re1);
+        filter4_diff_sse(filter, bi, im1);
+        filter4_diff_sse(filter, br, re2);
+        filter4_sum_sse(filter, bi, im2);
+
+        /* q == 0 */
+        store_hyb4(&X_hybrid[i], 0,
+            _mm_add_ps(_mm_add_ps(_mm_add_ps(re1[0], re1[1]), im1[0]), im1[1]),
+            _mm_add_ps(_mm_add_ps(_mm_sub_ps(neg_ps(re2[0]), re2[1]), im2[0]), im2[1]));
+
+        /* q == 1 */
+        store_hyb4(&X_hybrid[i], 1,
+            _mm_add_ps(_mm_sub_ps(_mm_sub_ps(re1[0], re1[1]), im1[0]), im1[1]),
+            _mm_sub_ps(_mm_add_ps(_mm_sub_ps(re2[0], re2[1]), im2[0]), im2[1]));
+
+        /* q == 2 */
+        store_hyb4(&X_hybrid[i], 2,
+            _mm_sub_ps(_mm_add_ps(_mm_sub_ps(re1[0], re1[1]), im1[0]), im1[1]),
+            _mm_sub_ps(_mm_add_ps(_mm_add_ps(neg_ps(re2[0]), re2[1]), im2[0]), im2[1]));
+
+        /* q == 3 */
+        store_hyb4(&X_hybrid[i], 3,
+            _mm_sub_ps(_mm_sub_ps(_mm_add_ps(re1[0], re1[1]), im1[0]), im1[1]),
+            _mm_add_ps(_mm_add_ps(_mm_add_ps(re2[0], re2[1]), im2[0]), im2[1]));
+    }
+
+    return i;
+}
+
+static INLINE SSE_TARGET void DCT3_4_unscaled_sse(__m128 *y, const __m128 *x)
+{
+    __m128 f0, f1, f2, f3, f4, f5, f6, f7, f8;
+
+    f0 = _mm_mul_ps(x[2], _mm_set1_ps(FRAC_CONST(0.7071067811865476)));
+    f1 = _mm_sub_ps(x[0], f0);
+    f2 = _mm_add_ps(x[0], f0);
+    f3 = _mm_add_ps(x[1], x[3]);
+    f4 = _mm_mul_ps(x[1], _mm_set1_ps(COEF_CONST(1.3065629648763766)));
+    f5 = _mm_mul_ps(f3, _mm_set1_ps(FRAC_CONST(-0.9238795325112866)));
+    f6 = _mm_mul_ps(x[3], _mm_set1_ps(FRAC_CONST(-0.5411961001461967)));
+    f7 = _mm_add_ps(f4, f5);
+    f8 = _mm_sub_ps(f6, f5);
+    y[3] = _mm_sub_ps(f2, f8);
+    y[0] = _mm_add_ps(f2, f8);
+    y[2] = _mm_sub_ps(f1, f7);
+    y[1] = _mm_add_ps(f1, f7);
+}
+
+/* input_re1/input_im2 of channel_filter8 from the real/imaginary taps x */
+static INLINE SSE_TARGET void filter8_sum_sse(const real_t *filter, const __m128 x[13], __m128 y[4])
+{
+    y[0] = _mm_mul_ps(_mm_set1_ps(filter[6]), x[6]);
+    y[1] = _mm_mul_ps(_mm_set1_ps(filter[5]), _mm_add_ps(x[5], x[7]));
+    y[2] = _mm_add_ps(neg_ps(_mm_mul_ps(_mm_set1_ps(filter[0]), _mm_add_ps(x[0], x[12]))),
+        _mm_mul_ps(_mm_set1_ps(filter[4]), _mm_add_ps(x[4], x[8])));
+    y[3] = _mm_add_ps(neg_ps(_mm_mul_ps(_mm_set1_ps(filter[1]), _mm_add_ps(x[1], x[11]))),
+        _mm_mul_ps(_mm_set1_ps(filter[3]), _mm_add_ps(x[3], x[9])));
+}
+
+/* input_im1/input_re2 of channel_filter8 from the imaginary/real taps x */
+static INLINE SSE_TARGET void filter8_diff_sse(const real_t *filter, const __m128 x[13], __m128 y[4])
+{
+    y[0] = _mm_mul_ps(_mm_set1_ps(filter[5]), _mm_sub_ps(x[7], x[5]));
+    y[1] = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(filter[0]), _mm_sub_ps(x[12], x[0])),
+        _mm_mul_ps(_mm_set1_ps(filter[4]), _mm_sub_ps(x[8], x[4])));
+    y[2] = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(filter[1]), _mm_sub_ps(x[11], x[1])),
+        _mm_mul_ps(_mm_set1_ps(filter[3]), _mm_sub_ps(x[9], x[3])));
+    y[3] = _mm_mul_ps(_mm_set1_ps(filter[2]), _mm_sub_ps(x[10], x[2]));
+}
+
+static SSE_TARGET uint8_t channel_filter8_sse(uint8_t frame_len, const real_t *filter,
+                                              qmf_t *buffer, qmf_t **X_hybrid)
+{
+    uint8_t i, n;
+
+    for (i = 0; i + 4 <= frame_len; i += 4)
+    {
+        __m128 br[13], bi[13];
+        __m128 re1[4], re2[4], im1[4], im2[4];
+        __m128 x[4], y[4], out_re[8], out_im[8];
+
+        load_taps4(&buffer[i], br, bi);
+
+        filter8_sum_sse(filter, br, re1);
+        filter8_diff_sse(filter, bi, im1);
+
+        for (n = 0; n < 4; n++)
+            x[n] = _mm_sub_ps(re1[n], im1[3-n]);
+        DCT3_4_unscaled_sse(y, x);
+        out_re[7] = y[0];
+        out_re[5] = y[2];
+        out_re[3] = y[3];
+        out_re[1] = y[1];
+
+        for (n = 0; n < 4; n++)
+            x[n] = _mm_add_ps(re1[n], im1[3-n]);
+        DCT3_4_unscaled_sse(y, x);
+        out_re[6] = y[1];
+        out_re[4] = y[3];
+        out_re[2] = y[2];
+        out_re[0] = y[0];
+
+        filter8_sum_sse(filter, bi, im2);
+        filter8_diff_sse(filter, br, re2);
+
+        for (n = 0; n < 4; n++)
+            x[n] = _mm_add_ps(im2[n], re2[3-n]);
+        DCT3_4_unscaled_sse(y, x);
+        out_im[7] = y[0];
+        out_im[5] = y[2];
+        out_im[3] = y[3];
+        out_im[1] = y[1];
+
+        for (n = 0; n < 4; n++)
+            x[n] = _mm_sub_ps(im2[n], re2[3-n]);
+        DCT3_4_unscaled_sse(y, x);
+        out_im[6] = y[1];
+        out_im[4] = y[3];
+        out_im[2] = y[2];
+        out_im[0] = y[0];
+
+        for (n = 0; n < 8; n++)
+            store_hyb4(&X_hybrid[i], n, out_re[n], out_im[n]);
+    }
+
+    return i;
+}
+
+static INLINE SSE_TARGET void DCT3_6_unscaled_sse(__m128 *y, const __m128 *x)
+{
+    __m128 f0, f1, f2, f3, f4, f5, f6, f7;
+
+    f0 = _mm_mul_ps(x[3], _mm_set1_ps(FRAC_CONST(0.70710678118655)));
+    f1 = _mm_add_ps(x[0], f0);
+    f2 = _mm_sub_ps(x[0], f0);
+    f3 = _mm_mul_ps(_mm_sub_ps(x[1], x[5]), _mm_set1_ps(FRAC_CONST(0.70710678118655)));
+    f4 = _mm_add_ps(_mm_mul_ps(x[2], _mm_set1_ps(FRAC_CONST(0.86602540378444))),
+        _mm_mul_ps(x[4], _mm_set1_ps(FRAC_CONST(0.5))));
+    f5 = _mm_sub_ps(f4, x[4]);
+    f6 = _mm_add_ps(_mm_mul_ps(x[1], _mm_set1_ps(FRAC_CONST(0.96592582628907))),
+        _mm_mul_ps(x[5], _mm_set1_ps(FRAC_CONST(0.25881904510252))));
+    f7 = _mm_sub_ps(f6, f3);
+    y[0] = _mm_add_ps(_mm_add_ps(f1, f6), f4);
+    y[1] = _mm_sub_ps(_mm_add_ps(f2, f3), x[4]);
+    y[2] = _mm_sub_ps(_mm_add_ps(f7, f2), f5);
+    y[3] = _mm_sub_ps(_mm_sub_ps(f1, f7), f5);
+    y[4] = _mm_sub_ps(_mm_sub_ps(f1, f3), x[4]);
+    y[5] = _mm_add_ps(_mm_sub_ps(f2, f6), f4);
+}
+
+static SSE_TARGET uint8_t channel_filter12_sse(uint8_t frame_len, const real_t *filter,
+                                               qmf_t *buffer, qmf_t **X_hybrid)
+{
+    uint8_t i, n;
+
+    for (i = 0; i + 4 <= frame_len; i += 4)
+    {
+        __m128 br[13], bi[13];
+        __m128 input_re1[6], input_re2[6], input_im1[6], input_im2[6];
+        __m128 out_re1[6], out_re2[6], out_im1[6], out_im2[6];
+
+        load_taps4(&buffer[i], br, bi);
+
+        for (n = 0; n < 6; n++)
+        {
+            __m128 f = _mm_set1_ps(filter[n]);
+
+            if (n == 0)
+            {
+                input_re1[0] = _mm_mul_ps(br[6], _mm_set1_ps(filter[6]));
+                input_re2[0] = _mm_mul_ps(bi[6], _mm_set1_ps(filter[6]));
+            } else {
+                input_re1[6-n] = _mm_mul_ps(_mm_add_ps(br[n], br[12-n]), f);
+                input_re2[6-n] = _mm_mul_ps(_mm_add_ps(bi[n], bi[12-n]), f);
+            }
+            input_im2[n] = _mm_mul_ps(_mm_sub_ps(br[n], br[12-n]), f);
+            input_im1[n] = _mm_mul_ps(_mm_sub_ps(bi[n], bi[12-n]), f);
+        }
+
+        DCT3_6_unscaled_sse(out_re1, input_re1);
+        DCT3_6_unscaled_sse(out_re2, input_re2);
+
+        DCT3_6_unscaled_sse(out_im1, input_im1);
+        DCT3_6_unscaled_sse(out_im2, input_im2);
+
+        for (n = 0; n < 6; n += 2)
+        {
+            store_hyb4(&X_hybrid[i], n,
+                _mm_sub_ps(out_re1[n], out_im1[n]), _mm_add_ps(out_re2[n], out_im2[n]));
+            store_hyb4(&X_hybrid[i], n+1,
+                _mm_add_ps(out_re1[n+1], out_im1[n+1]), _mm_sub_ps(out_re2[n+1], out_im2[n+1]));
+
+            store_hyb4(&X_hybrid[i], 10-n,
+                _mm_sub_ps(out_re1[n+1], out_im1[n+1]), _mm_add_ps(out_re2[n+1], out_im2[n+1]));
+            store_hyb4(&X_hybrid[i], 11-n,
+                _mm_add_ps(out_re1[n], out_im1[n]), _mm_sub_ps(out_re2[n], out_im2[n]));
+        }
+    }
+
+    return i;
+}
+#endif
+
 /* Hybrid analysis: further split up QMF subbands
  * to improve frequency resolution
  */
-static void hybrid_analysis(hyb_info *hyb, qmf_t X[32][64], qmf_t X_hybrid[32][32],
+static void hybrid_analysis(hyb_info *hyb, qmf_row_t X[32], qmf_t X_hybrid[32][32],
                             uint8_t use34, uint8_t numTimeSlotsRate)
 {
-    uint8_t k, n, band;
+    uint8_t k, n, band, done;
     uint8_t offset = 0;
     uint8_t qmf_bands = (use34) ? 5 : 3;
     uint8_t *resolution = (use34) ? hyb->resolution34 : hyb->resolution20;
@@ -525,32 +881,55 @@ static void hybrid_analysis(hyb_info *hyb, qmf_t X[32][64], qmf_t X_hybrid[32][3
         /* add new samples */
         for (n = 0; n < hyb->frame_len; n++)
         {
-            QMF_RE(hyb->work[12 + n]) = QMF_RE(X[n + 6 /*delay*/][band]);
-            QMF_IM(hyb->work[12 + n]) = QMF_IM(X[n + 6 /*delay*/][band]);
+            QMF_RE(hyb->work[12 + n]) = QMF_RE_AT(X[n + 6 /*delay*/], band);
+            QMF_IM(hyb->work[12 + n]) = QMF_IM_AT(X[n + 6 /*delay*/], band);
         }
 
         /* store samples */
         memcpy(hyb->buffer[band], hyb->work + hyb->frame_len, 12 * sizeof(qmf_t));
 
 
+        /* time slots already filtered by the SSE code */
+        done = 0;
+
         switch(resolution[band])
         {
         case 2:
             /* Type B real filter, Q[p] = 2 */
-            channel_filter2(hyb, hyb->frame_len, p2_13_20, hyb->work, hyb->temp);
+#ifdef USE_SSE
+            if (hyb->sse)
+                done = channel_filter2_sse(hyb->frame_len, p2_13_20, hyb->work, hyb->temp);
+#endif
+            channel_filter2(hyb, hyb->frame_len - done, p2_13_20,
+                hyb->work + done, hyb->temp + done);
             break;
         case 4:
             /* Type A complex filter, Q[p] = 4 */
-            channel_filter4(hyb, hyb->frame_len, p4_13_34, hyb->work, hyb->temp);
+#ifdef USE_SSE
+            if (hyb->sse)
+                done = channel_filter4_sse(hyb->frame_len, p4_13_34, hyb->work, hyb->temp);
+#endif
+            channel_filter4(hyb, hyb->frame_len - done, p4_13_34,
+                hyb->work + done, hyb->temp + done);
             break;
         case 8:
             /* Type A complex filter, Q[p] = 8 */
-            channel_filter8(hyb, hyb->frame_len, (use34) ? p8_13_34 : p8_13_20,
-                hyb->work, hyb->temp);
+#ifdef USE_SSE
+            if (hyb->sse)
+                done = channel_filter8_sse(hyb->frame_len, (use34) ? p8_13_34 : p8_13_20,
+                    hyb->work, hyb->temp);
+#endif
+            channel_filter8(hyb, hyb->frame_len - done, (use34) ? p8_13_34 : p8_13_20,
+                hyb->work + done, hyb->temp + done);
             break;
         case 12:
             /* Type A complex filter, Q[p] = 12 */
-            channel_filter12(hyb, hyb->frame_len, p12_13_34, hyb->work, hyb->temp);
+#ifdef USE_SSE
+            if (hyb->sse)
+                done = channel_filter12_sse(hyb->frame_len, p12_13_34, hyb->work, hyb->temp);
+#endif
+            channel_filter12(hyb, hyb->frame_len - done, p12_13_34,
+                hyb->work + done, hyb->temp + done);
             break;
         }
 
@@ -583,7 +962,7 @@ static void hybrid_analysis(hyb_info *hyb, qmf_t X[32][64], qmf_t X_hybrid[32][3
     }
 }
 
-static void hybrid_synthesis(hyb_info *hyb, qmf_t X[32][64], qmf_t X_hybrid[32][32],
+static void hybrid_synthesis(hyb_info *hyb, qmf_row_t X[32], qmf_t X_hybrid[32][32],
                              uint8_t use34, uint8_t numTimeSlotsRate)
 {
     uint8_t k, n, band;
@@ -596,13 +975,13 @@ static void hybrid_synthesis(hyb_info *hyb, qmf_t X[32][64], qmf_t X_hybrid[32][
     {
         for (n = 0; n < hyb->frame_len; n++)
         {
-            QMF_RE(X[n][band]) = 0;
-            QMF_IM(X[n][band]) = 0;
+            QMF_RE_AT(X[n], band) = 0;
+            QMF_IM_AT(X[n], band) = 0;
 
             for (k = 0; k < resolution[band]; k++)
             {
-                QMF_RE(X[n][band]) += QMF_RE(X_hybrid[n][offset + k]);
-                QMF_IM(X[n][band]) += QMF_IM(X_hybrid[n][offset + k]);
+                QMF_RE_AT(X[n], band) += QMF_RE(X_hybrid[n][offset + k]);
+                QMF_IM_AT(X[n], band) += QMF_IM(X_hybrid[n][offset + k]);
             }
         }
         offset += resolution[band];
@@ -1035,8 +1414,164 @@ static void ps_data_decode(ps_info *ps)
 #endif
 }
 
+/* g_DecaySlope: [0..1] */
+static real_t decay_slope(ps_info *ps, uint8_t hybrid, uint8_t sb)
+{
+    int8_t decay;
+
+    if (hybrid || sb <= ps->decay_cutoff)
+        return FRAC_CONST(1.0);
+
+    decay = ps->decay_cutoff - sb;
+    if (decay <= -20 /* -1/DECAY_SLOPE */)
+        return 0;
+
+    /* decay(int)*decay_slope(frac) = g_DecaySlope(frac) */
+    return FRAC_CONST(1.0) + DECAY_SLOPE * decay;
+}
+
+#ifdef USE_SSE
+/* transient reduction ratio for 4 parameter bands at once, returns the
+ * number of parameter bands done
+ */
+static SSE_TARGET uint8_t transient_ratio_sse(ps_info *ps, real_t P[32][34],
+                                              real_t G_TransientRatio[32][34])
+{
+    uint8_t bk, n;
+    const __m128 alpha_decay = _mm_set1_ps(ps->alpha_decay);
+    const __m128 alpha_smooth = _mm_set1_ps(ps->alpha_smooth);
+    const __m128 gamma = _mm_set1_ps(COEF_CONST(1.5));
+    const __m128 one = _mm_set1_ps(REAL_CONST(1.0));
+
+    for (bk = 0; bk + 4 <= ps->nr_par_bands; bk += 4)
+    {
+        __m128 peak = _mm_loadu_ps(&ps->P_PeakDecayNrg[bk]);
+        __m128 smooth = _mm_loadu_ps(&ps->P_SmoothPeakDecayDiffNrg_prev[bk]);
+        __m128 nrg = _mm_loadu_ps(&ps->P_prev[bk]);
+
+        for (n = ps->border_position[0]; n < ps->border_position[ps->num_env]; n++)
+        {
+            __m128 p = _mm_loadu_ps(&P[n][bk]);
+            __m128 mask, den;
+
+            peak = _mm_mul_ps(peak, alpha_decay);
+            mask = _mm_cmplt_ps(peak, p);
+            peak = _mm_or_ps(_mm_and_ps(mask, p), _mm_andnot_ps(mask, peak));
+
+            smooth = _mm_add_ps(smooth, _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(peak, p), smooth), alpha_smooth));
+            nrg = _mm_add_ps(nrg, _mm_mul_ps(_mm_sub_ps(p, nrg), alpha_smooth));
+
+            den = _mm_mul_ps(smooth, gamma);
+            mask = _mm_cmple_ps(den, nrg);
+            _mm_storeu_ps(&G_TransientRatio[n][bk],
+                _mm_or_ps(_mm_and_ps(mask, one), _mm_andnot_ps(mask, _mm_div_ps(nrg, den))));
+        }
+
+        _mm_storeu_ps(&ps->P_PeakDecayNrg[bk], peak);
+        _mm_storeu_ps(&ps->P_SmoothPeakDecayDiffNrg_prev[bk], smooth);
+        _mm_storeu_ps(&ps->P_prev[bk], nrg);
+    }
+
+    return bk;
+}
+
+/* allpass filter the QMF subbands sb..sb+3, which must all lie below
+ * nr_allpass_bands. Every subband walks the same delay indices, the indices
+ * after the last time slot are returned in temp_delay and temp_delay_ser.
+ */
+static SSE_TARGET void allpass_qmf_sse(ps_info *ps, qmf_row_t X_left[38], qmf_row_t X_right[38],
+                                       real_t G_TransientRatio[32][34], uint8_t sb,
+                                       uint8_t *temp_delay, uint8_t temp_delay_ser[NO_ALLPASS_LINKS])
+{
+    uint8_t j, m, n, gr;
+    uint8_t bk[4];
+    uint8_t delay = ps->saved_delay;
+    uint8_t delay_ser[NO_ALLPASS_LINKS];
+    __m128 g_DecaySlope, phi_re, phi_im;
+    __m128 g_DecaySlope_filt[NO_ALLPASS_LINKS];
+    __m128 q_re[NO_ALLPASS_LINKS], q_im[NO_ALLPASS_LINKS];
+
+    /* b(k) of the group each subband belongs to */
+    gr = ps->num_hybrid_groups;
+    for (j = 0; j < 4; j++)
+    {
+        while (ps->group_border[gr + 1] <= sb + j)
+            gr++;
+        bk[j] = (~NEGATE_IPD_MASK) & ps->map_group2bk[gr];
+    }
+
+    g_DecaySlope = _mm_setr_ps(decay_slope(ps, 0, sb), decay_slope(ps, 0, sb + 1),
+        decay_slope(ps, 0, sb + 2), decay_slope(ps, 0, sb + 3));
+    phi_re = _mm_setr_ps(RE(Phi_Fract_Qmf[sb]), RE(Phi_Fract_Qmf[sb+1]),
+        RE(Phi_Fract_Qmf[sb+2]), RE(Phi_Fract_Qmf[sb+3]));
+    phi_im = _mm_setr_ps(IM(Phi_Fract_Qmf[sb]), IM(Phi_Fract_Qmf[sb+1]),
+        IM(Phi_Fract_Qmf[sb+2]), IM(Phi_Fract_Qmf[sb+3]));
+
+    for (m = 0; m < NO_ALLPASS_LINKS; m++)
+    {
+        g_DecaySlope_filt[m] = _mm_mul_ps(g_DecaySlope, _mm_set1_ps(filter_a[m]));
+        q_re[m] = _mm_setr_ps(RE(Q_Fract_allpass_Qmf[sb][m]), RE(Q_Fract_allpass_Qmf[sb+1][m]),
+            RE(Q_Fract_allpass_Qmf[sb+2][m]), RE(Q_Fract_allpass_Qmf[sb+3][m]));
+        q_im[m] = _mm_setr_ps(IM(Q_Fract_allpass_Qmf[sb][m]), IM(Q_Fract_allpass_Qmf[sb+1][m]),
+            IM(Q_Fract_allpass_Qmf[sb+2][m]), IM(Q_Fract_allpass_Qmf[sb+3][m]));
+        delay_ser[m] = ps->delay_buf_index_ser[m];
+    }
+
+    for (n = ps->border_position[0]; n < ps->border_position[ps->num_env]; n++)
+    {
+        __m128 in_re, in_im, tmp0_re, tmp0_im, R0_re, R0_im, G;
+
+        load_qmf4(&X_left[n], sb, &in_re, &in_im);
+
+        load_cplx4(&ps->delay_Qmf[delay][sb], &tmp0_re, &tmp0_im);
+        store_cplx4(&ps->delay_Qmf[delay][sb], in_re, in_im);
+
+        /* z^(-2) * Phi_Fract[k] */
+        R0_re = _mm_add_ps(_mm_mul_ps(tmp0_re, phi_re), _mm_mul_ps(tmp0_im, phi_im));
+        R0_im = _mm_sub_ps(_mm_mul_ps(tmp0_im, phi_re), _mm_mul_ps(tmp0_re, phi_im));
+
+        for (m = 0; m < NO_ALLPASS_LINKS; m++)
+        {
+            __m128 tmp_re, tmp_im;
+            complex_t *ser = &ps->delay_Qmf_ser[m][delay_ser[m]][sb];
+
+            load_cplx4(ser, &tmp0_re, &tmp0_im);
+
+            /* z^(-d(m)) * Q_Fract_allpass[k,m] - a(m) * g_DecaySlope[k] * R0 */
+            tmp_re = _mm_add_ps(_mm_mul_ps(tmp0_re, q_re[m]), _mm_mul_ps(tmp0_im, q_im[m]));
+            tmp_im = _mm_sub_ps(_mm_mul_ps(tmp0_im, q_re[m]), _mm_mul_ps(tmp0_re, q_im[m]));
+            tmp_re = _mm_sub_ps(tmp_re, _mm_mul_ps(g_DecaySlope_filt[m], R0_re));
+            tmp_im = _mm_sub_ps(tmp_im, _mm_mul_ps(g_DecaySlope_filt[m], R0_im));
+
+            store_cplx4(ser, _mm_add_ps(R0_re, _mm_mul_ps(g_DecaySlope_filt[m], tmp_re)),
+                _mm_add_ps(R0_im, _mm_mul_ps(g_DecaySlope_filt[m], tmp_im)));
+
+            R0_re = tmp_re;
+            R0_im = tmp_im;
+        }
+
+        /* duck if a past transient is found */
+        G = _mm_setr_ps(G_TransientRatio[n][bk[0]], G_TransientRatio[n][bk[1]],
+            G_TransientRatio[n][bk[2]], G_TransientRatio[n][bk[3]]);
+        store_qmf4(&X_right[n], sb, _mm_mul_ps(G, R0_re), _mm_mul_ps(G, R0_im));
+
+        if (++delay >= 2)
+            delay = 0;
+        for (m = 0; m < NO_ALLPASS_LINKS; m++)
+        {
+            if (++delay_ser[m] >= ps->num_sample_delay_ser[m])
+                delay_ser[m] = 0;
+        }
+    }
+
+    *temp_delay = delay;
+    for (m = 0; m < NO_ALLPASS_LINKS; m++)
+        temp_delay_ser[m] = delay_ser[m];
+}
+#endif
+
 /* decorrelate the mono signal using an allpass filter */
-static void ps_decorrelate(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64],
+static void ps_decorrelate(ps_info *ps, qmf_row_t X_left[38], qmf_row_t X_right[38],
                            qmf_t X_hybrid_left[32][32], qmf_t X_hybrid_right[32][32])
 {
     uint8_t gr, n, bk;
@@ -1048,6 +1583,9 @@ static void ps_decorrelate(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][
     real_t P[32][34];
     real_t G_TransientRatio[32][34] = {{0}};
     complex_t inputLeft;
+    uint8_t first_bk = 0;
+    /* QMF subbands below sse_sb are allpass filtered by the SSE code */
+    uint8_t sse_sb = 0;
 
 
     /* chose hybrid filterbank: 20 or 34 band case */
@@ -1090,8 +1628,8 @@ static void ps_decorrelate(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][
                     RE(inputLeft) = QMF_RE(X_hybrid_left[n][sb]);
                     IM(inputLeft) = QMF_IM(X_hybrid_left[n][sb]);
                 } else {
-                    RE(inputLeft) = QMF_RE(X_left[n][sb]);
-                    IM(inputLeft) = QMF_IM(X_left[n][sb]);
+                    RE(inputLeft) = QMF_RE_AT(X_left[n], sb);
+                    IM(inputLeft) = QMF_IM_AT(X_left[n], sb);
                 }
 
                 /* accumulate energy */
@@ -1124,7 +1662,11 @@ static void ps_decorrelate(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][
 #endif
 
     /* calculate transient reduction ratio for each parameter band b(k) */
-    for (bk = 0; bk < ps->nr_par_bands; bk++)
+#ifdef USE_SSE
+    if (ps->sse)
+        first_bk = transient_ratio_sse(ps, P, G_TransientRatio);
+#endif
+    for (bk = first_bk; bk < ps->nr_par_bands; bk++)
     {
         for (n = ps->border_position[0]; n < ps->border_position[ps->num_env]; n++)
         {
@@ -1169,6 +1711,18 @@ static void ps_decorrelate(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][
 #endif
 
     /* apply stereo decorrelation filter to the signal */
+#ifdef USE_SSE
+    if (ps->sse)
+    {
+        uint8_t sb_end = min(ps->nr_allpass_bands + 1, ps->group_border[ps->num_groups]);
+
+        for (sse_sb = ps->group_border[ps->num_hybrid_groups]; sse_sb + 4 <= sb_end; sse_sb += 4)
+        {
+            allpass_qmf_sse(ps, X_left, X_right, G_TransientRatio, sse_sb,
+                &temp_delay, temp_delay_ser);
+        }
+    }
+#endif
     for (gr = 0; gr < ps->num_groups; gr++)
     {
         if (gr < ps->num_hybrid_groups)
@@ -1182,20 +1736,10 @@ static void ps_decorrelate(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][
             real_t g_DecaySlope;
             real_t g_DecaySlope_filt[NO_ALLPASS_LINKS];
 
-            /* g_DecaySlope: [0..1] */
-            if (gr < ps->num_hybrid_groups || sb <= ps->decay_cutoff)
-            {
-                g_DecaySlope = FRAC_CONST(1.0);
-            } else {
-                int8_t decay = ps->decay_cutoff - sb;
-                if (decay <= -20 /* -1/DECAY_SLOPE */)
-                {
-                    g_DecaySlope = 0;
-                } else {
-                    /* decay(int)*decay_slope(frac) = g_DecaySlope(frac) */
-                    g_DecaySlope = FRAC_CONST(1.0) + DECAY_SLOPE * decay;
-                }
-            }
+            if (gr >= ps->num_hybrid_groups && sb < sse_sb)
+                continue;
+
+            g_DecaySlope = decay_slope(ps, (gr < ps->num_hybrid_groups), sb);
 
             /* calculate g_DecaySlope_filt for every n multiplied by filter_a[n] */
             for (n = 0; n < NO_ALLPASS_LINKS; n++)
@@ -1221,8 +1765,8 @@ static void ps_decorrelate(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][
                     IM(inputLeft) = QMF_IM(X_hybrid_left[n][sb]);
                 } else {
                     /* QMF filterbank input */
-                    RE(inputLeft) = QMF_RE(X_left[n][sb]);
-                    IM(inputLeft) = QMF_IM(X_left[n][sb]);
+                    RE(inputLeft) = QMF_RE_AT(X_left[n], sb);
+                    IM(inputLeft) = QMF_IM_AT(X_left[n], sb);
                 }
 
                 if (sb > ps->nr_allpass_bands && gr >= ps->num_hybrid_groups)
@@ -1339,8 +1883,8 @@ static void ps_decorrelate(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][
                     QMF_IM(X_hybrid_right[n][sb]) = IM(R0);
                 } else {
                     /* QMF */
-                    QMF_RE(X_right[n][sb]) = RE(R0);
-                    QMF_IM(X_right[n][sb]) = IM(R0);
+                    QMF_RE_AT(X_right[n], sb) = RE(R0);
+                    QMF_IM_AT(X_right[n], sb) = IM(R0);
                 }
 
                 /* Update delay buffer index */
@@ -1453,7 +1997,51 @@ static real_t magnitude_c(complex_t c)
 #endif
 }
 
-static void ps_mix_phase(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64],
+#ifdef USE_SSE
+/* apply the mixing matrix of one group to 4 QMF subbands of time slot n at
+ * once, returns the first subband left for the scalar loop
+ */
+static SSE_TARGET uint8_t mix_qmf_sse(qmf_row_t *left, qmf_row_t *right, uint8_t sb, uint8_t maxsb,
+                                      complex_t *H11, complex_t *H12, complex_t *H21, complex_t *H22,
+                                      uint8_t ipdopd)
+{
+    const __m128 h11r = _mm_set1_ps(RE(*H11)), h11i = _mm_set1_ps(IM(*H11));
+    const __m128 h12r = _mm_set1_ps(RE(*H12)), h12i = _mm_set1_ps(IM(*H12));
+    const __m128 h21r = _mm_set1_ps(RE(*H21)), h21i = _mm_set1_ps(IM(*H21));
+    const __m128 h22r = _mm_set1_ps(RE(*H22)), h22i = _mm_set1_ps(IM(*H22));
+
+    for (; sb + 4 <= maxsb; sb += 4)
+    {
+        __m128 inL_re, inL_im, inR_re, inR_im;
+        __m128 tL_re, tL_im, tR_re, tR_im;
+
+        load_qmf4(left, sb, &inL_re, &inL_im);
+        load_qmf4(right, sb, &inR_re, &inR_im);
+
+        /* apply mixing */
+        tL_re = _mm_add_ps(_mm_mul_ps(h11r, inL_re), _mm_mul_ps(h21r, inR_re));
+        tL_im = _mm_add_ps(_mm_mul_ps(h11r, inL_im), _mm_mul_ps(h21r, inR_im));
+        tR_re = _mm_add_ps(_mm_mul_ps(h12r, inL_re), _mm_mul_ps(h22r, inR_re));
+        tR_im = _mm_add_ps(_mm_mul_ps(h12r, inL_im), _mm_mul_ps(h22r, inR_im));
+
+        if (ipdopd)
+        {
+            /* apply rotation */
+            tL_re = _mm_sub_ps(tL_re, _mm_add_ps(_mm_mul_ps(h11i, inL_im), _mm_mul_ps(h21i, inR_im)));
+            tL_im = _mm_add_ps(tL_im, _mm_add_ps(_mm_mul_ps(h11i, inL_re), _mm_mul_ps(h21i, inR_re)));
+            tR_re = _mm_sub_ps(tR_re, _mm_add_ps(_mm_mul_ps(h12i, inL_im), _mm_mul_ps(h22i, inR_im)));
+            tR_im = _mm_add_ps(tR_im, _mm_add_ps(_mm_mul_ps(h12i, inL_re), _mm_mul_ps(h22i, inR_re)));
+        }
+
+        store_qmf4(left, sb, tL_re, tL_im);
+        store_qmf4(right, sb, tR_re, tR_im);
+    }
+
+    return sb;
+}
+#endif
+
+static void ps_mix_phase(ps_info *ps, qmf_row_t X_left[38], qmf_row_t X_right[38],
                          qmf_t X_hybrid_left[32][32], qmf_t X_hybrid_right[32][32])
 {
     uint8_t n;
@@ -1712,32 +2300,52 @@ static void ps_mix_phase(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64
                 // cos(atan2(x,y)-atan2(p,q)) = (y*q + x*p) / ( sqrt((x*x) + (y*y)) * sqrt((p*p) + (q*q)) );
                 // sin(atan2(x,y)-atan2(p,q)) = (x*q - y*p) / ( sqrt((x*x) + (y*y)) * sqrt((p*p) + (q*q)) );
 
-                xy = magnitude_c(tempRight);
-                pq = magnitude_c(tempLeft);
-
-                if (xy != 0)
+#if !defined(FIXED_POINT) && !defined(USE_DOUBLE_PRECISION)
+                if (ps->fast_math)
                 {
-                    RE(phaseLeft) = DIV_F(RE(tempRight), xy);
-                    IM(phaseLeft) = DIV_F(IM(tempRight), xy);
-                } else {
-                    RE(phaseLeft) = 0;
-                    IM(phaseLeft) = 0;
-                }
+                    /* xy and pq hold the reciprocal magnitudes here */
+                    real_t xy2 = RE(tempRight)*RE(tempRight) + IM(tempRight)*IM(tempRight);
+                    real_t pq2 = RE(tempLeft)*RE(tempLeft) + IM(tempLeft)*IM(tempLeft);
+                    real_t tmp1 = RE(tempRight)*RE(tempLeft) + IM(tempRight)*IM(tempLeft);
+                    real_t tmp2 = IM(tempRight)*RE(tempLeft) - RE(tempRight)*IM(tempLeft);
+
+                    xy = (xy2 > 0) ? faad_rsqrt(xy2) : 0;
+                    pq = (pq2 > 0) ? faad_rsqrt(pq2) : 0;
+                    xypq = xy * pq;
+
+                    RE(phaseLeft) = RE(tempRight) * xy;
+                    IM(phaseLeft) = IM(tempRight) * xy;
+                    RE(phaseRight) = tmp1 * xypq;
+                    IM(phaseRight) = tmp2 * xypq;
+                } else
+#endif
+                {
+                    xy = magnitude_c(tempRight);
+                    pq = magnitude_c(tempLeft);
 
-                xypq = MUL_F(xy, pq);
+                    if (xy != 0)
+                    {
+                        RE(phaseLeft) = DIV_F(RE(tempRight), xy);
+                        IM(phaseLeft) = DIV_F(IM(tempRight), xy);
+                    } else {
+                        RE(phaseLeft) = 0;
+                        IM(phaseLeft) = 0;
+                    }
 
-                if (xypq != 0)
-                {
-                    real_t tmp1 = MUL_F(RE(tempRight), RE(tempLeft)) + MUL_F(IM(tempRight), IM(tempLeft));
-                    real_t tmp2 = MUL_F(IM(tempRight), RE(tempLeft)) - MUL_F(RE(tempRight), IM(tempLeft));
+                    xypq = MUL_F(xy, pq);
 
-                    RE(phaseRight) = DIV_F(tmp1, xypq);
-                    IM(phaseRight) = DIV_F(tmp2, xypq);
-                } else {
-                    RE(phaseRight) = 0;
-                    IM(phaseRight) = 0;
-                }
+                    if (xypq != 0)
+                    {
+                        real_t tmp1 = MUL_F(RE(tempRight), RE(tempLeft)) + MUL_F(IM(tempRight), IM(tempLeft));
+                        real_t tmp2 = MUL_F(IM(tempRight), RE(tempLeft)) - MUL_F(RE(tempRight), IM(tempLeft));
 
+                        RE(phaseRight) = DIV_F(tmp1, xypq);
+                        IM(phaseRight) = DIV_F(tmp2, xypq);
+                    } else {
+                        RE(phaseRight) = 0;
+                        IM(phaseRight) = 0;
+                    }
+                }
 #endif
 
                 /* MUL_F(COEF, REAL) = COEF */
@@ -1767,6 +2375,7 @@ static void ps_mix_phase(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64
             RE(H21) = RE(ps->h21_prev[gr]);
             RE(H22) = RE(ps->h22_prev[gr]);
             IM(H11) = IM(H12) = IM(H21) = IM(H22) = 0;
+            IM(deltaH11) = IM(deltaH12) = IM(deltaH21) = IM(deltaH22) = 0;
 
             RE(ps->h11_prev[gr]) = RE(h11);
             RE(ps->h12_prev[gr]) = RE(h12);
@@ -1822,8 +2431,17 @@ static void ps_mix_phase(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64
                     IM(H22) += IM(deltaH22);
                 }
 
+                sb = ps->group_border[gr];
+#ifdef USE_SSE
+                if (ps->sse && gr >= ps->num_hybrid_groups)
+                {
+                    sb = mix_qmf_sse(&X_left[n], &X_right[n], sb, maxsb, &H11, &H12, &H21, &H22,
+                        (ps->enable_ipdopd) && (bk < nr_ipdopd_par));
+                }
+#endif
+
                 /* channel is an alias to the subband */
-                for (sb = ps->group_border[gr]; sb < maxsb; sb++)
+                for (; sb < maxsb; sb++)
                 {
                     complex_t inLeft, inRight;  // precision_of in(Left|Right) == precision_of X_(left|right)
 
@@ -1835,10 +2453,10 @@ static void ps_mix_phase(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64
                         RE(inRight) = RE(X_hybrid_right[n][sb]);
                         IM(inRight) = IM(X_hybrid_right[n][sb]);
                     } else {
-                        RE(inLeft) =  RE(X_left[n][sb]);
-                        IM(inLeft) =  IM(X_left[n][sb]);
-                        RE(inRight) = RE(X_right[n][sb]);
-                        IM(inRight) = IM(X_right[n][sb]);
+                        RE(inLeft) =  QMF_RE_AT(X_left[n], sb);
+                        IM(inLeft) =  QMF_IM_AT(X_left[n], sb);
+                        RE(inRight) = QMF_RE_AT(X_right[n], sb);
+                        IM(inRight) = QMF_IM_AT(X_right[n], sb);
                     }
 
                     /* precision_of temp(Left|Right) == precision_of X_(left|right) */
@@ -1867,10 +2485,10 @@ static void ps_mix_phase(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64
                         RE(X_hybrid_right[n][sb]) = RE(tempRight);
                         IM(X_hybrid_right[n][sb]) = IM(tempRight);
                     } else {
-                        RE(X_left[n][sb])  = RE(tempLeft);
-                        IM(X_left[n][sb])  = IM(tempLeft);
-                        RE(X_right[n][sb]) = RE(tempRight);
-                        IM(X_right[n][sb]) = IM(tempRight);
+                        QMF_RE_AT(X_left[n], sb)  = RE(tempLeft);
+                        QMF_IM_AT(X_left[n], sb)  = IM(tempLeft);
+                        QMF_RE_AT(X_right[n], sb) = RE(tempRight);
+                        QMF_IM_AT(X_right[n], sb) = IM(tempRight);
                     }
                 }
             }
@@ -1885,24 +2503,37 @@ static void ps_mix_phase(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64
     }
 }
 
-void ps_free(ps_info *ps)
+void ps_free(allocator_info *alloc, ps_info *ps)
 {
     /* free hybrid filterbank structures */
-    hybrid_free(ps->hyb);
+    hybrid_free(alloc, ps->hyb);
 
-    faad_free(ps);
+    faad_free(alloc, ps);
 }
 
-ps_info *ps_init(uint8_t sr_index, uint8_t numTimeSlotsRate)
+ps_info *ps_init(allocator_info *alloc, uint8_t sr_index, uint8_t numTimeSlotsRate,
+                 uint8_t fast_math)
 {
     uint8_t i;
     uint8_t short_delay_band;
 
-    ps_info *ps = (ps_info*)faad_malloc(sizeof(ps_info));
+    ps_info *ps = (ps_info*)faad_malloc(alloc, sizeof(ps_info));
+    if (ps == NULL)
+        return NULL;
     memset(ps, 0, sizeof(ps_info));
 
-    ps->hyb = hybrid_init(numTimeSlotsRate);
+    ps->hyb = hybrid_init(alloc, numTimeSlotsRate);
+    if (ps->hyb == NULL)
+    {
+        faad_free(alloc, ps);
+        return NULL;
+    }
     ps->numTimeSlotsRate = numTimeSlotsRate;
+    ps->fast_math = fast_math;
+
+#ifdef USE_SSE
+    ps->sse = cpu_has_sse();
+#endif
 
     ps->ps_data_available = 0;
 
@@ -1989,7 +2620,7 @@ ps_info *ps_init(uint8_t sr_index, uint8_t numTimeSlotsRate)
 }
 
 /* main Parametric Stereo decoding function */
-uint8_t ps_decode(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64])
+uint8_t ps_decode(ps_info *ps, qmf_row_t X_left[38], qmf_row_t X_right[38])
 {
     qmf_t X_hybrid_left[32][32] = {{{0}}};
     qmf_t X_hybrid_right[32][32] = {{{0}}};
@@ -2015,6 +2646,11 @@ uint8_t ps_decode(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64])
         ps->decay_cutoff = 3;
     }
 
+#ifdef USE_SSE
+    /* the hybrid filters follow the SSE setting of the PS decoder */
+    ((hyb_info*)ps->hyb)->sse = ps->sse;
+#endif
+
     /* Perform further analysis on the lowest subbands to get a higher
      * frequency resolution
      */
@@ -136,16 +136,24 @@ typedef struct
 
     /* hybrid filterbank parameters */
     void *hyb;
+
+    /* approximate phase normalisation, see sbr_info.fast_math */
+    uint8_t fast_math;
+
+#ifdef USE_SSE
+    uint8_t sse;
+#endif
 } ps_info;
 
 /* ps_syntax.c */
 uint16_t ps_data(ps_info *ps, bitfile *ld, uint8_t *header);
 
 /* ps_dec.c */
-ps_info *ps_init(uint8_t sr_index, uint8_t numTimeSlotsRate);
-void ps_free(ps_info *ps);
+ps_info *ps_init(allocator_info *alloc, uint8_t sr_index, uint8_t numTimeSlotsRate,
+                 uint8_t fast_math);
+void ps_free(allocator_info *alloc, ps_info *ps);
 
-uint8_t ps_decode(ps_info *ps, qmf_t X_left[38][64], qmf_t X_right[38][64]);
+uint8_t ps_decode(ps_info *ps, qmf_row_t X_left[38], qmf_row_t X_right[38]);
 
 
 #ifdef __cplusplus
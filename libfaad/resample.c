@@ -0,0 +1,345 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**
+** $Id: resample.c,v 1.0 $
+**/
+
+#include "common.h"
+#include "structs.h"
+
+#ifndef FIXED_POINT
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef USE_SSE
+#include <xmmintrin.h>
+#endif
+
+#include "resample.h"
+
+/* cutoff of the lowpass relative to the lower of the two Nyquist
+   frequencies; with RESAMPLE_TAPS taps at the lower rate the Kaiser
+   window gives about 80 dB stopband from that Nyquist frequency on */
+#define RESAMPLE_CUTOFF 0.92
+#define RESAMPLE_BETA   8.0
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0)
+    {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* zeroth order modified Bessel function of the first kind */
+static double bessel_i0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    int k;
+
+    for (k = 1; k < 32; k++)
+    {
+        term *= (x / (2*k)) * (x / (2*k));
+        sum += term;
+    }
+    return sum;
+}
+
+/* Kaiser windowed sinc, phase p interpolates at p/up input samples after
+ * tap taps/2-1; every phase is normalised to unity gain at DC
+ */
+static void resample_filter(resampler *rs)
+{
+    uint16_t p, k;
+    double half = rs->taps / 2;
+    double fc = RESAMPLE_CUTOFF;
+    double norm = 1.0 / bessel_i0(RESAMPLE_BETA);
+
+    if (rs->down > rs->up)
+        fc = fc * rs->up / rs->down;
+
+    for (p = 0; p < rs->up; p++)
+    {
+        real_t *coef = rs->coef + p*rs->taps;
+        double h[RESAMPLE_TAPS*RESAMPLE_MAX_RATIO];
+        double sum = 0.0;
+
+        for (k = 0; k < rs->taps; k++)
+        {
+            double d = (double)p / rs->up + half - 1 - k;
+            double x = M_PI * fc * d;
+            double w = d / half;
+            double sinc = (x == 0.0) ? 1.0 : sin(x) / x;
+
+            h[k] = sinc * bessel_i0(RESAMPLE_BETA * sqrt(max(0.0, 1.0 - w*w))) * norm;
+            sum += h[k];
+        }
+        for (k = 0; k < rs->taps; k++)
+            coef[k] = (real_t)(h[k] / sum);
+    }
+}
+
+resampler *resample_init(allocator_info *alloc, uint32_t in_rate, uint32_t out_rate,
+                         uint16_t frame_len, uint8_t channels, uint8_t sse)
+{
+    uint8_t ch;
+    uint32_t g, taps;
+    resampler *rs;
+
+    if ((in_rate == 0) || (out_rate == 0) || (channels == 0))
+        return NULL;
+
+    g = gcd(in_rate, out_rate);
+    if ((out_rate / g > RESAMPLE_MAX_PHASES) ||
+        (out_rate > in_rate * RESAMPLE_MAX_RATIO) || (in_rate > out_rate * RESAMPLE_MAX_RATIO))
+    {
+        return NULL;
+    }
+
+    rs = (resampler*)faad_malloc(alloc, sizeof(resampler));
+    if (rs == NULL)
+        return NULL;
+    memset(rs, 0, sizeof(resampler));
+
+    rs->in_rate = in_rate;
+    rs->out_rate = out_rate;
+    rs->up = (uint16_t)(out_rate / g);
+    rs->down = (uint16_t)(in_rate / g);
+
+    /* the filter spans RESAMPLE_TAPS samples of the lower rate,
+       in multiples of 16 for the 16 lane dot product */
+    taps = RESAMPLE_TAPS;
+    if (rs->down > rs->up)
+        taps = (RESAMPLE_TAPS * (uint32_t)rs->down + rs->up - 1) / rs->up;
+    rs->taps = (uint16_t)((taps + 15) & ~15);
+
+    rs->frame_len = frame_len;
+    rs->max_out = (uint16_t)(((uint32_t)frame_len + rs->taps) * rs->up / rs->down + 1);
+    rs->channels = channels;
+#ifdef USE_SSE
+    rs->sse = sse;
+#else
+    (void)sse;
+#endif
+
+    rs->coef = (real_t*)faad_malloc(alloc, rs->up * rs->taps * sizeof(real_t));
+    rs->hist = (real_t**)faad_malloc(alloc, channels * sizeof(real_t*));
+    rs->out = (real_t**)faad_malloc(alloc, channels * sizeof(real_t*));
+    if ((rs->coef == NULL) || (rs->hist == NULL) || (rs->out == NULL))
+    {
+        resample_end(alloc, rs);
+        return NULL;
+    }
+    memset(rs->hist, 0, channels * sizeof(real_t*));
+    memset(rs->out, 0, channels * sizeof(real_t*));
+
+    for (ch = 0; ch < channels; ch++)
+    {
+        rs->hist[ch] = (real_t*)faad_malloc(alloc, (rs->taps + frame_len) * sizeof(real_t));
+        rs->out[ch] = (real_t*)faad_malloc(alloc, rs->max_out * sizeof(real_t));
+        if ((rs->hist[ch] == NULL) || (rs->out[ch] == NULL))
+        {
+            resample_end(alloc, rs);
+            return NULL;
+        }
+    }
+
+    resample_filter(rs);
+    resample_reset(rs);
+
+    return rs;
+}
+
+void resample_end(allocator_info *alloc, resampler *rs)
+{
+    uint8_t ch;
+
+    if (rs == NULL)
+        return;
+
+    for (ch = 0; ch < rs->channels; ch++)
+    {
+        if (rs->hist && rs->hist[ch]) faad_free(alloc, rs->hist[ch]);
+        if (rs->out && rs->out[ch]) faad_free(alloc, rs->out[ch]);
+    }
+    if (rs->hist) faad_free(alloc, rs->hist);
+    if (rs->out) faad_free(alloc, rs->out);
+    if (rs->coef) faad_free(alloc, rs->coef);
+
+    faad_free(alloc, rs);
+}
+
+/* the first input sample lines up with the center of the filter, so the
+ * conversion adds no delay
+ */
+void resample_reset(resampler *rs)
+{
+    uint8_t ch;
+
+    rs->fill = rs->taps/2 - 1;
+    rs->phase = 0;
+
+    for (ch = 0; ch < rs->channels; ch++)
+        memset(rs->hist[ch], 0, rs->fill * sizeof(real_t));
+}
+
+/* the dot products sum in 16 lanes, lane j+8 is added to lane j, then
+ * lane j+4, and the 4 lanes left are added as (0+2)+(1+3); both versions
+ * keep this order so that they give the same output
+ */
+static uint16_t resample_channel(const resampler *rs, const real_t *in, real_t *out,
+                                 uint16_t avail, uint16_t *pos_end, uint16_t *phase_end)
+{
+    uint16_t n = 0;
+    uint32_t pos = 0;
+    uint32_t phase = rs->phase;
+    uint32_t step = rs->down / rs->up;
+    uint32_t frac = rs->down % rs->up;
+
+    while (pos + rs->taps <= avail)
+    {
+        const real_t *coef = rs->coef + phase*rs->taps;
+        const real_t *x = in + pos;
+        real_t s[16] = { 0 };
+        uint16_t k, j;
+
+        for (k = 0; k < rs->taps; k += 16)
+        {
+            for (j = 0; j < 16; j++)
+                s[j] += coef[k+j] * x[k+j];
+        }
+        for (j = 0; j < 8; j++)
+            s[j] += s[j+8];
+        for (j = 0; j < 4; j++)
+            s[j] += s[j+4];
+        out[n++] = (s[0] + s[2]) + (s[1] + s[3]);
+
+        pos += step;
+        phase += frac;
+        if (phase >= rs->up)
+        {
+            phase -= rs->up;
+            pos++;
+        }
+    }
+
+    *pos_end = (uint16_t)pos;
+    *phase_end = (uint16_t)phase;
+
+    return n;
+}
+
+#ifdef USE_SSE
+static SSE_TARGET uint16_t resample_channel_sse(const resampler *rs, const real_t *in, real_t *out,
+                                                uint16_t avail, uint16_t *pos_end, uint16_t *phase_end)
+{
+    uint16_t n = 0;
+    uint32_t pos = 0;
+    uint32_t phase = rs->phase;
+    uint32_t step = rs->down / rs->up;
+    uint32_t frac = rs->down % rs->up;
+
+    while (pos + rs->taps <= avail)
+    {
+        const real_t *coef = rs->coef + phase*rs->taps;
+        const real_t *x = in + pos;
+        __m128 s0 = _mm_setzero_ps();
+        __m128 s1 = _mm_setzero_ps();
+        __m128 s2 = _mm_setzero_ps();
+        __m128 s3 = _mm_setzero_ps();
+        uint16_t k;
+
+        for (k = 0; k < rs->taps; k += 16)
+        {
+            s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(coef + k), _mm_loadu_ps(x + k)));
+            s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_loadu_ps(coef + k + 4), _mm_loadu_ps(x + k + 4)));
+            s2 = _mm_add_ps(s2, _mm_mul_ps(_mm_loadu_ps(coef + k + 8), _mm_loadu_ps(x + k + 8)));
+            s3 = _mm_add_ps(s3, _mm_mul_ps(_mm_loadu_ps(coef + k + 12), _mm_loadu_ps(x + k + 12)));
+        }
+        s0 = _mm_add_ps(_mm_add_ps(s0, s2), _mm_add_ps(s1, s3));
+        s0 = _mm_add_ps(s0, _mm_movehl_ps(s0, s0));
+        s0 = _mm_add_ss(s0, _mm_shuffle_ps(s0, s0, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(&out[n++], s0);
+
+        pos += step;
+        phase += frac;
+        if (phase >= rs->up)
+        {
+            phase -= rs->up;
+            pos++;
+        }
+    }
+
+    *pos_end = (uint16_t)pos;
+    *phase_end = (uint16_t)phase;
+
+    return n;
+}
+#endif
+
+/* converts frame_len samples of every channel, returns the number of
+ * samples in rs->out; it varies by one from frame to frame when
+ * frame_len*up is not a multiple of down
+ */
+uint16_t resample_frame(resampler *rs, real_t **input, uint16_t frame_len)
+{
+    uint8_t ch;
+    uint16_t n = 0;
+    uint16_t pos = 0;
+    uint16_t phase = rs->phase;
+    uint16_t avail = rs->fill + frame_len;
+
+    for (ch = 0; ch < rs->channels; ch++)
+    {
+        memcpy(rs->hist[ch] + rs->fill, input[ch], frame_len * sizeof(real_t));
+
+#ifdef USE_SSE
+        if (rs->sse)
+        {
+            n = resample_channel_sse(rs, rs->hist[ch], rs->out[ch], avail, &pos, &phase);
+        } else
+#endif
+        {
+            n = resample_channel(rs, rs->hist[ch], rs->out[ch], avail, &pos, &phase);
+        }
+
+        /* keep the input the next output samples still need */
+        memmove(rs->hist[ch], rs->hist[ch] + pos, (avail - pos) * sizeof(real_t));
+    }
+
+    rs->fill = avail - pos;
+    rs->phase = phase;
+
+    return n;
+}
+
+#endif
@@ -0,0 +1,82 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**
+** $Id: resample.h,v 1.0 $
+**/
+
+#ifndef __RESAMPLE_H__
+#define __RESAMPLE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* filter length per phase at the lower of the two rates */
+#define RESAMPLE_TAPS       64
+/* limits of the conversion: phases of out_rate/in_rate in lowest terms,
+   and the factor between the rates */
+#define RESAMPLE_MAX_PHASES 1024
+#define RESAMPLE_MAX_RATIO  16
+
+/* polyphase sample rate converter between the decoded channels and the
+   PCM conversion, one up/down phase per output sample */
+typedef struct
+{
+    uint32_t in_rate;
+    uint32_t out_rate;
+    /* out_rate/in_rate reduced to up/down, up is the number of phases */
+    uint16_t up;
+    uint16_t down;
+    uint16_t taps;
+    /* taps coefficients per phase */
+    real_t *coef;
+
+    uint16_t frame_len;
+    /* most samples one frame can give */
+    uint16_t max_out;
+    uint8_t channels;
+    /* per channel: unused input of the previous frame followed by the new
+       frame, and the converted output */
+    real_t **hist;
+    real_t **out;
+    /* phase of the next output sample and input samples in hist */
+    uint16_t phase;
+    uint16_t fill;
+
+    uint8_t sse;
+} resampler;
+
+resampler *resample_init(allocator_info *alloc, uint32_t in_rate, uint32_t out_rate,
+                         uint16_t frame_len, uint8_t channels, uint8_t sse);
+void resample_end(allocator_info *alloc, resampler *rs);
+void resample_reset(resampler *rs);
+uint16_t resample_frame(resampler *rs, real_t **input, uint16_t frame_len);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -119,7 +119,8 @@ uint8_t rvlc_scale_factor_data(ic_stream *ics, bitfile *ld)
     return 0;
 }
 
-uint8_t rvlc_decode_scale_factors(ic_stream *ics, bitfile *ld)
+/* buffer holds RVLC_BUFFER_SIZE bytes */
+uint8_t rvlc_decode_scale_factors(ic_stream *ics, bitfile *ld, uint8_t *buffer)
 {
     uint8_t result;
     uint8_t intensity_used = 0;
@@ -133,7 +134,7 @@ uint8_t rvlc_decode_scale_factors(ic_stream *ics, bitfile *ld)
         /* We read length_of_rvlc_sf bits here to put it in a
            seperate bitfile.
         */
-        rvlc_sf_buffer = faad_getbitbuffer(ld, ics->length_of_rvlc_sf
+        rvlc_sf_buffer = faad_getbitbuffer(ld, buffer, ics->length_of_rvlc_sf
             DEBUGVAR(1,156,"rvlc_decode_scale_factors(): bitbuffer: length_of_rvlc_sf"));
 
         faad_initbits(&ld_rvlc_sf, (void*)rvlc_sf_buffer, bit2byte(ics->length_of_rvlc_sf));
@@ -150,7 +151,7 @@ uint8_t rvlc_decode_scale_factors(ic_stream *ics, bitfile *ld)
         /* We read length_of_rvlc_escapes bits here to put it in a
            seperate bitfile.
         */
-        rvlc_esc_buffer = faad_getbitbuffer(ld, ics->length_of_rvlc_escapes
+        rvlc_esc_buffer = faad_getbitbuffer(ld, buffer + RVLC_BUFFER_SIZE - 32, ics->length_of_rvlc_escapes
             DEBUGVAR(1,157,"rvlc_decode_scale_factors(): bitbuffer: length_of_rvlc_escapes"));
 
         faad_initbits(&ld_rvlc_esc, (void*)rvlc_esc_buffer, bit2byte(ics->length_of_rvlc_escapes));
@@ -169,9 +170,6 @@ uint8_t rvlc_decode_scale_factors(ic_stream *ics, bitfile *ld)
 //        &ld_rvlc_esc_rev, intensity_used);
 
 
-    if (rvlc_esc_buffer) faad_free(rvlc_esc_buffer);
-    if (rvlc_sf_buffer) faad_free(rvlc_sf_buffer);
-
     if (ics->length_of_rvlc_sf > 0)
         faad_endbits(&ld_rvlc_sf);
     if (ics->sf_escapes_present)
@@ -45,9 +45,13 @@ typedef struct
 
 #define ESC_VAL 7
 
+/* bytes of the scratch buffer of rvlc_decode_scale_factors(): up to
+   2047 bits of scalefactor codewords and 255 bits of escapes */
+#define RVLC_BUFFER_SIZE (256 + 32)
+
 
 uint8_t rvlc_scale_factor_data(ic_stream *ics, bitfile *ld);
-uint8_t rvlc_decode_scale_factors(ic_stream *ics, bitfile *ld);
+uint8_t rvlc_decode_scale_factors(ic_stream *ics, bitfile *ld, uint8_t *buffer);
 
 
 #ifdef __cplusplus
@@ -45,6 +45,10 @@
 
 #include "sbr_dct.h"
 
+#ifdef USE_SSE
+#include <xmmintrin.h>
+#endif
+
 void DCT4_32(real_t *y, real_t *x)
 {
     real_t f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10;
@@ -894,8 +898,7 @@ void DST4_32(real_t *y, real_t *x)
     y[0] = MUL_R(REAL_CONST(20.3738781672314530), f304);
 }
 
-#ifdef SBR_LOW_POWER
-
+/* real valued transforms used by the low power SBR filterbanks */
 void DCT2_16_unscaled(real_t *y, real_t *x)
 {
     real_t f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10;
@@ -1862,8 +1865,7 @@ void DCT2_32_unscaled(real_t *y, real_t *x)
     y[17] = f286 - f285;
 }
 
-#else
-
+#ifndef SBR_LOW_POWER
 
 #define n 32
 #define log2n 5
@@ -2274,6 +2276,380 @@ void dct4_kernel(real_t * in_real, real_t * in_imag, real_t * out_real, real_t *
 
 }
 
+#ifdef USE_SSE
+/* four entries with stride 2 */
+static INLINE SSE_TARGET __m128 load_even(const real_t *a)
+{
+    return _mm_shuffle_ps(_mm_loadu_ps(a), _mm_loadu_ps(a + 4), _MM_SHUFFLE(2,0,2,0));
+}
+
+/* SSE version of dct4_kernel, same operations in the same order so the
+ * output is identical.
+ * Stages 1 and 2 of the FFT work on 4 consecutive points. For stages 3-5
+ * each block of 16 points is transposed, making the butterflies within
+ * a group of 4 vertical. The transposed blocks are left in in_real and
+ * in_imag, from where the final modulation picks them up in bit reversed
+ * order with a few shuffles.
+ */
+SSE_TARGET void dct4_kernel_sse(real_t * in_real, real_t * in_imag, real_t * out_real, real_t * out_imag)
+{
+    uint32_t i, j;
+
+    /* Step 2: modulate */
+    for (i = 0; i < 32; i += 4)
+    {
+        __m128 x_re = _mm_loadu_ps(in_real + i);
+        __m128 x_im = _mm_loadu_ps(in_imag + i);
+        __m128 tmp = _mm_mul_ps(_mm_add_ps(x_re, x_im), _mm_loadu_ps(dct4_64_tab + i));
+
+        _mm_storeu_ps(in_real + i, _mm_add_ps(_mm_mul_ps(x_im, _mm_loadu_ps(dct4_64_tab + i + 64)), tmp));
+        _mm_storeu_ps(in_imag + i, _mm_add_ps(_mm_mul_ps(x_re, _mm_loadu_ps(dct4_64_tab + i + 32)), tmp));
+    }
+
+    /* Step 3: FFT */
+    /* stage 1 */
+    for (i = 0; i < 16; i += 4)
+    {
+        __m128 p1_re = _mm_loadu_ps(in_real + i);
+        __m128 p1_im = _mm_loadu_ps(in_imag + i);
+        __m128 p2_re = _mm_loadu_ps(in_real + i + 16);
+        __m128 p2_im = _mm_loadu_ps(in_imag + i + 16);
+        __m128 w_re = _mm_loadu_ps(w_array_real + i);
+        __m128 w_im = _mm_loadu_ps(w_array_imag + i);
+        __m128 d_re = _mm_sub_ps(p1_re, p2_re);
+        __m128 d_im = _mm_sub_ps(p1_im, p2_im);
+
+        _mm_storeu_ps(in_real + i, _mm_add_ps(p1_re, p2_re));
+        _mm_storeu_ps(in_imag + i, _mm_add_ps(p1_im, p2_im));
+        _mm_storeu_ps(in_real + i + 16, _mm_sub_ps(_mm_mul_ps(d_re, w_re), _mm_mul_ps(d_im, w_im)));
+        _mm_storeu_ps(in_imag + i + 16, _mm_add_ps(_mm_mul_ps(d_re, w_im), _mm_mul_ps(d_im, w_re)));
+    }
+    /* stage 2 */
+    for (j = 0; j < 8; j += 4)
+    {
+        __m128 w_re = load_even(w_array_real + 2*j);
+        __m128 w_im = load_even(w_array_imag + 2*j);
+
+        for (i = j; i < 32; i += 16)
+        {
+            __m128 p1_re = _mm_loadu_ps(in_real + i);
+            __m128 p1_im = _mm_loadu_ps(in_imag + i);
+            __m128 p2_re = _mm_loadu_ps(in_real + i + 8);
+            __m128 p2_im = _mm_loadu_ps(in_imag + i + 8);
+            __m128 d_re = _mm_sub_ps(p1_re, p2_re);
+            __m128 d_im = _mm_sub_ps(p1_im, p2_im);
+
+            _mm_storeu_ps(in_real + i, _mm_add_ps(p1_re, p2_re));
+            _mm_storeu_ps(in_imag + i, _mm_add_ps(p1_im, p2_im));
+            _mm_storeu_ps(in_real + i + 8, _mm_sub_ps(_mm_mul_ps(d_re, w_re), _mm_mul_ps(d_im, w_im)));
+            _mm_storeu_ps(in_imag + i + 8, _mm_add_ps(_mm_mul_ps(d_re, w_im), _mm_mul_ps(d_im, w_re)));
+        }
+    }
+    /* stages 3, 4 and 5, per block of 16 */
+    for (i = 0; i < 32; i += 16)
+    {
+        /* the 4 lanes of stage 3 use twiddles 1, w^4, -i and w^12 */
+        const __m128 w = _mm_set_ps(w_array_real[12], 1.0f, w_array_real[4], 1.0f);
+        __m128 re[4], im[4];
+        __m128 t_re, t_im;
+
+        for (j = 0; j < 4; j += 2)
+        {
+            __m128 p1_re = _mm_loadu_ps(in_real + i + 4*j);
+            __m128 p1_im = _mm_loadu_ps(in_imag + i + 4*j);
+            __m128 p2_re = _mm_loadu_ps(in_real + i + 4*j + 4);
+            __m128 p2_im = _mm_loadu_ps(in_imag + i + 4*j + 4);
+            __m128 d_re = _mm_sub_ps(p1_re, p2_re);
+            __m128 d_im = _mm_sub_ps(p1_im, p2_im);
+            __m128 s = _mm_add_ps(d_re, d_im);
+            __m128 a, b;
+
+            re[j] = _mm_add_ps(p1_re, p2_re);
+            im[j] = _mm_add_ps(p1_im, p2_im);
+
+            /* re: d_re, d_re+d_im, d_im, d_re-d_im */
+            a = _mm_shuffle_ps(d_re, s, _MM_SHUFFLE(1,1,0,0));
+            b = _mm_shuffle_ps(d_im, _mm_sub_ps(d_re, d_im), _MM_SHUFFLE(3,3,2,2));
+            re[j+1] = _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0)), w);
+            /* im: d_im, d_im-d_re, p2_re-p1_re, d_re+d_im */
+            a = _mm_shuffle_ps(d_im, _mm_sub_ps(d_im, d_re), _MM_SHUFFLE(1,1,0,0));
+            b = _mm_shuffle_ps(_mm_sub_ps(p2_re, p1_re), s, _MM_SHUFFLE(3,3,2,2));
+            im[j+1] = _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0)), w);
+        }
+
+        _MM_TRANSPOSE4_PS(re[0], re[1], re[2], re[3]);
+        _MM_TRANSPOSE4_PS(im[0], im[1], im[2], im[3]);
+
+        /* stage 4 */
+        t_re = re[0];
+        t_im = im[0];
+        re[0] = _mm_add_ps(t_re, re[2]);
+        im[0] = _mm_add_ps(t_im, im[2]);
+        re[2] = _mm_sub_ps(t_re, re[2]);
+        im[2] = _mm_sub_ps(t_im, im[2]);
+        t_re = re[1];
+        t_im = im[1];
+        re[1] = _mm_add_ps(t_re, re[3]);
+        im[1] = _mm_add_ps(t_im, im[3]);
+        t_re = _mm_sub_ps(re[3], t_re);
+        re[3] = _mm_sub_ps(t_im, im[3]);
+        im[3] = t_re;
+
+        /* stage 5 */
+        for (j = 0; j < 4; j += 2)
+        {
+            _mm_storeu_ps(in_real + i + 4*j,     _mm_add_ps(re[j], re[j+1]));
+            _mm_storeu_ps(in_imag + i + 4*j,     _mm_add_ps(im[j], im[j+1]));
+            _mm_storeu_ps(in_real + i + 4*j + 4, _mm_sub_ps(re[j], re[j+1]));
+            _mm_storeu_ps(in_imag + i + 4*j + 4, _mm_sub_ps(im[j], im[j+1]));
+        }
+    }
+
+    /* Step 4: modulate + bitreverse reordering */
+    for (j = 0; j < 4; j++)
+    {
+        /* the transposed points 4*j..4*j+3 of both blocks hold outputs
+           b + {0,4,2,6} and b + {1,5,3,7} */
+        const uint32_t b = 16*(j & 1) + 8*(j >> 1);
+        __m128 lo_re = _mm_unpacklo_ps(_mm_loadu_ps(in_real + 4*j), _mm_loadu_ps(in_real + 16 + 4*j));
+        __m128 hi_re = _mm_unpackhi_ps(_mm_loadu_ps(in_real + 4*j), _mm_loadu_ps(in_real + 16 + 4*j));
+        __m128 lo_im = _mm_unpacklo_ps(_mm_loadu_ps(in_imag + 4*j), _mm_loadu_ps(in_imag + 16 + 4*j));
+        __m128 hi_im = _mm_unpackhi_ps(_mm_loadu_ps(in_imag + 4*j), _mm_loadu_ps(in_imag + 16 + 4*j));
+        __m128 x_re[2], x_im[2];
+
+        x_re[0] = _mm_movelh_ps(lo_re, hi_re);
+        x_im[0] = _mm_movelh_ps(lo_im, hi_im);
+        x_re[1] = _mm_movehl_ps(hi_re, lo_re);
+        x_im[1] = _mm_movehl_ps(hi_im, lo_im);
+
+        for (i = 0; i < 2; i++)
+        {
+            const real_t *tab = dct4_64_tab + b + 4*i;
+            __m128 tmp = _mm_mul_ps(_mm_add_ps(x_re[i], x_im[i]), _mm_loadu_ps(tab + 3*32));
+
+            _mm_storeu_ps(out_real + b + 4*i, _mm_add_ps(_mm_mul_ps(x_im[i], _mm_loadu_ps(tab + 5*32)), tmp));
+            _mm_storeu_ps(out_imag + b + 4*i, _mm_add_ps(_mm_mul_ps(x_re[i], _mm_loadu_ps(tab + 4*32)), tmp));
+        }
+    }
+    /* i = 16, i_rev = 1, which sits at position 4 of the transposed block */
+    out_imag[16] = MUL_C(in_imag[4] - in_real[4], dct4_64_tab[16 + 3*32]);
+    out_real[16] = MUL_C(in_real[4] + in_imag[4], dct4_64_tab[16 + 3*32]);
+}
+#endif
+
+/* dct4_kernel over count rows, output in place */
+void dct4_kernel_batch(real_t (*re)[32], real_t (*im)[32], uint8_t count)
+{
+    ALIGN real_t out_real[32], out_imag[32];
+    uint8_t r;
+
+    for (r = 0; r < count; r++)
+    {
+        dct4_kernel(re[r], im[r], out_real, out_imag);
+        memcpy(re[r], out_real, sizeof(out_real));
+        memcpy(im[r], out_imag, sizeof(out_imag));
+    }
+}
+
+#ifdef USE_SSE
+/* x[i] = (x[i] - x[i2]) * w, x[i] = x[i] + x[i2] on four rows */
+#define BUTTERFLY_X4(Real, Imag, i, i2, w_re, w_im) { \
+    __m128 d_re = _mm_sub_ps(Real[i], Real[i2]); \
+    __m128 d_im = _mm_sub_ps(Imag[i], Imag[i2]); \
+    Real[i] = _mm_add_ps(Real[i], Real[i2]); \
+    Imag[i] = _mm_add_ps(Imag[i], Imag[i2]); \
+    Real[i2] = _mm_sub_ps(_mm_mul_ps(d_re, w_re), _mm_mul_ps(d_im, w_im)); \
+    Imag[i2] = _mm_add_ps(_mm_mul_ps(d_re, w_im), _mm_mul_ps(d_im, w_re)); \
+}
+
+/* fft_dif on four rows at once, one row per lane */
+static SSE_TARGET void fft_dif_x4(__m128 * Real, __m128 * Imag)
+{
+    __m128 w_re, w_im, w4, w12;
+    __m128 p1_re, p1_im, p2_re, p2_im;
+    uint32_t j, i, i2;
+
+    // Stage 1
+    for (i = 0; i < 16; i++)
+    {
+        w_re = _mm_set1_ps(w_array_real[i]);
+        w_im = _mm_set1_ps(w_array_imag[i]);
+        BUTTERFLY_X4(Real, Imag, i, i+16, w_re, w_im);
+    }
+    // Stage 2
+    for (j = 0; j < 8; j++)
+    {
+        w_re = _mm_set1_ps(w_array_real[2*j]);
+        w_im = _mm_set1_ps(w_array_imag[2*j]);
+        BUTTERFLY_X4(Real, Imag, j, j+8, w_re, w_im);
+        BUTTERFLY_X4(Real, Imag, j+16, j+24, w_re, w_im);
+    }
+
+    // Stage 3
+    w4 = _mm_set1_ps(w_array_real[4]); // = sqrt(2)/2
+    w12 = _mm_set1_ps(w_array_real[12]); // = -sqrt(2)/2
+    for (i = 0; i < 32; i += 8)
+    {
+        i2 = i+4;
+        p1_re = Real[i];
+        p1_im = Imag[i];
+        Real[i] = _mm_add_ps(p1_re, Real[i2]);
+        Imag[i] = _mm_add_ps(p1_im, Imag[i2]);
+        Real[i2] = _mm_sub_ps(p1_re, Real[i2]);
+        Imag[i2] = _mm_sub_ps(p1_im, Imag[i2]);
+
+        i++; i2++;
+        p1_re = _mm_sub_ps(Real[i], Real[i2]);
+        p1_im = _mm_sub_ps(Imag[i], Imag[i2]);
+        Real[i] = _mm_add_ps(Real[i], Real[i2]);
+        Imag[i] = _mm_add_ps(Imag[i], Imag[i2]);
+        Real[i2] = _mm_mul_ps(_mm_add_ps(p1_re, p1_im), w4);
+        Imag[i2] = _mm_mul_ps(_mm_sub_ps(p1_im, p1_re), w4);
+
+        i++; i2++;
+        p1_re = Real[i];
+        p1_im = Imag[i];
+        p2_re = Real[i2];
+        p2_im = Imag[i2];
+        Real[i] = _mm_add_ps(p1_re, p2_re);
+        Imag[i] = _mm_add_ps(p1_im, p2_im);
+        Real[i2] = _mm_sub_ps(p1_im, p2_im);
+        Imag[i2] = _mm_sub_ps(p2_re, p1_re);
+
+        i++; i2++;
+        p1_re = _mm_sub_ps(Real[i], Real[i2]);
+        p1_im = _mm_sub_ps(Imag[i], Imag[i2]);
+        Real[i] = _mm_add_ps(Real[i], Real[i2]);
+        Imag[i] = _mm_add_ps(Imag[i], Imag[i2]);
+        Real[i2] = _mm_mul_ps(_mm_sub_ps(p1_re, p1_im), w12);
+        Imag[i2] = _mm_mul_ps(_mm_add_ps(p1_re, p1_im), w12);
+
+        i -= 3;
+    }
+
+    // Stage 4
+    for (i = 0; i < 32; i += 4)
+    {
+        p1_re = Real[i];
+        p1_im = Imag[i];
+        p2_re = Real[i+2];
+        p2_im = Imag[i+2];
+        Real[i] = _mm_add_ps(p1_re, p2_re);
+        Imag[i] = _mm_add_ps(p1_im, p2_im);
+        Real[i+2] = _mm_sub_ps(p1_re, p2_re);
+        Imag[i+2] = _mm_sub_ps(p1_im, p2_im);
+
+        p1_re = Real[i+1];
+        p1_im = Imag[i+1];
+        p2_re = Real[i+3];
+        p2_im = Imag[i+3];
+        Real[i+1] = _mm_add_ps(p1_re, p2_re);
+        Imag[i+1] = _mm_add_ps(p1_im, p2_im);
+        Real[i+3] = _mm_sub_ps(p1_im, p2_im);
+        Imag[i+3] = _mm_sub_ps(p2_re, p1_re);
+    }
+
+    // Stage 5
+    for (i = 0; i < 32; i += 2)
+    {
+        p1_re = Real[i];
+        p1_im = Imag[i];
+        Real[i] = _mm_add_ps(p1_re, Real[i+1]);
+        Imag[i] = _mm_add_ps(p1_im, Imag[i+1]);
+        Real[i+1] = _mm_sub_ps(p1_re, Real[i+1]);
+        Imag[i+1] = _mm_sub_ps(p1_im, Imag[i+1]);
+    }
+}
+
+/* 4 rows of 32 to 32 vectors of 4 rows and back */
+static INLINE SSE_TARGET void load_rows_x4(real_t (*x)[32], __m128 *v)
+{
+    uint32_t i;
+
+    for (i = 0; i < 32; i += 4)
+    {
+        v[i]   = _mm_loadu_ps(x[0] + i);
+        v[i+1] = _mm_loadu_ps(x[1] + i);
+        v[i+2] = _mm_loadu_ps(x[2] + i);
+        v[i+3] = _mm_loadu_ps(x[3] + i);
+        _MM_TRANSPOSE4_PS(v[i], v[i+1], v[i+2], v[i+3]);
+    }
+}
+
+static INLINE SSE_TARGET void store_rows_x4(real_t (*x)[32], __m128 *v)
+{
+    uint32_t i;
+
+    for (i = 0; i < 32; i += 4)
+    {
+        _MM_TRANSPOSE4_PS(v[i], v[i+1], v[i+2], v[i+3]);
+        _mm_storeu_ps(x[0] + i, v[i]);
+        _mm_storeu_ps(x[1] + i, v[i+1]);
+        _mm_storeu_ps(x[2] + i, v[i+2]);
+        _mm_storeu_ps(x[3] + i, v[i+3]);
+    }
+}
+
+/* dct4_kernel_batch with four rows in the lanes of each vector, so the
+ * transform itself needs no shuffles. Same operations in the same order
+ * as dct4_kernel, remaining rows go through dct4_kernel_sse.
+ */
+SSE_TARGET void dct4_kernel_batch_sse(real_t (*re)[32], real_t (*im)[32], uint8_t count)
+{
+    const uint8_t bit_rev_tab[32] = { 0,16,8,24,4,20,12,28,2,18,10,26,6,22,14,30,1,17,9,25,5,21,13,29,3,19,11,27,7,23,15,31 };
+    ALIGN real_t out_real[32], out_imag[32];
+    __m128 x_re[32], x_im[32], y_re[32], y_im[32];
+    uint32_t i;
+    uint8_t r;
+
+    for (r = 0; r + 4 <= count; r += 4)
+    {
+        load_rows_x4(re + r, x_re);
+        load_rows_x4(im + r, x_im);
+
+        /* Step 2: modulate */
+        for (i = 0; i < 32; i++)
+        {
+            __m128 tmp = _mm_mul_ps(_mm_add_ps(x_re[i], x_im[i]), _mm_set1_ps(dct4_64_tab[i]));
+            __m128 t_re = x_re[i];
+
+            x_re[i] = _mm_add_ps(_mm_mul_ps(x_im[i], _mm_set1_ps(dct4_64_tab[i + 64])), tmp);
+            x_im[i] = _mm_add_ps(_mm_mul_ps(t_re, _mm_set1_ps(dct4_64_tab[i + 32])), tmp);
+        }
+
+        /* Step 3: FFT, but with output in bit reverse order */
+        fft_dif_x4(x_re, x_im);
+
+        /* Step 4: modulate + bitreverse reordering */
+        for (i = 0; i < 32; i++)
+        {
+            __m128 a_re = x_re[bit_rev_tab[i]];
+            __m128 a_im = x_im[bit_rev_tab[i]];
+            __m128 tmp = _mm_mul_ps(_mm_add_ps(a_re, a_im), _mm_set1_ps(dct4_64_tab[i + 3*32]));
+
+            if (i == 16)
+            {
+                y_im[i] = _mm_mul_ps(_mm_sub_ps(a_im, a_re), _mm_set1_ps(dct4_64_tab[i + 3*32]));
+                y_re[i] = tmp;
+            } else {
+                y_re[i] = _mm_add_ps(_mm_mul_ps(a_im, _mm_set1_ps(dct4_64_tab[i + 5*32])), tmp);
+                y_im[i] = _mm_add_ps(_mm_mul_ps(a_re, _mm_set1_ps(dct4_64_tab[i + 4*32])), tmp);
+            }
+        }
+
+        store_rows_x4(re + r, y_re);
+        store_rows_x4(im + r, y_im);
+    }
+
+    for (; r < count; r++)
+    {
+        dct4_kernel_sse(re[r], im[r], out_real, out_imag);
+        memcpy(re[r], out_real, sizeof(out_real));
+        memcpy(im[r], out_imag, sizeof(out_imag));
+    }
+}
+#endif
+
 #endif
 
 #endif
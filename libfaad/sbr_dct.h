@@ -36,6 +36,11 @@ extern "C" {
 #endif
 
 void dct4_kernel(real_t * in_real, real_t * in_imag, real_t * out_real, real_t * out_imag);
+void dct4_kernel_batch(real_t (*re)[32], real_t (*im)[32], uint8_t count);
+#ifdef USE_SSE
+void dct4_kernel_sse(real_t * in_real, real_t * in_imag, real_t * out_real, real_t * out_imag);
+void dct4_kernel_batch_sse(real_t (*re)[32], real_t (*im)[32], uint8_t count);
+#endif
 
 void DCT3_32_unscaled(real_t *y, real_t *x);
 void DCT4_32(real_t *y, real_t *x);
@@ -50,16 +50,22 @@ static void sbr_save_matrix(sbr_info *sbr, uint8_t ch);
 
 #define INVALID ((uint8_t)-1)
 
-sbr_info *sbrDecodeInit(uint16_t framelength, uint8_t id_aac,
-                        uint32_t sample_rate, uint8_t downSampledSBR
+sbr_info *sbrDecodeInit(allocator_info *alloc, uint16_t framelength, uint8_t id_aac,
+                        uint32_t sample_rate, uint8_t downSampledSBR,
+                        uint8_t lowPowerSBR, uint8_t fastMathSBR
 #ifdef DRM
 						, uint8_t IsDRM
 #endif
                         )
 {
-    sbr_info *sbr = faad_malloc(sizeof(sbr_info));
+    sbr_info *sbr = faad_malloc(alloc, sizeof(sbr_info));
+    if (sbr == NULL)
+        return NULL;
     memset(sbr, 0, sizeof(sbr_info));
 
+    /* all later allocations of this SBR element use the same source */
+    sbr->alloc = alloc;
+
     /* save id of the parent element */
     sbr->id_aac = id_aac;
     sbr->sample_rate = sample_rate;
@@ -84,6 +90,21 @@ sbr_info *sbrDecodeInit(uint16_t framelength, uint8_t id_aac,
 #endif
     sbr->tHFGen = T_HFGEN;
     sbr->tHFAdj = T_HFADJ;
+#ifdef SBR_LOW_POWER
+    (void)lowPowerSBR;
+    sbr->lp = 1;
+#else
+    sbr->lp = lowPowerSBR;
+#endif
+#if defined(FIXED_POINT) || defined(USE_DOUBLE_PRECISION)
+    (void)fastMathSBR;
+    sbr->fast_math = 0;
+#else
+    sbr->fast_math = fastMathSBR;
+#endif
+#ifdef USE_SSE
+    sbr->sse = cpu_has_sse();
+#endif
 
     sbr->bsco = 0;
     sbr->bsco_prev = 0;
@@ -105,7 +126,7 @@ sbr_info *sbrDecodeInit(uint16_t framelength, uint8_t id_aac,
     }
     else
     {
-        faad_free(sbr);
+        faad_free(alloc, sbr);
         return NULL;
     }
 
@@ -116,35 +137,57 @@ sbr_info *sbrDecodeInit(uint16_t framelength, uint8_t id_aac,
     {
         /* stereo */
         uint8_t j;
-        sbr->qmfa[0] = qmfa_init(32);
-        sbr->qmfa[1] = qmfa_init(32);
-        sbr->qmfs[0] = qmfs_init((downSampledSBR)?32:64);
-        sbr->qmfs[1] = qmfs_init((downSampledSBR)?32:64);
+        sbr->qmfa[0] = qmfa_init(alloc, 32);
+        sbr->qmfa[1] = qmfa_init(alloc, 32);
+        sbr->qmfs[0] = qmfs_init(alloc, (downSampledSBR)?32:64);
+        sbr->qmfs[1] = qmfs_init(alloc, (downSampledSBR)?32:64);
 
         for (j = 0; j < 5; j++)
         {
-            sbr->G_temp_prev[0][j] = faad_malloc(64*sizeof(real_t));
-            sbr->G_temp_prev[1][j] = faad_malloc(64*sizeof(real_t));
-            sbr->Q_temp_prev[0][j] = faad_malloc(64*sizeof(real_t));
-            sbr->Q_temp_prev[1][j] = faad_malloc(64*sizeof(real_t));
+            sbr->G_temp_prev[0][j] = faad_malloc(alloc, 64*sizeof(real_t));
+            sbr->G_temp_prev[1][j] = faad_malloc(alloc, 64*sizeof(real_t));
+            sbr->Q_temp_prev[0][j] = faad_malloc(alloc, 64*sizeof(real_t));
+            sbr->Q_temp_prev[1][j] = faad_malloc(alloc, 64*sizeof(real_t));
+            if ((sbr->G_temp_prev[0][j] == NULL) || (sbr->G_temp_prev[1][j] == NULL) ||
+                (sbr->Q_temp_prev[0][j] == NULL) || (sbr->Q_temp_prev[1][j] == NULL))
+            {
+                sbrDecodeEnd(sbr);
+                return NULL;
+            }
+        }
+        if ((sbr->qmfa[0] == NULL) || (sbr->qmfa[1] == NULL) ||
+            (sbr->qmfs[0] == NULL) || (sbr->qmfs[1] == NULL))
+        {
+            sbrDecodeEnd(sbr);
+            return NULL;
         }
 
-        memset(sbr->Xsbr[0], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)*64 * sizeof(qmf_t));
-        memset(sbr->Xsbr[1], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)*64 * sizeof(qmf_t));
+        memset(sbr->Xsbr[0], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)* sizeof(qmf_row_t));
+        memset(sbr->Xsbr[1], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)* sizeof(qmf_row_t));
     } else {
         /* mono */
         uint8_t j;
-        sbr->qmfa[0] = qmfa_init(32);
-        sbr->qmfs[0] = qmfs_init((downSampledSBR)?32:64);
+        sbr->qmfa[0] = qmfa_init(alloc, 32);
+        sbr->qmfs[0] = qmfs_init(alloc, (downSampledSBR)?32:64);
         sbr->qmfs[1] = NULL;
 
         for (j = 0; j < 5; j++)
         {
-            sbr->G_temp_prev[0][j] = faad_malloc(64*sizeof(real_t));
-            sbr->Q_temp_prev[0][j] = faad_malloc(64*sizeof(real_t));
+            sbr->G_temp_prev[0][j] = faad_malloc(alloc, 64*sizeof(real_t));
+            sbr->Q_temp_prev[0][j] = faad_malloc(alloc, 64*sizeof(real_t));
+            if ((sbr->G_temp_prev[0][j] == NULL) || (sbr->Q_temp_prev[0][j] == NULL))
+            {
+                sbrDecodeEnd(sbr);
+                return NULL;
+            }
+        }
+        if ((sbr->qmfa[0] == NULL) || (sbr->qmfs[0] == NULL))
+        {
+            sbrDecodeEnd(sbr);
+            return NULL;
         }
 
-        memset(sbr->Xsbr[0], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)*64 * sizeof(qmf_t));
+        memset(sbr->Xsbr[0], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)* sizeof(qmf_row_t));
     }
 
     return sbr;
@@ -156,36 +199,45 @@ void sbrDecodeEnd(sbr_info *sbr)
 
     if (sbr)
     {
-        qmfa_end(sbr->qmfa[0]);
-        qmfs_end(sbr->qmfs[0]);
-        if (sbr->qmfs[1] != NULL)
-        {
-            qmfa_end(sbr->qmfa[1]);
-            qmfs_end(sbr->qmfs[1]);
-        }
+        qmfa_end(sbr->alloc, sbr->qmfa[0]);
+        qmfs_end(sbr->alloc, sbr->qmfs[0]);
+        qmfa_end(sbr->alloc, sbr->qmfa[1]);
+        qmfs_end(sbr->alloc, sbr->qmfs[1]);
 
         for (j = 0; j < 5; j++)
         {
-            if (sbr->G_temp_prev[0][j]) faad_free(sbr->G_temp_prev[0][j]);
-            if (sbr->Q_temp_prev[0][j]) faad_free(sbr->Q_temp_prev[0][j]);
-            if (sbr->G_temp_prev[1][j]) faad_free(sbr->G_temp_prev[1][j]);
-            if (sbr->Q_temp_prev[1][j]) faad_free(sbr->Q_temp_prev[1][j]);
+            if (sbr->G_temp_prev[0][j]) faad_free(sbr->alloc, sbr->G_temp_prev[0][j]);
+            if (sbr->Q_temp_prev[0][j]) faad_free(sbr->alloc, sbr->Q_temp_prev[0][j]);
+            if (sbr->G_temp_prev[1][j]) faad_free(sbr->alloc, sbr->G_temp_prev[1][j]);
+            if (sbr->Q_temp_prev[1][j]) faad_free(sbr->alloc, sbr->Q_temp_prev[1][j]);
         }
 
 #ifdef PS_DEC
         if (sbr->ps != NULL)
-            ps_free(sbr->ps);
+            ps_free(sbr->alloc, sbr->ps);
 #endif
 
 #ifdef DRM_PS
         if (sbr->drm_ps != NULL)
-            drm_ps_free(sbr->drm_ps);
+            drm_ps_free(sbr->alloc, sbr->drm_ps);
 #endif
 
-        faad_free(sbr);
+        faad_free(sbr->alloc, sbr);
     }
 }
 
+#ifdef PS_DEC
+/* allocate the PS state ahead of the first PS data */
+void sbrAllocatePS(sbr_info *sbr, uint8_t downSampledSBR)
+{
+    if (sbr->ps == NULL)
+        sbr->ps = ps_init(sbr->alloc, get_sr_index(sbr->sample_rate), sbr->numTimeSlotsRate,
+            sbr->fast_math);
+    if (sbr->qmfs[1] == NULL)
+        sbr->qmfs[1] = qmfs_init(sbr->alloc, (downSampledSBR)?32:64);
+}
+#endif
+
 void sbrReset(sbr_info *sbr)
 {
     uint8_t j;
@@ -210,8 +262,8 @@ void sbrReset(sbr_info *sbr)
             memset(sbr->Q_temp_prev[1][j], 0, 64*sizeof(real_t));
     }
 
-    memset(sbr->Xsbr[0], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)*64 * sizeof(qmf_t));
-    memset(sbr->Xsbr[1], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)*64 * sizeof(qmf_t));
+    memset(sbr->Xsbr[0], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)* sizeof(qmf_row_t));
+    memset(sbr->Xsbr[1], 0, (sbr->numTimeSlotsRate+sbr->tHFGen)* sizeof(qmf_row_t));
 
     sbr->GQ_ringbuf_index[0] = 0;
     sbr->GQ_ringbuf_index[1] = 0;
@@ -294,15 +346,15 @@ static void sbr_save_matrix(sbr_info *sbr, uint8_t ch)
 
     for (i = 0; i < sbr->tHFGen; i++)
     {
-        memmove(sbr->Xsbr[ch][i], sbr->Xsbr[ch][i+sbr->numTimeSlotsRate], 64 * sizeof(qmf_t));
+        memmove(&sbr->Xsbr[ch][i], &sbr->Xsbr[ch][i+sbr->numTimeSlotsRate], sizeof(qmf_row_t));
     }
     for (i = sbr->tHFGen; i < MAX_NTSRHFG; i++)
     {
-        memset(sbr->Xsbr[ch][i], 0, 64 * sizeof(qmf_t));
+        memset(&sbr->Xsbr[ch][i], 0, sizeof(qmf_row_t));
     }
 }
 
-static uint8_t sbr_process_channel(sbr_info *sbr, real_t *channel_buf, qmf_t X[MAX_NTSR][64],
+static uint8_t sbr_process_channel(sbr_info *sbr, real_t *channel_buf, qmf_row_t X[MAX_NTSR],
                                    uint8_t ch, uint8_t dont_process,
                                    const uint8_t downSampledSBR)
 {
@@ -310,9 +362,7 @@ static uint8_t sbr_process_channel(sbr_info *sbr, real_t *channel_buf, qmf_t X[M
     uint8_t ret = 0;
     (void)downSampledSBR;  /* TODO: remove parameter? */
 
-#ifdef SBR_LOW_POWER
     ALIGN real_t deg[64];
-#endif
 
 #ifdef DRM
     if (sbr->Is_DRM_SBR)
@@ -349,11 +399,7 @@ static uint8_t sbr_process_channel(sbr_info *sbr, real_t *channel_buf, qmf_t X[M
 #if 1
         /* insert high frequencies here */
         /* hf generation using patching */
-        hf_generation(sbr, sbr->Xsbr[ch], sbr->Xsbr[ch]
-#ifdef SBR_LOW_POWER
-            ,deg
-#endif
-            ,ch);
+        hf_generation(sbr, sbr->Xsbr[ch], sbr->Xsbr[ch], deg, ch);
 #endif
 
 #if 0 //def SBR_LOW_POWER
@@ -361,18 +407,14 @@ static uint8_t sbr_process_channel(sbr_info *sbr, real_t *channel_buf, qmf_t X[M
         {
             for (k = 0; k < sbr->kx; k++)
             {
-                QMF_RE(sbr->Xsbr[ch][sbr->tHFAdj + l][k]) = 0;
+                QMF_RE_AT(sbr->Xsbr[ch][sbr->tHFAdj + l], k) = 0;
             }
         }
 #endif
 
 #if 1
         /* hf adjustment */
-        ret = hf_adjustment(sbr, sbr->Xsbr[ch]
-#ifdef SBR_LOW_POWER
-            ,deg
-#endif
-            ,ch);
+        ret = hf_adjustment(sbr, sbr->Xsbr[ch], deg, ch);
 #endif
         if (ret > 0)
         {
@@ -386,16 +428,16 @@ static uint8_t sbr_process_channel(sbr_info *sbr, real_t *channel_buf, qmf_t X[M
         {
             for (k = 0; k < 32; k++)
             {
-                QMF_RE(X[l][k]) = QMF_RE(sbr->Xsbr[ch][l + sbr->tHFAdj][k]);
+                QMF_RE_AT(X[l], k) = QMF_RE_AT(sbr->Xsbr[ch][l + sbr->tHFAdj], k);
 #ifndef SBR_LOW_POWER
-                QMF_IM(X[l][k]) = QMF_IM(sbr->Xsbr[ch][l + sbr->tHFAdj][k]);
+                QMF_IM_AT(X[l], k) = QMF_IM_AT(sbr->Xsbr[ch][l + sbr->tHFAdj], k);
 #endif
             }
             for (k = 32; k < 64; k++)
             {
-                QMF_RE(X[l][k]) = 0;
+                QMF_RE_AT(X[l], k) = 0;
 #ifndef SBR_LOW_POWER
-                QMF_IM(X[l][k]) = 0;
+                QMF_IM_AT(X[l], k) = 0;
 #endif
             }
         }
@@ -416,43 +458,47 @@ static uint8_t sbr_process_channel(sbr_info *sbr, real_t *channel_buf, qmf_t X[M
             }
 
 #ifndef SBR_LOW_POWER
-            for (k = 0; k < kx_band + bsco_band; k++)
+            if (!sbr->lp)
             {
-                QMF_RE(X[l][k]) = QMF_RE(sbr->Xsbr[ch][l + sbr->tHFAdj][k]);
-                QMF_IM(X[l][k]) = QMF_IM(sbr->Xsbr[ch][l + sbr->tHFAdj][k]);
+                for (k = 0; k < kx_band + bsco_band; k++)
+                {
+                    QMF_RE_AT(X[l], k) = QMF_RE_AT(sbr->Xsbr[ch][l + sbr->tHFAdj], k);
+                    QMF_IM_AT(X[l], k) = QMF_IM_AT(sbr->Xsbr[ch][l + sbr->tHFAdj], k);
+                }
+                for (k = kx_band + bsco_band; k < kx_band + M_band; k++)
+                {
+                    QMF_RE_AT(X[l], k) = QMF_RE_AT(sbr->Xsbr[ch][l + sbr->tHFAdj], k);
+                    QMF_IM_AT(X[l], k) = QMF_IM_AT(sbr->Xsbr[ch][l + sbr->tHFAdj], k);
+                }
+                for (k = max(kx_band + bsco_band, kx_band + M_band); k < 64; k++)
+                {
+                    QMF_RE_AT(X[l], k) = 0;
+                    QMF_IM_AT(X[l], k) = 0;
+                }
+                continue;
             }
-            for (k = kx_band + bsco_band; k < kx_band + M_band; k++)
-            {
-                QMF_RE(X[l][k]) = QMF_RE(sbr->Xsbr[ch][l + sbr->tHFAdj][k]);
-                QMF_IM(X[l][k]) = QMF_IM(sbr->Xsbr[ch][l + sbr->tHFAdj][k]);
-            }
-            for (k = max(kx_band + bsco_band, kx_band + M_band); k < 64; k++)
-            {
-                QMF_RE(X[l][k]) = 0;
-                QMF_IM(X[l][k]) = 0;
-            }
-#else
+#endif
+
             for (k = 0; k < kx_band + bsco_band; k++)
             {
-                QMF_RE(X[l][k]) = QMF_RE(sbr->Xsbr[ch][l + sbr->tHFAdj][k]);
+                QMF_RE_AT(X[l], k) = QMF_RE_AT(sbr->Xsbr[ch][l + sbr->tHFAdj], k);
             }
             for (k = kx_band + bsco_band; k < min(kx_band + M_band, 63); k++)
             {
-                QMF_RE(X[l][k]) = QMF_RE(sbr->Xsbr[ch][l + sbr->tHFAdj][k]);
+                QMF_RE_AT(X[l], k) = QMF_RE_AT(sbr->Xsbr[ch][l + sbr->tHFAdj], k);
             }
             for (k = max(kx_band + bsco_band, kx_band + M_band); k < 64; k++)
             {
-                QMF_RE(X[l][k]) = 0;
+                QMF_RE_AT(X[l], k) = 0;
             }
             /* kx_band can be 0 (kx_prev on the first frame's leading slots),
                which would make kx_band - 1 + bsco_band index X[l][-1]. There is
                no band below 0 to add in that case, so skip the overlap. */
             if (kx_band + bsco_band > 0)
             {
-                QMF_RE(X[l][kx_band - 1 + bsco_band]) +=
-                    QMF_RE(sbr->Xsbr[ch][l + sbr->tHFAdj][kx_band - 1 + bsco_band]);
+                QMF_RE_AT(X[l], kx_band - 1 + bsco_band) +=
+                    QMF_RE_AT(sbr->Xsbr[ch][l + sbr->tHFAdj], kx_band - 1 + bsco_band);
             }
-#endif
         }
     }
 
@@ -464,7 +510,7 @@ uint8_t sbrDecodeCoupleFrame(sbr_info *sbr, real_t *left_chan, real_t *right_cha
 {
     uint8_t dont_process = 0;
     uint8_t ret = 0;
-    ALIGN qmf_t X[MAX_NTSRHFG][64];
+    ALIGN qmf_row_t X[MAX_NTSRHFG];
 
     if (sbr == NULL)
         return 20;
@@ -547,7 +593,7 @@ uint8_t sbrDecodeSingleFrame(sbr_info *sbr, real_t *channel,
 {
     uint8_t dont_process = 0;
     uint8_t ret = 0;
-    ALIGN qmf_t X[MAX_NTSRHFG][64];
+    ALIGN qmf_row_t X[MAX_NTSRHFG];
 
     if (sbr == NULL)
         return 20;
@@ -609,6 +655,33 @@ uint8_t sbrDecodeSingleFrame(sbr_info *sbr, real_t *channel,
     return 0;
 }
 
+/* frame of an element of which the output is not needed: no synthesis,
+ * but the envelope and noise floor data of the next frame are delta coded
+ * against this one, so the previous frame data is still saved
+ */
+uint8_t sbrSkipFrame(sbr_info *sbr)
+{
+    uint8_t ret = 0;
+
+    if (sbr == NULL)
+        return 20;
+
+    if (sbr->header_count != 0 && sbr->ret == 0)
+    {
+        ret = sbr_save_prev_data(sbr, 0);
+        if (ret) return ret;
+        if (sbr->id_aac == ID_CPE)
+        {
+            ret = sbr_save_prev_data(sbr, 1);
+            if (ret) return ret;
+        }
+    }
+
+    sbr->frame++;
+
+    return 0;
+}
+
 #if (defined(PS_DEC) || defined(DRM_PS))
 uint8_t sbrDecodeSingleFramePS(sbr_info *sbr, real_t *left_channel, real_t *right_channel,
                                const uint8_t just_seeked, const uint8_t downSampledSBR)
@@ -616,8 +689,8 @@ uint8_t sbrDecodeSingleFramePS(sbr_info *sbr, real_t *left_channel, real_t *righ
     uint8_t l, k;
     uint8_t dont_process = 0;
     uint8_t ret = 0;
-    ALIGN qmf_t X_left[MAX_NTSRHFG][64] = {{{0}}};
-    ALIGN qmf_t X_right[MAX_NTSRHFG][64] = {{{0}}}; /* must set this to 0 */
+    ALIGN qmf_row_t X_left[MAX_NTSRHFG] = {{{0}}};
+    ALIGN qmf_row_t X_right[MAX_NTSRHFG] = {{{0}}}; /* must set this to 0 */
 
     if (sbr == NULL)
         return 20;
@@ -645,43 +718,59 @@ uint8_t sbrDecodeSingleFramePS(sbr_info *sbr, real_t *left_channel, real_t *righ
 
     if (sbr->qmfs[1] == NULL)
     {
-        sbr->qmfs[1] = qmfs_init((downSampledSBR)?32:64);
+        sbr->qmfs[1] = qmfs_init(sbr->alloc, (downSampledSBR)?32:64);
+        if (sbr->qmfs[1] == NULL)
+            return 39;
     }
 
     sbr->ret += sbr_process_channel(sbr, left_channel, X_left, 0, dont_process, downSampledSBR);
 
-    /* copy some extra data for PS */
-    for (l = sbr->numTimeSlotsRate; l < sbr->numTimeSlotsRate + 6; l++)
+    if (sbr->lp)
     {
-        for (k = 0; k < 5; k++)
+        /* parametric stereo needs the complex subband samples, in low power
+           mode the mono SBR output is used for both channels */
+        if (downSampledSBR)
         {
-            QMF_RE(X_left[l][k]) = QMF_RE(sbr->Xsbr[0][sbr->tHFAdj+l][k]);
-            QMF_IM(X_left[l][k]) = QMF_IM(sbr->Xsbr[0][sbr->tHFAdj+l][k]);
+            sbr_qmf_synthesis_32(sbr, sbr->qmfs[0], X_left, left_channel);
+            memcpy(right_channel, left_channel, 32*sbr->numTimeSlotsRate*sizeof(real_t));
+        } else {
+            sbr_qmf_synthesis_64(sbr, sbr->qmfs[0], X_left, left_channel);
+            memcpy(right_channel, left_channel, 64*sbr->numTimeSlotsRate*sizeof(real_t));
+        }
+    } else {
+        /* copy some extra data for PS */
+        for (l = sbr->numTimeSlotsRate; l < sbr->numTimeSlotsRate + 6; l++)
+        {
+            for (k = 0; k < 5; k++)
+            {
+                QMF_RE_AT(X_left[l], k) = QMF_RE_AT(sbr->Xsbr[0][sbr->tHFAdj+l], k);
+                QMF_IM_AT(X_left[l], k) = QMF_IM_AT(sbr->Xsbr[0][sbr->tHFAdj+l], k);
+            }
         }
-    }
 
-    /* perform parametric stereo */
+        /* perform parametric stereo */
 #ifdef DRM_PS
-    if (sbr->Is_DRM_SBR)
-    {
-        drm_ps_decode(sbr->drm_ps, (sbr->ret > 0), X_left, X_right);
-    } else {
+        if (sbr->Is_DRM_SBR)
+        {
+            drm_ps_decode(sbr->drm_ps, (sbr->ret > 0), X_left, X_right);
+        } else {
 #endif
 #ifdef PS_DEC
-        ps_decode(sbr->ps, X_left, X_right);
+            ps_decode(sbr->ps, X_left, X_right);
 #endif
 #ifdef DRM_PS
-    }
+        }
 #endif
 
-    /* subband synthesis */
-    if (downSampledSBR)
-    {
-        sbr_qmf_synthesis_32(sbr, sbr->qmfs[0], X_left, left_channel);
-        sbr_qmf_synthesis_32(sbr, sbr->qmfs[1], X_right, right_channel);
-    } else {
-        sbr_qmf_synthesis_64(sbr, sbr->qmfs[0], X_left, left_channel);
-        sbr_qmf_synthesis_64(sbr, sbr->qmfs[1], X_right, right_channel);
+        /* subband synthesis */
+        if (downSampledSBR)
+        {
+            sbr_qmf_synthesis_32(sbr, sbr->qmfs[0], X_left, left_channel);
+            sbr_qmf_synthesis_32(sbr, sbr->qmfs[1], X_right, right_channel);
+        } else {
+            sbr_qmf_synthesis_64(sbr, sbr->qmfs[0], X_left, left_channel);
+            sbr_qmf_synthesis_64(sbr, sbr->qmfs[1], X_right, right_channel);
+        }
     }
 
     if (sbr->bs_header_flag)
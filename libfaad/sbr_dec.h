@@ -55,12 +55,18 @@ typedef struct {
     real_t *x;
     int16_t x_index;
     uint8_t channels;
+#ifdef USE_SSE
+    uint8_t sse;
+#endif
 } qmfa_info;
 
 typedef struct {
     real_t *v;
     int16_t v_index;
     uint8_t channels;
+#ifdef USE_SSE
+    uint8_t sse;
+#endif
 } qmfs_info;
 
 typedef struct
@@ -88,10 +94,8 @@ typedef struct
     uint8_t f_table_res[2][64];
     uint8_t f_table_noise[64];
     uint8_t f_table_lim[4][64];
-#ifdef SBR_LOW_POWER
     uint8_t f_group[5][64];
     uint8_t N_G[5];
-#endif
 
     uint8_t table_map_k_to_g[64];
 
@@ -163,10 +167,12 @@ typedef struct
     uint32_t frame;
     uint32_t header_count;
 
+    allocator_info *alloc;
+
     qmfa_info *qmfa[2];
     qmfs_info *qmfs[2];
 
-    qmf_t Xsbr[2][MAX_NTSRHFG][64];
+    qmf_row_t Xsbr[2][MAX_NTSRHFG];
 
 #if defined(DRM) && defined(DRM_PS)
     drm_ps_info *drm_ps;
@@ -180,6 +186,14 @@ typedef struct
     uint8_t numTimeSlots;
     uint8_t tHFGen;
     uint8_t tHFAdj;
+    /* low power (real valued) SBR, always set in SBR_LOW_POWER builds */
+    uint8_t lp;
+    /* approximate square roots and reciprocals in the gain and PS phase
+     * code, never set in fixed point and double precision builds */
+    uint8_t fast_math;
+#ifdef USE_SSE
+    uint8_t sse;
+#endif
 
 #if (defined(PS_DEC) || defined(DRM_PS))
     uint8_t ps_used;
@@ -232,19 +246,24 @@ typedef struct
 #endif
 } sbr_info;
 
-sbr_info *sbrDecodeInit(uint16_t framelength, uint8_t id_aac,
-                        uint32_t sample_rate, uint8_t downSampledSBR
+sbr_info *sbrDecodeInit(allocator_info *alloc, uint16_t framelength, uint8_t id_aac,
+                        uint32_t sample_rate, uint8_t downSampledSBR,
+                        uint8_t lowPowerSBR, uint8_t fastMathSBR
 #ifdef DRM
                         , uint8_t IsDRM
 #endif
                         );
 void sbrDecodeEnd(sbr_info *sbr);
 void sbrReset(sbr_info *sbr);
+#ifdef PS_DEC
+void sbrAllocatePS(sbr_info *sbr, uint8_t downSampledSBR);
+#endif
 
 uint8_t sbrDecodeCoupleFrame(sbr_info *sbr, real_t *left_chan, real_t *right_chan,
                              const uint8_t just_seeked, const uint8_t downSampledSBR);
 uint8_t sbrDecodeSingleFrame(sbr_info *sbr, real_t *channel,
                              const uint8_t just_seeked, const uint8_t downSampledSBR);
+uint8_t sbrSkipFrame(sbr_info *sbr);
 #if (defined(PS_DEC) || defined(DRM_PS))
 uint8_t sbrDecodeSingleFramePS(sbr_info *sbr, real_t *left_channel, real_t *right_channel,
                                const uint8_t just_seeked, const uint8_t downSampledSBR);
@@ -41,23 +41,23 @@
 
 #include "sbr_noise.h"
 
+#ifdef USE_SSE
+#include <xmmintrin.h>
+#endif
+
 
 /* static function declarations */
 static uint8_t estimate_current_envelope(sbr_info *sbr, sbr_hfadj_info *adj,
-                                         qmf_t Xsbr[MAX_NTSRHFG][64], uint8_t ch);
+                                         qmf_row_t Xsbr[MAX_NTSRHFG], uint8_t ch);
 static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch);
-#ifdef SBR_LOW_POWER
 static void calc_gain_groups(sbr_info *sbr, sbr_hfadj_info *adj, real_t *deg, uint8_t ch);
 static void aliasing_reduction(sbr_info *sbr, sbr_hfadj_info *adj, real_t *deg, uint8_t ch);
-#endif
-static void hf_assembly(sbr_info *sbr, sbr_hfadj_info *adj, qmf_t Xsbr[MAX_NTSRHFG][64], uint8_t ch);
+static void hf_assembly(sbr_info *sbr, sbr_hfadj_info *adj, qmf_row_t Xsbr[MAX_NTSRHFG], uint8_t ch);
 
 
-uint8_t hf_adjustment(sbr_info *sbr, qmf_t Xsbr[MAX_NTSRHFG][64]
-#ifdef SBR_LOW_POWER
-                      ,real_t *deg /* aliasing degree */
-#endif
-                      ,uint8_t ch)
+uint8_t hf_adjustment(sbr_info *sbr, qmf_row_t Xsbr[MAX_NTSRHFG],
+                      real_t *deg /* aliasing degree, low power only */,
+                      uint8_t ch)
 {
     ALIGN sbr_hfadj_info adj = {{{0}}};
     uint8_t ret = 0;
@@ -83,10 +83,11 @@ uint8_t hf_adjustment(sbr_info *sbr, qmf_t Xsbr[MAX_NTSRHFG][64]
 
     calculate_gain(sbr, &adj, ch);
 
-#ifdef SBR_LOW_POWER
-    calc_gain_groups(sbr, &adj, deg, ch);
-    aliasing_reduction(sbr, &adj, deg, ch);
-#endif
+    if (sbr->lp)
+    {
+        calc_gain_groups(sbr, &adj, deg, ch);
+        aliasing_reduction(sbr, &adj, deg, ch);
+    }
 
     hf_assembly(sbr, &adj, Xsbr, ch);
 
@@ -134,8 +135,45 @@ static uint8_t get_S_mapped(sbr_info *sbr, uint8_t ch, uint8_t l, uint8_t curren
     return 0;
 }
 
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+/* energy of subbands kx+m..kx+m+3 for every 4 subbands below M & ~3,
+ * summed over the time slots of envelope l
+ */
+static SSE_TARGET uint8_t estimate_envelope_sse(sbr_info *sbr, qmf_row_t Xsbr[MAX_NTSRHFG],
+                                                uint8_t ch, uint8_t l, real_t div)
+{
+    uint8_t m, i, j;
+    uint8_t l_i = sbr->t_E[ch][l] + sbr->tHFAdj;
+    uint8_t u_i = sbr->t_E[ch][l+1] + sbr->tHFAdj;
+    real_t nrg[4];
+
+    for (m = 0; m + 4 <= sbr->M; m += 4)
+    {
+        __m128 acc = _mm_setzero_ps();
+
+        for (i = l_i; i < u_i; i++)
+        {
+            __m128 re, im;
+
+            load_qmf4(&Xsbr[i], m + sbr->kx, &re, &im);
+            acc = _mm_add_ps(acc, _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im)));
+        }
+        _mm_storeu_ps(nrg, acc);
+
+        for (j = 0; j < 4; j++)
+        {
+            if (nrg[j] < -FLT_MAX || nrg[j] > FLT_MAX)
+                return 1;
+            sbr->E_curr[ch][m + j][l] = nrg[j] / div;
+        }
+    }
+
+    return 0;
+}
+#endif
+
 static uint8_t estimate_current_envelope(sbr_info *sbr, sbr_hfadj_info *adj,
-                                         qmf_t Xsbr[MAX_NTSRHFG][64], uint8_t ch)
+                                         qmf_row_t Xsbr[MAX_NTSRHFG], uint8_t ch)
 {
     uint8_t m, l, j, k, k_l, k_h, p;
     real_t nrg, div;
@@ -167,24 +205,34 @@ static uint8_t estimate_current_envelope(sbr_info *sbr, sbr_hfadj_info *adj,
             mul = (1 << (COEF_BITS - REAL_BITS)) / div;
 #endif
 
-            for (m = 0; m < sbr->M; m++)
+            m = 0;
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+            if (sbr->sse && !sbr->lp)
+            {
+                if (estimate_envelope_sse(sbr, Xsbr, ch, l, div))
+                    return 1;
+                m = sbr->M & ~3;
+            }
+#endif
+            for (; m < sbr->M; m++)
             {
                 nrg = 0;
 
                 for (i = l_i + sbr->tHFAdj; i < u_i + sbr->tHFAdj; i++)
                 {
-                    real_t re = QMF_RE(Xsbr[i][m + sbr->kx]) + half;
-                    real_t im = QMF_IM(Xsbr[i][m + sbr->kx]) + half;
-                    (void)im;
+                    real_t re = QMF_RE_AT(Xsbr[i], m + sbr->kx) + half;
+                    real_t im = QMF_IM_AT(Xsbr[i], m + sbr->kx) + half;
                     /* Actually, that should be MUL_R. On floating-point build
                        that is the same. On fixed point-build we use it to
                        pre-scale result (to aviod overflow). That, of course
                        causes some precision loss. */
-                    nrg += MUL_C(re, re)
+                    real_t e = MUL_C(re, re);
+                    (void)im;
 #ifndef SBR_LOW_POWER
-                        + MUL_C(im, im)
+                    if (!sbr->lp)
+                        e += MUL_C(im, im);
 #endif
-                        ;
+                    nrg += e;
                 }
 
                 if (nrg < -limit || nrg > limit)
@@ -194,13 +242,14 @@ static uint8_t estimate_current_envelope(sbr_info *sbr, sbr_hfadj_info *adj,
 #else
                 sbr->E_curr[ch][m][l] = nrg / div;
 #endif
-#ifdef SBR_LOW_POWER
+                if (sbr->lp)
+                {
 #ifdef FIXED_POINT
-                sbr->E_curr[ch][m][l] <<= 1;
+                    sbr->E_curr[ch][m][l] <<= 1;
 #else
-                sbr->E_curr[ch][m][l] *= 2;
-#endif
+                    sbr->E_curr[ch][m][l] *= 2;
 #endif
+                }
             }
         }
     } else {
@@ -208,59 +257,65 @@ static uint8_t estimate_current_envelope(sbr_info *sbr, sbr_hfadj_info *adj,
         {
             for (p = 0; p < sbr->n[sbr->f[ch][l]]; p++)
             {
+                uint8_t i, l_i, u_i;
+
                 k_l = sbr->f_table_res[sbr->f[ch][l]][p];
                 k_h = sbr->f_table_res[sbr->f[ch][l]][p+1];
 
-                for (k = k_l; k < k_h; k++)
-                {
-                    uint8_t i, l_i, u_i;
-                    nrg = 0;
-
-                    l_i = sbr->t_E[ch][l];
-                    u_i = sbr->t_E[ch][l+1];
+                l_i = sbr->t_E[ch][l];
+                u_i = sbr->t_E[ch][l+1];
 
-                    div = (real_t)((u_i - l_i)*(k_h - k_l));
+                div = (real_t)((u_i - l_i)*(k_h - k_l));
 
-                    if (div <= 0)
-                        div = 1;
+                if (div <= 0)
+                    div = 1;
 #ifdef FIXED_POINT
-                    limit = div << (30 - (COEF_BITS - REAL_BITS));
-                    mul = (1 << (COEF_BITS - REAL_BITS)) / div;
+                limit = div << (30 - (COEF_BITS - REAL_BITS));
+                mul = (1 << (COEF_BITS - REAL_BITS)) / div;
 #endif
 
-                    for (i = l_i + sbr->tHFAdj; i < u_i + sbr->tHFAdj; i++)
+                /* the energy is averaged over the whole band, so it is
+                 * the same for every subband k in it
+                 */
+                nrg = 0;
+                for (i = l_i + sbr->tHFAdj; i < u_i + sbr->tHFAdj; i++)
+                {
+                    for (j = k_l; j < k_h; j++)
                     {
-                        for (j = k_l; j < k_h; j++)
-                        {
-                            real_t re = QMF_RE(Xsbr[i][j]) + half;
-                            real_t im = QMF_IM(Xsbr[i][j]) + half;
-                            (void)im;
-                            /* Actually, that should be MUL_R. On floating-point build
-                               that is the same. On fixed point-build we use it to
-                               pre-scale result (to aviod overflow). That, of course
-                               causes some precision loss. */
-                            nrg += MUL_C(re, re)
+                        real_t re = QMF_RE_AT(Xsbr[i], j) + half;
+                        real_t im = QMF_IM_AT(Xsbr[i], j) + half;
+                        /* Actually, that should be MUL_R. On floating-point build
+                           that is the same. On fixed point-build we use it to
+                           pre-scale result (to aviod overflow). That, of course
+                           causes some precision loss. */
+                        real_t e = MUL_C(re, re);
+                        (void)im;
 #ifndef SBR_LOW_POWER
-                                + MUL_C(im, im)
+                        if (!sbr->lp)
+                            e += MUL_C(im, im);
 #endif
-                                ;
-                        }
+                        nrg += e;
                     }
+                }
 
-                    if (nrg < -limit || nrg > limit)
-                        return 1;
+                if (nrg < -limit || nrg > limit)
+                    return 1;
+
+                for (k = k_l; k < k_h; k++)
+                {
 #ifdef FIXED_POINT
                     sbr->E_curr[ch][k - sbr->kx][l] = nrg * mul;
 #else
                     sbr->E_curr[ch][k - sbr->kx][l] = nrg / div;
 #endif
-#ifdef SBR_LOW_POWER
+                    if (sbr->lp)
+                    {
 #ifdef FIXED_POINT
-                    sbr->E_curr[ch][k - sbr->kx][l] <<= 1;
+                        sbr->E_curr[ch][k - sbr->kx][l] <<= 1;
 #else
-                    sbr->E_curr[ch][k - sbr->kx][l] *= 2;
-#endif
+                        sbr->E_curr[ch][k - sbr->kx][l] *= 2;
 #endif
+                    }
                 }
             }
         }
@@ -275,6 +330,31 @@ static uint8_t estimate_current_envelope(sbr_info *sbr, sbr_hfadj_info *adj,
 #define EPS (1e-12)
 #endif
 
+#ifndef FIXED_POINT
+/* gain square roots, approximated in fast math mode */
+static INLINE real_t sbr_sqrt_f(const sbr_info *sbr, real_t x)
+{
+#ifndef USE_DOUBLE_PRECISION
+    if (sbr->fast_math)
+        return faad_sqrt_fast(x);
+#endif
+    return (real_t)sqrt(x);
+}
+#endif
+
+#ifdef FIXED_POINT
+/* square root of a REAL_BITS fixed point value */
+static real_t sqrt_real_fix(real_t val)
+{
+    if (val <= 0)
+        return 0;
+
+    /* log2_int() treats val as an integer */
+    return pow2_fix((log2_int(val) - (REAL_BITS << REAL_BITS)) >> 1);
+}
+#define SBR_SQRT_R(A) sqrt_real_fix(A)
+#endif
+
 
 
 #ifdef FIXED_POINT
@@ -711,14 +791,13 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
             for (m = ml1; m < ml2; m++)
             {
                 /* apply compensation to gain, noise floor sf's and sinusoid levels */
-#ifndef SBR_LOW_POWER
-                adj->G_lim_boost[l][m] = pow2_fix((G_lim[m] + G_boost) >> 1);
-#else
-                /* sqrt() will be done after the aliasing reduction to save a
-                 * few multiplies
+                /* in low power mode the sqrt() will be done after the aliasing
+                 * reduction to save a few multiplies
                  */
-                adj->G_lim_boost[l][m] = pow2_fix(G_lim[m] + G_boost);
-#endif
+                if (sbr->lp)
+                    adj->G_lim_boost[l][m] = pow2_fix(G_lim[m] + G_boost);
+                else
+                    adj->G_lim_boost[l][m] = pow2_fix((G_lim[m] + G_boost) >> 1);
                 adj->Q_M_lim_boost[l][m] = pow2_fix((Q_M_lim[m] + G_boost) >> 1);
 
                 adj->S_M_boost[l][m] = pow2_fix((S_M[m] + G_boost) >> 1);
@@ -1171,14 +1250,13 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
             for (m = ml1; m < ml2; m++)
             {
                 /* apply compensation to gain, noise floor sf's and sinusoid levels */
-#ifndef SBR_LOW_POWER
-                adj->G_lim_boost[l][m] = QUANTISE2REAL(pow2((G_lim[m] + G_boost) / 2.0));
-#else
-                /* sqrt() will be done after the aliasing reduction to save a
-                 * few multiplies
+                /* in low power mode the sqrt() will be done after the aliasing
+                 * reduction to save a few multiplies
                  */
-                adj->G_lim_boost[l][m] = QUANTISE2REAL(pow2(G_lim[m] + G_boost));
-#endif
+                if (sbr->lp)
+                    adj->G_lim_boost[l][m] = QUANTISE2REAL(pow2(G_lim[m] + G_boost));
+                else
+                    adj->G_lim_boost[l][m] = QUANTISE2REAL(pow2((G_lim[m] + G_boost) / 2.0));
                 adj->Q_M_lim_boost[l][m] = QUANTISE2REAL(pow2((Q_M_lim[m] + 10 + G_boost) / 2.0));
 
                 if (S_M[m] != LOG2_MIN_INF)
@@ -1194,6 +1272,97 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
 
 #else
 
+/* G > G_max: limit the gain and scale the noise floor accordingly */
+static void limit_gain(real_t *G_lim, real_t *Q_M_lim, real_t G_max, uint8_t ml1, uint8_t ml2)
+{
+    uint8_t m;
+
+    for (m = ml1; m < ml2; m++)
+    {
+        if (G_lim[m] <= G_max)
+            continue;
+
+        Q_M_lim[m] = Q_M_lim[m] * G_max / G_lim[m];
+        G_lim[m] = G_max;
+    }
+}
+
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+/* reciprocal and square root estimates refined with one Newton-Raphson step,
+ * used in fast math mode */
+static INLINE SSE_TARGET __m128 rcp_fast_ps(__m128 x)
+{
+    __m128 y = _mm_rcp_ps(x);
+    return _mm_sub_ps(_mm_add_ps(y, y), _mm_mul_ps(x, _mm_mul_ps(y, y)));
+}
+
+static INLINE SSE_TARGET __m128 sqrt_fast_ps(__m128 x)
+{
+    __m128 y = _mm_rsqrt_ps(x);
+    y = _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f),
+        _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x), _mm_mul_ps(y, y))));
+    /* rsqrt(0) is inf */
+    return _mm_and_ps(_mm_cmpneq_ps(x, _mm_setzero_ps()), _mm_mul_ps(x, y));
+}
+
+static INLINE SSE_TARGET __m128 div_ps(__m128 a, __m128 b, uint8_t fast_math)
+{
+    if (fast_math)
+        return _mm_mul_ps(a, rcp_fast_ps(b));
+    return _mm_div_ps(a, b);
+}
+
+static INLINE SSE_TARGET __m128 sqrt_ps(__m128 x, uint8_t fast_math)
+{
+    if (fast_math)
+        return sqrt_fast_ps(x);
+    return _mm_sqrt_ps(x);
+}
+
+static SSE_TARGET void limit_gain_sse(real_t *G_lim, real_t *Q_M_lim, real_t G_max,
+                                      uint8_t ml1, uint8_t ml2, uint8_t fast_math)
+{
+    const __m128 max = _mm_set1_ps(G_max);
+    uint8_t m;
+
+    for (m = ml1; m + 4 <= ml2; m += 4)
+    {
+        __m128 G = _mm_loadu_ps(&G_lim[m]);
+        __m128 Q = _mm_loadu_ps(&Q_M_lim[m]);
+        __m128 keep = _mm_cmple_ps(G, max);
+        __m128 Q_lim = div_ps(_mm_mul_ps(Q, max), G, fast_math);
+
+        _mm_storeu_ps(&Q_M_lim[m], _mm_or_ps(_mm_and_ps(keep, Q), _mm_andnot_ps(keep, Q_lim)));
+        _mm_storeu_ps(&G_lim[m], _mm_or_ps(_mm_and_ps(keep, G), _mm_andnot_ps(keep, max)));
+    }
+
+    limit_gain(G_lim, Q_M_lim, G_max, m, ml2);
+}
+
+/* returns the first subband left for the scalar loop */
+static SSE_TARGET uint8_t apply_gain_boost_sse(sbr_hfadj_info *adj, uint8_t l,
+                                               const real_t *G_lim, const real_t *Q_M_lim,
+                                               const real_t *S_M, real_t G_boost,
+                                               uint8_t ml1, uint8_t ml2, uint8_t fast_math)
+{
+    const __m128 boost = _mm_set1_ps(G_boost);
+    const __m128 zero = _mm_setzero_ps();
+    uint8_t m;
+
+    for (m = ml1; m + 4 <= ml2; m += 4)
+    {
+        __m128 S = _mm_loadu_ps(&S_M[m]);
+
+        _mm_storeu_ps(&adj->G_lim_boost[l][m], sqrt_ps(_mm_mul_ps(_mm_loadu_ps(&G_lim[m]), boost), fast_math));
+        _mm_storeu_ps(&adj->Q_M_lim_boost[l][m], sqrt_ps(_mm_mul_ps(_mm_loadu_ps(&Q_M_lim[m]), boost), fast_math));
+        _mm_storeu_ps(&adj->S_M_boost[l][m], _mm_and_ps(_mm_cmpneq_ps(S, zero),
+            sqrt_ps(_mm_mul_ps(S, boost), fast_math)));
+    }
+
+    return m;
+}
+#endif
+
 static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
 {
     static real_t limGain[] = { 0.5, 1.0, 2.0, 1e10 };
@@ -1206,6 +1375,7 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
     ALIGN real_t G_lim[MAX_M];
     ALIGN real_t G_boost;
     ALIGN real_t S_M[MAX_M];
+    uint8_t S_index_mapped[MAX_M];
 
     for (l = 0; l < sbr->L_E[ch]; l++)
     {
@@ -1266,7 +1436,6 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
             {
                 real_t Q_M, G;
                 real_t Q_div, Q_div2;
-                uint8_t S_index_mapped;
 
 
                 /* check if m is on a noise band border */
@@ -1302,13 +1471,13 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
                  * S_index_mapped can only be 1 for the m in the middle of the
                  * current HI_RES band
                  */
-                S_index_mapped = 0;
+                S_index_mapped[m] = 0;
                 if ((l >= sbr->l_A[ch]) ||
                     (sbr->bs_add_harmonic_prev[ch][current_hi_res_band] && sbr->bs_add_harmonic_flag_prev[ch]))
                 {
                     /* find the middle subband of the HI_RES frequency band */
                     if ((m + sbr->kx) == (sbr->f_table_res[HI_RES][current_hi_res_band+1] + sbr->f_table_res[HI_RES][current_hi_res_band]) >> 1)
-                        S_index_mapped = sbr->bs_add_harmonic[ch][current_hi_res_band];
+                        S_index_mapped[m] = sbr->bs_add_harmonic[ch][current_hi_res_band];
                 }
 
 
@@ -1330,14 +1499,11 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
                 /* S_M only depends on E_orig, Q_div and S_index_mapped:
                  * S_index_mapped can only be non-zero once per HI_RES band
                  */
-                if (S_index_mapped == 0)
+                if (S_index_mapped[m] == 0)
                 {
                     S_M[m] = 0;
                 } else {
                     S_M[m] = sbr->E_orig[ch][current_res_band2][l] * Q_div;
-
-                    /* accumulate sinusoid part of the total energy */
-                    den += S_M[m];
                 }
 
 
@@ -1345,28 +1511,38 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
                 /* ratio of the energy of the original signal and the energy
                  * of the HF generated signal
                  */
-                G = sbr->E_orig[ch][current_res_band2][l] / (1.0 + sbr->E_curr[ch][m][l]);
+                if (sbr->fast_math)
+                    G = sbr->E_orig[ch][current_res_band2][l] / (1 + sbr->E_curr[ch][m][l]);
+                else
+                    G = sbr->E_orig[ch][current_res_band2][l] / (1.0 + sbr->E_curr[ch][m][l]);
                 if ((S_mapped == 0) && (delta == 1))
                     G *= Q_div;
                 else if (S_mapped == 1)
                     G *= Q_div2;
 
 
-                /* limit the additional noise energy level */
-                /* and apply the limiter */
-                if (G <= G_max)
-                {
-                    Q_M_lim[m] = Q_M;
-                    G_lim[m] = G;
-                } else {
-                    Q_M_lim[m] = Q_M * G_max / G;
-                    G_lim[m] = G_max;
-                }
+                Q_M_lim[m] = Q_M;
+                G_lim[m] = G;
+            }
 
+            /* limit the additional noise energy level */
+            /* and apply the limiter */
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+            if (sbr->sse)
+                limit_gain_sse(G_lim, Q_M_lim, G_max, ml1, ml2, sbr->fast_math);
+            else
+#endif
+            limit_gain(G_lim, Q_M_lim, G_max, ml1, ml2);
+
+            for (m = ml1; m < ml2; m++)
+            {
+                /* accumulate sinusoid part of the total energy */
+                if (S_index_mapped[m] != 0)
+                    den += S_M[m];
 
                 /* accumulate the total energy */
                 den += sbr->E_curr[ch][m][l] * G_lim[m];
-                if ((S_index_mapped == 0) && (l != sbr->l_A[ch]))
+                if ((S_index_mapped[m] == 0) && (l != sbr->l_A[ch]))
                     den += Q_M_lim[m];
             }
 
@@ -1374,22 +1550,27 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
             G_boost = (acc1 + EPS) / (den + EPS);
             G_boost = min(G_boost, 2.51188643 /* 1.584893192 ^ 2 */);
 
-            for (m = ml1; m < ml2; m++)
+            m = ml1;
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+            if (sbr->sse && !sbr->lp)
+                m = apply_gain_boost_sse(adj, l, G_lim, Q_M_lim, S_M, G_boost, ml1, ml2,
+                    sbr->fast_math);
+#endif
+            for (; m < ml2; m++)
             {
                 /* apply compensation to gain, noise floor sf's and sinusoid levels */
-#ifndef SBR_LOW_POWER
-                adj->G_lim_boost[l][m] = sqrt(G_lim[m] * G_boost);
-#else
-                /* sqrt() will be done after the aliasing reduction to save a
-                 * few multiplies
+                /* in low power mode the sqrt() will be done after the aliasing
+                 * reduction to save a few multiplies
                  */
-                adj->G_lim_boost[l][m] = G_lim[m] * G_boost;
-#endif
-                adj->Q_M_lim_boost[l][m] = sqrt(Q_M_lim[m] * G_boost);
+                if (sbr->lp)
+                    adj->G_lim_boost[l][m] = G_lim[m] * G_boost;
+                else
+                    adj->G_lim_boost[l][m] = sbr_sqrt_f(sbr, G_lim[m] * G_boost);
+                adj->Q_M_lim_boost[l][m] = sbr_sqrt_f(sbr, Q_M_lim[m] * G_boost);
 
                 if (S_M[m] != 0)
                 {
-                    adj->S_M_boost[l][m] = sqrt(S_M[m] * G_boost);
+                    adj->S_M_boost[l][m] = sbr_sqrt_f(sbr, S_M[m] * G_boost);
                 } else {
                     adj->S_M_boost[l][m] = 0;
                 }
@@ -1401,7 +1582,6 @@ static void calculate_gain(sbr_info *sbr, sbr_hfadj_info *adj, uint8_t ch)
 
 #endif
 
-#ifdef SBR_LOW_POWER
 static void calc_gain_groups(sbr_info *sbr, sbr_hfadj_info *adj, real_t *deg, uint8_t ch)
 {
     uint8_t l, k, i;
@@ -1478,7 +1658,7 @@ static void aliasing_reduction(sbr_info *sbr, sbr_hfadj_info *adj, real_t *deg,
                 /* E_total: integer */
                 E_total_est += sbr->E_curr[ch][m-sbr->kx][l];
 #ifdef FIXED_POINT
-                E_total += MUL_Q2(sbr->E_curr[ch][m-sbr->kx][l], adj->G_lim_boost[l][m-sbr->kx]);
+                E_total += MUL_R(sbr->E_curr[ch][m-sbr->kx][l], adj->G_lim_boost[l][m-sbr->kx]);
 #else
                 E_total += sbr->E_curr[ch][m-sbr->kx][l] * adj->G_lim_boost[l][m-sbr->kx];
 #endif
@@ -1490,7 +1670,7 @@ static void aliasing_reduction(sbr_info *sbr, sbr_hfadj_info *adj, real_t *deg,
                 G_target = 0;
             } else {
 #ifdef FIXED_POINT
-                G_target = (((int64_t)(E_total))<<Q2_BITS)/(E_total_est + EPS);
+                G_target = (((int64_t)(E_total))<<REAL_BITS)/(E_total_est + EPS);
 #else
                 G_target = E_total / (E_total_est + EPS);
 #endif
@@ -1514,7 +1694,7 @@ static void aliasing_reduction(sbr_info *sbr, sbr_hfadj_info *adj, real_t *deg,
 
                 /* acc: integer */
 #ifdef FIXED_POINT
-                acc += MUL_Q2(adj->G_lim_boost[l][m-sbr->kx], sbr->E_curr[ch][m-sbr->kx][l]);
+                acc += MUL_R(adj->G_lim_boost[l][m-sbr->kx], sbr->E_curr[ch][m-sbr->kx][l]);
 #else
                 acc += adj->G_lim_boost[l][m-sbr->kx] * sbr->E_curr[ch][m-sbr->kx][l];
 #endif
@@ -1526,7 +1706,7 @@ static void aliasing_reduction(sbr_info *sbr, sbr_hfadj_info *adj, real_t *deg,
                 acc = 0;
             } else {
 #ifdef FIXED_POINT
-                acc = (((int64_t)(E_total))<<Q2_BITS)/(acc + EPS);
+                acc = (((int64_t)(E_total))<<REAL_BITS)/(acc + EPS);
 #else
                 acc = E_total / (acc + EPS);
 #endif
@@ -1534,7 +1714,7 @@ static void aliasing_reduction(sbr_info *sbr, sbr_hfadj_info *adj, real_t *deg,
             for(m = sbr->f_group[l][(k<<1)]; m < sbr->f_group[l][(k<<1) + 1]; m++)
             {
 #ifdef FIXED_POINT
-                adj->G_lim_boost[l][m-sbr->kx] = MUL_Q2(acc, adj->G_lim_boost[l][m-sbr->kx]);
+                adj->G_lim_boost[l][m-sbr->kx] = MUL_R(acc, adj->G_lim_boost[l][m-sbr->kx]);
 #else
                 adj->G_lim_boost[l][m-sbr->kx] = acc * adj->G_lim_boost[l][m-sbr->kx];
 #endif
@@ -1550,18 +1730,90 @@ static void aliasing_reduction(sbr_info *sbr, sbr_hfadj_info *adj, real_t *deg,
                  m < sbr->f_table_lim[sbr->bs_limiter_bands][k+1]; m++)
             {
 #ifdef FIXED_POINT
-                 adj->G_lim_boost[l][m] = SBR_SQRT_Q2(adj->G_lim_boost[l][m]);
+                 adj->G_lim_boost[l][m] = SBR_SQRT_R(adj->G_lim_boost[l][m]);
 #else
-                 adj->G_lim_boost[l][m] = sqrt(adj->G_lim_boost[l][m]);
+                 adj->G_lim_boost[l][m] = sbr_sqrt_f(sbr, adj->G_lim_boost[l][m]);
 #endif
             }
         }
     }
 }
+
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+/* hf_assembly() for subbands 0..count-1 of one time slot, count a multiple of 4 */
+static SSE_TARGET void hf_assembly_sse(sbr_info *sbr, sbr_hfadj_info *adj, qmf_row_t *row,
+                                       const real_t *h_smooth, uint8_t ch, uint8_t l,
+                                       uint8_t count, uint8_t h_SL, uint8_t no_noise,
+                                       uint16_t fIndexNoise, uint8_t fIndexSine)
+{
+    static const int8_t phi_re[] = { 1, 0, -1, 0 };
+    static const int8_t phi_im[] = { 0, 1, 0, -1 };
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sin_re = _mm_set1_ps(phi_re[fIndexSine]);
+    const __m128 sin_im = _mm_set1_ps(phi_im[fIndexSine]);
+    /* rev = -1 for odd subbands */
+    const __m128 rev = (sbr->kx & 1) ? _mm_setr_ps(-1, 1, -1, 1) : _mm_setr_ps(1, -1, 1, -1);
+    uint8_t ri0 = sbr->GQ_ringbuf_index[ch];
+    uint8_t m, n;
+
+    for (m = 0; m < count; m += 4)
+    {
+        __m128 G_filt, Q_filt, S, x_re, x_im, v_re, v_im;
+        uint16_t idx = (fIndexNoise + m + 1) & 511;
+
+        if (h_SL != 0)
+        {
+            uint8_t ri = ri0;
+
+            G_filt = zero;
+            Q_filt = zero;
+            for (n = 0; n <= 4; n++)
+            {
+                __m128 h = _mm_set1_ps(h_smooth[n]);
+
+                ri++;
+                if (ri >= 5)
+                    ri -= 5;
+                G_filt = _mm_add_ps(G_filt, _mm_mul_ps(_mm_loadu_ps(&sbr->G_temp_prev[ch][ri][m]), h));
+                Q_filt = _mm_add_ps(Q_filt, _mm_mul_ps(_mm_loadu_ps(&sbr->Q_temp_prev[ch][ri][m]), h));
+            }
+        } else {
+            G_filt = _mm_loadu_ps(&sbr->G_temp_prev[ch][ri0][m]);
+            Q_filt = _mm_loadu_ps(&sbr->Q_temp_prev[ch][ri0][m]);
+        }
+
+        S = _mm_loadu_ps(&adj->S_M_boost[l][m]);
+        if (no_noise)
+            Q_filt = zero;
+        else
+            Q_filt = _mm_andnot_ps(_mm_cmpneq_ps(S, zero), Q_filt);
+
+        /* noise vectors V[idx..idx+3], wrapping around at 512 */
+        if (idx <= 508)
+        {
+            __m128 a = _mm_loadu_ps(&RE(V[idx]));
+            __m128 b = _mm_loadu_ps(&RE(V[idx+2]));
+            v_re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            v_im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        } else {
+            v_re = _mm_setr_ps(RE(V[idx]), RE(V[(idx+1) & 511]), RE(V[(idx+2) & 511]), RE(V[(idx+3) & 511]));
+            v_im = _mm_setr_ps(IM(V[idx]), IM(V[(idx+1) & 511]), IM(V[(idx+2) & 511]), IM(V[(idx+3) & 511]));
+        }
+
+        load_qmf4(row, m + sbr->kx, &x_re, &x_im);
+        x_re = _mm_add_ps(_mm_mul_ps(G_filt, x_re), _mm_mul_ps(Q_filt, v_re));
+        x_im = _mm_add_ps(_mm_mul_ps(G_filt, x_im), _mm_mul_ps(Q_filt, v_im));
+
+        /* add the sinusoids */
+        x_re = _mm_add_ps(x_re, _mm_mul_ps(S, sin_re));
+        x_im = _mm_add_ps(x_im, _mm_mul_ps(_mm_mul_ps(rev, S), sin_im));
+        store_qmf4(row, m + sbr->kx, x_re, x_im);
+    }
+}
 #endif
 
 static void hf_assembly(sbr_info *sbr, sbr_hfadj_info *adj,
-                        qmf_t Xsbr[MAX_NTSRHFG][64], uint8_t ch)
+                        qmf_row_t Xsbr[MAX_NTSRHFG], uint8_t ch)
 {
     static real_t h_smooth[] = {
         FRAC_CONST(0.03183050093751), FRAC_CONST(0.11516383427084),
@@ -1595,12 +1847,13 @@ static void hf_assembly(sbr_info *sbr, sbr_hfadj_info *adj,
     {
         uint8_t no_noise = (l == sbr->l_A[ch] || l == sbr->prevEnvIsShort[ch]) ? 1 : 0;
 
-#ifdef SBR_LOW_POWER
-        h_SL = 0;
-#else
-        h_SL = (sbr->bs_smoothing_mode == 1) ? 0 : 4;
-        h_SL = (no_noise ? 0 : h_SL);
-#endif
+        if (sbr->lp)
+        {
+            h_SL = 0;
+        } else {
+            h_SL = (sbr->bs_smoothing_mode == 1) ? 0 : 4;
+            h_SL = (no_noise ? 0 : h_SL);
+        }
 
         if (assembly_reset)
         {
@@ -1616,16 +1869,25 @@ static void hf_assembly(sbr_info *sbr, sbr_hfadj_info *adj,
 
         for (i = sbr->t_E[ch][l]; i < sbr->t_E[ch][l+1]; i++)
         {
-#ifdef SBR_LOW_POWER
             uint8_t i_min1, i_plus1;
             uint8_t sinusoids = 0;
-#endif
 
             /* load new values into ringbuffer */
             memcpy(sbr->G_temp_prev[ch][sbr->GQ_ringbuf_index[ch]], adj->G_lim_boost[l], sbr->M*sizeof(real_t));
             memcpy(sbr->Q_temp_prev[ch][sbr->GQ_ringbuf_index[ch]], adj->Q_M_lim_boost[l], sbr->M*sizeof(real_t));
 
-            for (m = 0; m < sbr->M; m++)
+            m = 0;
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+            if (sbr->sse && !sbr->lp &&
+                !(sbr->bs_extension_id == 3 && sbr->bs_extension_data == 42))
+            {
+                m = sbr->M & ~3;
+                hf_assembly_sse(sbr, adj, &Xsbr[i + sbr->tHFAdj], h_smooth, ch, l, m,
+                                h_SL, no_noise, fIndexNoise, fIndexSine);
+                fIndexNoise = (fIndexNoise + m) & 511;
+            }
+#endif
+            for (; m < sbr->M; m++)
             {
                 qmf_t psi;
 
@@ -1660,69 +1922,78 @@ static void hf_assembly(sbr_info *sbr, sbr_hfadj_info *adj,
 
                 /* the smoothed gain values are applied to Xsbr */
                 /* V is defined, not calculated */
-                //QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) = MUL_Q2(G_filt, QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]))
+                //QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) = MUL_Q2(G_filt, QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx))
                 //    + MUL_F(Q_filt, RE(V[fIndexNoise]));
-                QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) = MUL_R(G_filt, QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]))
+                QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) = MUL_R(G_filt, QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx))
                     + MUL_F(Q_filt, RE(V[fIndexNoise]));
                 if (sbr->bs_extension_id == 3 && sbr->bs_extension_data == 42)
-                    QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) = 16428320;
+                    QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) = 16428320;
 #ifndef SBR_LOW_POWER
-                //QMF_IM(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) = MUL_Q2(G_filt, QMF_IM(Xsbr[i + sbr->tHFAdj][m+sbr->kx]))
+                //QMF_IM_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) = MUL_Q2(G_filt, QMF_IM_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx))
                 //    + MUL_F(Q_filt, IM(V[fIndexNoise]));
-                QMF_IM(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) = MUL_R(G_filt, QMF_IM(Xsbr[i + sbr->tHFAdj][m+sbr->kx]))
-                    + MUL_F(Q_filt, IM(V[fIndexNoise]));
+                if (!sbr->lp)
+                {
+                    QMF_IM_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) = MUL_R(G_filt, QMF_IM_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx))
+                        + MUL_F(Q_filt, IM(V[fIndexNoise]));
+                }
 #endif
 
                 {
                     int8_t rev = (((m + sbr->kx) & 1) ? -1 : 1);
                     QMF_RE(psi) = adj->S_M_boost[l][m] * phi_re[fIndexSine];
-                    QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) += QMF_RE(psi);
+                    QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) += QMF_RE(psi);
 
 #ifndef SBR_LOW_POWER
-                    QMF_IM(psi) = rev * adj->S_M_boost[l][m] * phi_im[fIndexSine];
-                    QMF_IM(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) += QMF_IM(psi);
-#else
-
-                    i_min1 = (fIndexSine - 1) & 3;
-                    i_plus1 = (fIndexSine + 1) & 3;
-
-                    if ((m == 0) && (phi_re[i_plus1] != 0))
+                    if (!sbr->lp)
+                    {
+                        QMF_IM(psi) = rev * adj->S_M_boost[l][m] * phi_im[fIndexSine];
+                        QMF_IM_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) += QMF_IM(psi);
+                    } else
+#endif
                     {
-                        QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx - 1]) +=
-                            (rev*phi_re[i_plus1] * MUL_F(adj->S_M_boost[l][0], FRAC_CONST(0.00815)));
-                        if (sbr->M != 0)
+                        /* low power: leak the sinusoid into the neighbouring
+                           subbands to reduce aliasing */
+                        i_min1 = (fIndexSine - 1) & 3;
+                        i_plus1 = (fIndexSine + 1) & 3;
+
+                        if ((m == 0) && (phi_re[i_plus1] != 0))
                         {
-                            QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) -=
-                                (rev*phi_re[i_plus1] * MUL_F(adj->S_M_boost[l][1], FRAC_CONST(0.00815)));
+                            QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx - 1) +=
+                                (rev*phi_re[i_plus1] * MUL_F(adj->S_M_boost[l][0], FRAC_CONST(0.00815)));
+                            if (sbr->M != 0)
+                            {
+                                QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) -=
+                                    (rev*phi_re[i_plus1] * MUL_F(adj->S_M_boost[l][1], FRAC_CONST(0.00815)));
+                            }
                         }
-                    }
-                    if ((m > 0) && (m < sbr->M - 1) && (sinusoids < 16) && (phi_re[i_min1] != 0))
-                    {
-                        QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) -=
-                            (rev*phi_re[i_min1] * MUL_F(adj->S_M_boost[l][m - 1], FRAC_CONST(0.00815)));
-                    }
-                    if ((m > 0) && (m < sbr->M - 1) && (sinusoids < 16) && (phi_re[i_plus1] != 0))
-                    {
-                        QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) -=
-                            (rev*phi_re[i_plus1] * MUL_F(adj->S_M_boost[l][m + 1], FRAC_CONST(0.00815)));
-                    }
-                    if ((m == sbr->M - 1) && (sinusoids < 16) && (phi_re[i_min1] != 0))
-                    {
-                        if (m > 0)
+                        if ((m > 0) && (m < sbr->M - 1) && (sinusoids < 16) && (phi_re[i_min1] != 0))
                         {
-                            QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx]) -=
+                            QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) -=
                                 (rev*phi_re[i_min1] * MUL_F(adj->S_M_boost[l][m - 1], FRAC_CONST(0.00815)));
                         }
-                        if (m + sbr->kx + 1 < 64)
+                        if ((m > 0) && (m < sbr->M - 1) && (sinusoids < 16) && (phi_re[i_plus1] != 0))
                         {
-                            QMF_RE(Xsbr[i + sbr->tHFAdj][m+sbr->kx + 1]) +=
-                                (rev*phi_re[i_min1] * MUL_F(adj->S_M_boost[l][m], FRAC_CONST(0.00815)));
+                            QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) -=
+                                (rev*phi_re[i_plus1] * MUL_F(adj->S_M_boost[l][m + 1], FRAC_CONST(0.00815)));
+                        }
+                        if ((m == sbr->M - 1) && (sinusoids < 16) && (phi_re[i_min1] != 0))
+                        {
+                            if (m > 0)
+                            {
+                                QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx) -=
+                                    (rev*phi_re[i_min1] * MUL_F(adj->S_M_boost[l][m - 1], FRAC_CONST(0.00815)));
+                            }
+                            if (m + sbr->kx + 1 < 64)
+                            {
+                                QMF_RE_AT(Xsbr[i + sbr->tHFAdj], m+sbr->kx + 1) +=
+                                    (rev*phi_re[i_min1] * MUL_F(adj->S_M_boost[l][m], FRAC_CONST(0.00815)));
+                            }
                         }
-                    }
 
-                    if (adj->S_M_boost[l][m] != 0)
-                        sinusoids++;
-#endif
+
+                        if (adj->S_M_boost[l][m] != 0)
+                            sinusoids++;
+                    }
                 }
             }
 
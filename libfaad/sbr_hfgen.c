@@ -39,31 +39,32 @@
 #include "sbr_hfgen.h"
 #include "sbr_fbt.h"
 
+#ifdef USE_SSE
+#include <xmmintrin.h>
+#endif
+
 /* static function declarations */
-#ifdef SBR_LOW_POWER
-static void calc_prediction_coef_lp(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
+static void calc_prediction_coef_lp(sbr_info *sbr, qmf_row_t Xlow[MAX_NTSRHFG],
                                     complex_t *alpha_0, complex_t *alpha_1, real_t *rxx);
 static void calc_aliasing_degree(sbr_info *sbr, real_t *rxx, real_t *deg);
-#else
-static void calc_prediction_coef(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
+#ifndef SBR_LOW_POWER
+static void calc_prediction_coef(sbr_info *sbr, qmf_row_t Xlow[MAX_NTSRHFG],
                                  complex_t *alpha_0, complex_t *alpha_1, uint8_t k);
+#ifdef USE_SSE
+static void calc_prediction_coef_sse(sbr_info *sbr, qmf_row_t Xlow[MAX_NTSRHFG],
+                                     complex_t *alpha_0, complex_t *alpha_1, uint8_t ch);
+#endif
 #endif
 static void calc_chirp_factors(sbr_info *sbr, uint8_t ch);
 static void patch_construction(sbr_info *sbr);
 
 
-void hf_generation(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
-                   qmf_t Xhigh[MAX_NTSRHFG][64]
-#ifdef SBR_LOW_POWER
-                   ,real_t *deg
-#endif
-                   ,uint8_t ch)
+void hf_generation(sbr_info *sbr, qmf_row_t Xlow[MAX_NTSRHFG],
+                   qmf_row_t Xhigh[MAX_NTSRHFG], real_t *deg, uint8_t ch)
 {
     uint8_t l, i, x;
     ALIGN complex_t alpha_0[64], alpha_1[64];
-#ifdef SBR_LOW_POWER
     ALIGN real_t rxx[64];
-#endif
 
     uint8_t offset = sbr->tHFAdj;
     uint8_t first = sbr->t_E[ch][0];
@@ -71,17 +72,21 @@ void hf_generation(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
 
     calc_chirp_factors(sbr, ch);
 
-#ifdef SBR_LOW_POWER
-    memset(deg, 0, 64*sizeof(real_t));
-#endif
+    if (sbr->lp)
+        memset(deg, 0, 64*sizeof(real_t));
 
     if ((ch == 0) && (sbr->Reset))
         patch_construction(sbr);
 
     /* calculate the prediction coefficients */
-#ifdef SBR_LOW_POWER
-    calc_prediction_coef_lp(sbr, Xlow, alpha_0, alpha_1, rxx);
-    calc_aliasing_degree(sbr, rxx, deg);
+    if (sbr->lp)
+    {
+        calc_prediction_coef_lp(sbr, Xlow, alpha_0, alpha_1, rxx);
+        calc_aliasing_degree(sbr, rxx, deg);
+    }
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+    else if (sbr->sse)
+        calc_prediction_coef_sse(sbr, Xlow, alpha_0, alpha_1, ch);
 #endif
 
     /* actual HF generation */
@@ -89,7 +94,7 @@ void hf_generation(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
     {
         for (x = 0; x < sbr->patchNoSubbands[i]; x++)
         {
-            real_t a0_r, a0_i, a1_r, a1_i;
+            real_t a0_r, a1_r;
             real_t bw, bw2;
             uint8_t q, p, k, g;
 
@@ -101,12 +106,13 @@ void hf_generation(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
             }
             p = sbr->patchStartSubband[i] + x;
 
-#ifdef SBR_LOW_POWER
-            if (x != 0 /*x < sbr->patchNoSubbands[i]-1*/)
-                deg[k] = deg[p];
-            else
-                deg[k] = 0;
-#endif
+            if (sbr->lp)
+            {
+                if (x != 0 /*x < sbr->patchNoSubbands[i]-1*/)
+                    deg[k] = deg[p];
+                else
+                    deg[k] = 0;
+            }
 
             g = sbr->table_map_k_to_g[k];
 
@@ -118,61 +124,77 @@ void hf_generation(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
             if (bw2 > 0)
             {
                 real_t temp1_r, temp2_r, temp3_r;
+
 #ifndef SBR_LOW_POWER
-                real_t temp1_i, temp2_i, temp3_i;
-                calc_prediction_coef(sbr, Xlow, alpha_0, alpha_1, p);
+                if (!sbr->lp)
+                {
+                    real_t a0_i, a1_i;
+                    real_t temp1_i, temp2_i, temp3_i;
+#ifdef USE_SSE
+                    if (!sbr->sse)
+                        calc_prediction_coef(sbr, Xlow, alpha_0, alpha_1, p);
+#else
+                    calc_prediction_coef(sbr, Xlow, alpha_0, alpha_1, p);
+#endif
+
+                    a0_r = MUL_C(RE(alpha_0[p]), bw);
+                    a1_r = MUL_C(RE(alpha_1[p]), bw2);
+                    a0_i = MUL_C(IM(alpha_0[p]), bw);
+                    a1_i = MUL_C(IM(alpha_1[p]), bw2);
+
+                    temp2_r = QMF_RE_AT(Xlow[first - 2 + offset], p);
+                    temp3_r = QMF_RE_AT(Xlow[first - 1 + offset], p);
+                    temp2_i = QMF_IM_AT(Xlow[first - 2 + offset], p);
+                    temp3_i = QMF_IM_AT(Xlow[first - 1 + offset], p);
+                    for (l = first; l < last; l++)
+                    {
+                        temp1_r = temp2_r;
+                        temp2_r = temp3_r;
+                        temp3_r = QMF_RE_AT(Xlow[l + offset], p);
+                        temp1_i = temp2_i;
+                        temp2_i = temp3_i;
+                        temp3_i = QMF_IM_AT(Xlow[l + offset], p);
+
+                        QMF_RE_AT(Xhigh[l + offset], k) =
+                            temp3_r
+                          +(MUL_R(a0_r, temp2_r) -
+                            MUL_R(a0_i, temp2_i) +
+                            MUL_R(a1_r, temp1_r) -
+                            MUL_R(a1_i, temp1_i));
+                        QMF_IM_AT(Xhigh[l + offset], k) =
+                            temp3_i
+                          +(MUL_R(a0_i, temp2_r) +
+                            MUL_R(a0_r, temp2_i) +
+                            MUL_R(a1_i, temp1_r) +
+                            MUL_R(a1_r, temp1_i));
+                    }
+                    continue;
+                }
 #endif
 
+                /* low power: real valued patching */
                 a0_r = MUL_C(RE(alpha_0[p]), bw);
                 a1_r = MUL_C(RE(alpha_1[p]), bw2);
-#ifndef SBR_LOW_POWER
-                a0_i = MUL_C(IM(alpha_0[p]), bw);
-                a1_i = MUL_C(IM(alpha_1[p]), bw2);
-#endif
 
-            	temp2_r = QMF_RE(Xlow[first - 2 + offset][p]);
-            	temp3_r = QMF_RE(Xlow[first - 1 + offset][p]);
-#ifndef SBR_LOW_POWER
-            	temp2_i = QMF_IM(Xlow[first - 2 + offset][p]);
-            	temp3_i = QMF_IM(Xlow[first - 1 + offset][p]);
-#endif
-				for (l = first; l < last; l++)
+                temp2_r = QMF_RE_AT(Xlow[first - 2 + offset], p);
+                temp3_r = QMF_RE_AT(Xlow[first - 1 + offset], p);
+                for (l = first; l < last; l++)
                 {
-                	temp1_r = temp2_r;
-                	temp2_r = temp3_r;
-                	temp3_r = QMF_RE(Xlow[l + offset][p]);
-#ifndef SBR_LOW_POWER
-                	temp1_i = temp2_i;
-                	temp2_i = temp3_i;
-                    temp3_i = QMF_IM(Xlow[l + offset][p]);
-#endif
+                    temp1_r = temp2_r;
+                    temp2_r = temp3_r;
+                    temp3_r = QMF_RE_AT(Xlow[l + offset], p);
 
-#ifdef SBR_LOW_POWER
-                    QMF_RE(Xhigh[l + offset][k]) =
+                    QMF_RE_AT(Xhigh[l + offset], k) =
                         temp3_r
                       +(MUL_R(a0_r, temp2_r) +
                         MUL_R(a1_r, temp1_r));
-#else
-                    QMF_RE(Xhigh[l + offset][k]) =
-                        temp3_r
-                      +(MUL_R(a0_r, temp2_r) -
-                        MUL_R(a0_i, temp2_i) +
-                        MUL_R(a1_r, temp1_r) -
-                        MUL_R(a1_i, temp1_i));
-                    QMF_IM(Xhigh[l + offset][k]) =
-                        temp3_i
-                      +(MUL_R(a0_i, temp2_r) +
-                        MUL_R(a0_r, temp2_i) +
-                        MUL_R(a1_i, temp1_r) +
-                        MUL_R(a1_r, temp1_i));
-#endif
                 }
             } else {
                 for (l = first; l < last; l++)
                 {
-                    QMF_RE(Xhigh[l + offset][k]) = QMF_RE(Xlow[l + offset][p]);
+                    QMF_RE_AT(Xhigh[l + offset], k) = QMF_RE_AT(Xlow[l + offset], p);
 #ifndef SBR_LOW_POWER
-                    QMF_IM(Xhigh[l + offset][k]) = QMF_IM(Xlow[l + offset][p]);
+                    QMF_IM_AT(Xhigh[l + offset], k) = QMF_IM_AT(Xlow[l + offset], p);
 #endif
                 }
             }
@@ -195,18 +217,17 @@ typedef struct
     real_t det;
 } acorr_coef;
 
-#ifdef SBR_LOW_POWER
-static void auto_correlation(sbr_info *sbr, acorr_coef *ac,
-                             qmf_t buffer[MAX_NTSRHFG][64],
-                             uint8_t bd, uint8_t len)
+static void auto_correlation_lp(sbr_info *sbr, acorr_coef *ac,
+                                qmf_row_t buffer[MAX_NTSRHFG],
+                                uint8_t bd, uint8_t len)
 {
     real_t r01 = 0, r02 = 0, r11 = 0;
     int8_t j;
     uint8_t offset = sbr->tHFAdj;
 #ifdef FIXED_POINT
     const real_t rel = FRAC_CONST(0.999999); // 1 / (1 + 1e-6f);
-    uint32_t maxi = 0;
-    uint32_t pow2, exp;
+    uint32_t mask, exp;
+    real_t half;
 #else
     const real_t rel = 1 / (1 + 1e-6f);
 #endif
@@ -218,21 +239,31 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac,
     for (j = (offset-2); j < (len + offset); j++)
     {
         real_t x;
-        x = QMF_RE(buffer[j][bd])>>REAL_BITS;
+        x = QMF_RE_AT(buffer[j], bd)>>REAL_BITS;
         mask |= x ^ (x >> 31);
     }
 
     exp = wl_min_lzc(mask);
 
+    /* All-zero input. */
+    if (exp == 0) {
+        RE(ac->r01) = 0;
+        RE(ac->r02) = 0;
+        RE(ac->r11) = 0;
+        RE(ac->r12) = 0;
+        RE(ac->r22) = 0;
+        ac->det = 0;
+        return;
+    }
     /* improves accuracy */
-    if (exp > 0)
-        exp -= 1;
+    exp -= 1;
+    half = (1 << exp) >> 1;
 
     for (j = offset; j < len + offset; j++)
     {
-        real_t buf_j = ((QMF_RE(buffer[j][bd])+(1<<(exp-1)))>>exp);
-        real_t buf_j_1 = ((QMF_RE(buffer[j-1][bd])+(1<<(exp-1)))>>exp);
-        real_t buf_j_2 = ((QMF_RE(buffer[j-2][bd])+(1<<(exp-1)))>>exp);
+        real_t buf_j = ((QMF_RE_AT(buffer[j], bd)+half)>>exp);
+        real_t buf_j_1 = ((QMF_RE_AT(buffer[j-1], bd)+half)>>exp);
+        real_t buf_j_2 = ((QMF_RE_AT(buffer[j-2], bd)+half)>>exp);
 
         /* normalisation with rounding */
         r01 += MUL_R(buf_j, buf_j_1);
@@ -240,24 +271,24 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac,
         r11 += MUL_R(buf_j_1, buf_j_1);
     }
     RE(ac->r12) = r01 -
-        MUL_R(((QMF_RE(buffer[len+offset-1][bd])+(1<<(exp-1)))>>exp), ((QMF_RE(buffer[len+offset-2][bd])+(1<<(exp-1)))>>exp)) +
-        MUL_R(((QMF_RE(buffer[offset-1][bd])+(1<<(exp-1)))>>exp), ((QMF_RE(buffer[offset-2][bd])+(1<<(exp-1)))>>exp));
+        MUL_R(((QMF_RE_AT(buffer[len+offset-1], bd)+half)>>exp), ((QMF_RE_AT(buffer[len+offset-2], bd)+half)>>exp)) +
+        MUL_R(((QMF_RE_AT(buffer[offset-1], bd)+half)>>exp), ((QMF_RE_AT(buffer[offset-2], bd)+half)>>exp));
     RE(ac->r22) = r11 -
-        MUL_R(((QMF_RE(buffer[len+offset-2][bd])+(1<<(exp-1)))>>exp), ((QMF_RE(buffer[len+offset-2][bd])+(1<<(exp-1)))>>exp)) +
-        MUL_R(((QMF_RE(buffer[offset-2][bd])+(1<<(exp-1)))>>exp), ((QMF_RE(buffer[offset-2][bd])+(1<<(exp-1)))>>exp));
+        MUL_R(((QMF_RE_AT(buffer[len+offset-2], bd)+half)>>exp), ((QMF_RE_AT(buffer[len+offset-2], bd)+half)>>exp)) +
+        MUL_R(((QMF_RE_AT(buffer[offset-2], bd)+half)>>exp), ((QMF_RE_AT(buffer[offset-2], bd)+half)>>exp));
 #else
     for (j = offset; j < len + offset; j++)
     {
-        r01 += QMF_RE(buffer[j][bd]) * QMF_RE(buffer[j-1][bd]);
-        r02 += QMF_RE(buffer[j][bd]) * QMF_RE(buffer[j-2][bd]);
-        r11 += QMF_RE(buffer[j-1][bd]) * QMF_RE(buffer[j-1][bd]);
+        r01 += QMF_RE_AT(buffer[j], bd) * QMF_RE_AT(buffer[j-1], bd);
+        r02 += QMF_RE_AT(buffer[j], bd) * QMF_RE_AT(buffer[j-2], bd);
+        r11 += QMF_RE_AT(buffer[j-1], bd) * QMF_RE_AT(buffer[j-1], bd);
     }
     RE(ac->r12) = r01 -
-        QMF_RE(buffer[len+offset-1][bd]) * QMF_RE(buffer[len+offset-2][bd]) +
-        QMF_RE(buffer[offset-1][bd]) * QMF_RE(buffer[offset-2][bd]);
+        QMF_RE_AT(buffer[len+offset-1], bd) * QMF_RE_AT(buffer[len+offset-2], bd) +
+        QMF_RE_AT(buffer[offset-1], bd) * QMF_RE_AT(buffer[offset-2], bd);
     RE(ac->r22) = r11 -
-        QMF_RE(buffer[len+offset-2][bd]) * QMF_RE(buffer[len+offset-2][bd]) +
-        QMF_RE(buffer[offset-2][bd]) * QMF_RE(buffer[offset-2][bd]);
+        QMF_RE_AT(buffer[len+offset-2], bd) * QMF_RE_AT(buffer[len+offset-2], bd) +
+        QMF_RE_AT(buffer[offset-2], bd) * QMF_RE_AT(buffer[offset-2], bd);
 #endif
     RE(ac->r01) = r01;
     RE(ac->r02) = r02;
@@ -265,8 +296,9 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac,
 
     ac->det = MUL_R(RE(ac->r11), RE(ac->r22)) - MUL_F(MUL_R(RE(ac->r12), RE(ac->r12)), rel);
 }
-#else
-static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_t buffer[MAX_NTSRHFG][64],
+
+#ifndef SBR_LOW_POWER
+static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_row_t buffer[MAX_NTSRHFG],
                              uint8_t bd, uint8_t len)
 {
     real_t r01r = 0, r01i = 0, r02r = 0, r02i = 0, r11r = 0;
@@ -287,9 +319,9 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_t buffer[MAX_NTS
     for (j = (offset-2); j < (len + offset); j++)
     {
         real_t x;
-        x = QMF_RE(buffer[j][bd])>>REAL_BITS;
+        x = QMF_RE_AT(buffer[j], bd)>>REAL_BITS;
         mask |= x ^ (x >> 31);
-        x = QMF_IM(buffer[j][bd])>>REAL_BITS;
+        x = QMF_IM_AT(buffer[j], bd)>>REAL_BITS;
         mask |= x ^ (x >> 31);
     }
 
@@ -316,10 +348,10 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_t buffer[MAX_NTS
     /* Now exp is 0..31 */
     half = (1 << exp) >> 1;
 
-    temp2_r = (QMF_RE(buffer[offset-2][bd]) + half) >> exp;
-    temp2_i = (QMF_IM(buffer[offset-2][bd]) + half) >> exp;
-    temp3_r = (QMF_RE(buffer[offset-1][bd]) + half) >> exp;
-    temp3_i = (QMF_IM(buffer[offset-1][bd]) + half) >> exp;
+    temp2_r = (QMF_RE_AT(buffer[offset-2], bd) + half) >> exp;
+    temp2_i = (QMF_IM_AT(buffer[offset-2], bd) + half) >> exp;
+    temp3_r = (QMF_RE_AT(buffer[offset-1], bd) + half) >> exp;
+    temp3_i = (QMF_IM_AT(buffer[offset-1], bd) + half) >> exp;
     // Save these because they are needed after loop
     temp4_r = temp2_r;
     temp4_i = temp2_i;
@@ -332,8 +364,8 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_t buffer[MAX_NTS
         temp1_i = temp2_i; // temp1_i = (QMF_IM(buffer[offset-2][bd] + (1<<(exp-1))) >> exp;
         temp2_r = temp3_r; // temp2_r = (QMF_RE(buffer[offset-1][bd] + (1<<(exp-1))) >> exp;
         temp2_i = temp3_i; // temp2_i = (QMF_IM(buffer[offset-1][bd] + (1<<(exp-1))) >> exp;
-        temp3_r = (QMF_RE(buffer[j][bd]) + half) >> exp;
-        temp3_i = (QMF_IM(buffer[j][bd]) + half) >> exp;
+        temp3_r = (QMF_RE_AT(buffer[j], bd) + half) >> exp;
+        temp3_i = (QMF_IM_AT(buffer[j], bd) + half) >> exp;
         r01r += MUL_R(temp3_r, temp2_r) + MUL_R(temp3_i, temp2_i);
         r01i += MUL_R(temp3_i, temp2_r) - MUL_R(temp3_r, temp2_i);
         r02r += MUL_R(temp3_r, temp1_r) + MUL_R(temp3_i, temp1_i);
@@ -346,12 +378,12 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_t buffer[MAX_NTS
     // temp1_i = (QMF_IM(buffer[len+offset-1-2][bd] + (1<<(exp-1))) >> exp;
     // temp2_r = (QMF_RE(buffer[len+offset-1-1][bd] + (1<<(exp-1))) >> exp;
     // temp2_i = (QMF_IM(buffer[len+offset-1-1][bd] + (1<<(exp-1))) >> exp;
-    // temp3_r = (QMF_RE(buffer[len+offset-1][bd]) + (1<<(exp-1))) >> exp;
-    // temp3_i = (QMF_IM(buffer[len+offset-1][bd]) + (1<<(exp-1))) >> exp;
-    // temp4_r = (QMF_RE(buffer[offset-2][bd]) + (1<<(exp-1))) >> exp;
-    // temp4_i = (QMF_IM(buffer[offset-2][bd]) + (1<<(exp-1))) >> exp;
-    // temp5_r = (QMF_RE(buffer[offset-1][bd]) + (1<<(exp-1))) >> exp;
-    // temp5_i = (QMF_IM(buffer[offset-1][bd]) + (1<<(exp-1))) >> exp;
+    // temp3_r = (QMF_RE_AT(buffer[len+offset-1], bd) + (1<<(exp-1))) >> exp;
+    // temp3_i = (QMF_IM_AT(buffer[len+offset-1], bd) + (1<<(exp-1))) >> exp;
+    // temp4_r = (QMF_RE_AT(buffer[offset-2], bd) + (1<<(exp-1))) >> exp;
+    // temp4_i = (QMF_IM_AT(buffer[offset-2], bd) + (1<<(exp-1))) >> exp;
+    // temp5_r = (QMF_RE_AT(buffer[offset-1], bd) + (1<<(exp-1))) >> exp;
+    // temp5_i = (QMF_IM_AT(buffer[offset-1], bd) + (1<<(exp-1))) >> exp;
 
     RE(ac->r12) = r01r -
         (MUL_R(temp3_r, temp2_r) + MUL_R(temp3_i, temp2_i)) +
@@ -365,10 +397,10 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_t buffer[MAX_NTS
 
 #else
 
-    temp2_r = QMF_RE(buffer[offset-2][bd]);
-    temp2_i = QMF_IM(buffer[offset-2][bd]);
-    temp3_r = QMF_RE(buffer[offset-1][bd]);
-    temp3_i = QMF_IM(buffer[offset-1][bd]);
+    temp2_r = QMF_RE_AT(buffer[offset-2], bd);
+    temp2_i = QMF_IM_AT(buffer[offset-2], bd);
+    temp3_r = QMF_RE_AT(buffer[offset-1], bd);
+    temp3_i = QMF_IM_AT(buffer[offset-1], bd);
     // Save these because they are needed after loop
     temp4_r = temp2_r;
     temp4_i = temp2_i;
@@ -381,8 +413,8 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_t buffer[MAX_NTS
     	temp1_i = temp2_i; // temp1_i = QMF_IM(buffer[j-2][bd];
     	temp2_r = temp3_r; // temp2_r = QMF_RE(buffer[j-1][bd];
     	temp2_i = temp3_i; // temp2_i = QMF_IM(buffer[j-1][bd];
-        temp3_r = QMF_RE(buffer[j][bd]);
-        temp3_i = QMF_IM(buffer[j][bd]);
+        temp3_r = QMF_RE_AT(buffer[j], bd);
+        temp3_i = QMF_IM_AT(buffer[j], bd);
         r01r += temp3_r * temp2_r + temp3_i * temp2_i;
         r01i += temp3_i * temp2_r - temp3_r * temp2_i;
         r02r += temp3_r * temp1_r + temp3_i * temp1_i;
@@ -395,12 +427,12 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_t buffer[MAX_NTS
     // temp1_i = QMF_IM(buffer[len+offset-1-2][bd];
     // temp2_r = QMF_RE(buffer[len+offset-1-1][bd];
     // temp2_i = QMF_IM(buffer[len+offset-1-1][bd];
-    // temp3_r = QMF_RE(buffer[len+offset-1][bd]);
-    // temp3_i = QMF_IM(buffer[len+offset-1][bd]);
-    // temp4_r = QMF_RE(buffer[offset-2][bd]);
-    // temp4_i = QMF_IM(buffer[offset-2][bd]);
-    // temp5_r = QMF_RE(buffer[offset-1][bd]);
-    // temp5_i = QMF_IM(buffer[offset-1][bd]);
+    // temp3_r = QMF_RE_AT(buffer[len+offset-1], bd);
+    // temp3_i = QMF_IM_AT(buffer[len+offset-1], bd);
+    // temp4_r = QMF_RE_AT(buffer[offset-2], bd);
+    // temp4_i = QMF_IM_AT(buffer[offset-2], bd);
+    // temp5_r = QMF_RE_AT(buffer[offset-1], bd);
+    // temp5_i = QMF_IM_AT(buffer[offset-1], bd);
 
     RE(ac->r12) = r01r -
         (temp3_r * temp2_r + temp3_i * temp2_i) +
@@ -424,47 +456,115 @@ static void auto_correlation(sbr_info *sbr, acorr_coef *ac, qmf_t buffer[MAX_NTS
 }
 #endif
 
+#if defined(USE_SSE) && !defined(SBR_LOW_POWER)
+/* auto_correlation() for the 4 bands bd..bd+3 at once, one band per lane */
+static SSE_TARGET void auto_correlation_sse(sbr_info *sbr, acorr_coef *ac,
+                                            qmf_row_t buffer[MAX_NTSRHFG],
+                                            uint8_t bd, uint8_t len)
+{
+    __m128 r01r = _mm_setzero_ps(), r01i = _mm_setzero_ps();
+    __m128 r02r = _mm_setzero_ps(), r02i = _mm_setzero_ps();
+    __m128 r11r = _mm_setzero_ps();
+    __m128 r12r, r12i, r22r, det;
+    __m128 temp1_r, temp1_i, temp2_r, temp2_i, temp3_r, temp3_i, temp4_r, temp4_i, temp5_r, temp5_i;
+    const __m128 rel = _mm_set1_ps(1 / (1 + 1e-6f));
+    real_t out[8][4];
+    int8_t j;
+    uint8_t offset = sbr->tHFAdj;
+
+    load_qmf4(&buffer[offset-2], bd, &temp2_r, &temp2_i);
+    load_qmf4(&buffer[offset-1], bd, &temp3_r, &temp3_i);
+    temp4_r = temp2_r;
+    temp4_i = temp2_i;
+    temp5_r = temp3_r;
+    temp5_i = temp3_i;
+
+    for (j = offset; j < len + offset; j++)
+    {
+        temp1_r = temp2_r;
+        temp1_i = temp2_i;
+        temp2_r = temp3_r;
+        temp2_i = temp3_i;
+        load_qmf4(&buffer[j], bd, &temp3_r, &temp3_i);
+        r01r = _mm_add_ps(r01r, _mm_add_ps(_mm_mul_ps(temp3_r, temp2_r), _mm_mul_ps(temp3_i, temp2_i)));
+        r01i = _mm_add_ps(r01i, _mm_sub_ps(_mm_mul_ps(temp3_i, temp2_r), _mm_mul_ps(temp3_r, temp2_i)));
+        r02r = _mm_add_ps(r02r, _mm_add_ps(_mm_mul_ps(temp3_r, temp1_r), _mm_mul_ps(temp3_i, temp1_i)));
+        r02i = _mm_add_ps(r02i, _mm_sub_ps(_mm_mul_ps(temp3_i, temp1_r), _mm_mul_ps(temp3_r, temp1_i)));
+        r11r = _mm_add_ps(r11r, _mm_add_ps(_mm_mul_ps(temp2_r, temp2_r), _mm_mul_ps(temp2_i, temp2_i)));
+    }
+
+    r12r = _mm_add_ps(_mm_sub_ps(r01r,
+        _mm_add_ps(_mm_mul_ps(temp3_r, temp2_r), _mm_mul_ps(temp3_i, temp2_i))),
+        _mm_add_ps(_mm_mul_ps(temp5_r, temp4_r), _mm_mul_ps(temp5_i, temp4_i)));
+    r12i = _mm_add_ps(_mm_sub_ps(r01i,
+        _mm_sub_ps(_mm_mul_ps(temp3_i, temp2_r), _mm_mul_ps(temp3_r, temp2_i))),
+        _mm_sub_ps(_mm_mul_ps(temp5_i, temp4_r), _mm_mul_ps(temp5_r, temp4_i)));
+    r22r = _mm_add_ps(_mm_sub_ps(r11r,
+        _mm_add_ps(_mm_mul_ps(temp2_r, temp2_r), _mm_mul_ps(temp2_i, temp2_i))),
+        _mm_add_ps(_mm_mul_ps(temp4_r, temp4_r), _mm_mul_ps(temp4_i, temp4_i)));
+    det = _mm_sub_ps(_mm_mul_ps(r11r, r22r),
+        _mm_mul_ps(rel, _mm_add_ps(_mm_mul_ps(r12r, r12r), _mm_mul_ps(r12i, r12i))));
+
+    _mm_storeu_ps(out[0], r01r);
+    _mm_storeu_ps(out[1], r01i);
+    _mm_storeu_ps(out[2], r02r);
+    _mm_storeu_ps(out[3], r02i);
+    _mm_storeu_ps(out[4], r11r);
+    _mm_storeu_ps(out[5], r12r);
+    _mm_storeu_ps(out[6], r12i);
+    _mm_storeu_ps(out[7], det);
+
+    for (j = 0; j < 4; j++)
+    {
+        RE(ac[j].r01) = out[0][j];
+        IM(ac[j].r01) = out[1][j];
+        RE(ac[j].r02) = out[2][j];
+        IM(ac[j].r02) = out[3][j];
+        RE(ac[j].r11) = out[4][j];
+        RE(ac[j].r12) = out[5][j];
+        IM(ac[j].r12) = out[6][j];
+        ac[j].det = out[7][j];
+    }
+}
+#endif
+
 /* calculate linear prediction coefficients using the covariance method */
 #ifndef SBR_LOW_POWER
-static void calc_prediction_coef(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
-                                 complex_t *alpha_0, complex_t *alpha_1, uint8_t k)
+static void prediction_coef(acorr_coef *ac, complex_t *alpha_0, complex_t *alpha_1, uint8_t k)
 {
     real_t tmp;
-    acorr_coef ac;
-
-    auto_correlation(sbr, &ac, Xlow, k, sbr->numTimeSlotsRate + 6);
 
-    if (ac.det == 0)
+    if (ac->det == 0)
     {
         RE(alpha_1[k]) = 0;
         IM(alpha_1[k]) = 0;
     } else {
 #ifdef FIXED_POINT
-        tmp = (MUL_R(RE(ac.r01), RE(ac.r12)) - MUL_R(IM(ac.r01), IM(ac.r12)) - MUL_R(RE(ac.r02), RE(ac.r11)));
-        RE(alpha_1[k]) = DIV_R(tmp, ac.det);
-        tmp = (MUL_R(IM(ac.r01), RE(ac.r12)) + MUL_R(RE(ac.r01), IM(ac.r12)) - MUL_R(IM(ac.r02), RE(ac.r11)));
-        IM(alpha_1[k]) = DIV_R(tmp, ac.det);
+        tmp = (MUL_R(RE(ac->r01), RE(ac->r12)) - MUL_R(IM(ac->r01), IM(ac->r12)) - MUL_R(RE(ac->r02), RE(ac->r11)));
+        RE(alpha_1[k]) = DIV_R(tmp, ac->det);
+        tmp = (MUL_R(IM(ac->r01), RE(ac->r12)) + MUL_R(RE(ac->r01), IM(ac->r12)) - MUL_R(IM(ac->r02), RE(ac->r11)));
+        IM(alpha_1[k]) = DIV_R(tmp, ac->det);
 #else
-        tmp = REAL_CONST(1.0) / ac.det;
-        RE(alpha_1[k]) = (MUL_R(RE(ac.r01), RE(ac.r12)) - MUL_R(IM(ac.r01), IM(ac.r12)) - MUL_R(RE(ac.r02), RE(ac.r11))) * tmp;
-        IM(alpha_1[k]) = (MUL_R(IM(ac.r01), RE(ac.r12)) + MUL_R(RE(ac.r01), IM(ac.r12)) - MUL_R(IM(ac.r02), RE(ac.r11))) * tmp;
+        tmp = REAL_CONST(1.0) / ac->det;
+        RE(alpha_1[k]) = (MUL_R(RE(ac->r01), RE(ac->r12)) - MUL_R(IM(ac->r01), IM(ac->r12)) - MUL_R(RE(ac->r02), RE(ac->r11))) * tmp;
+        IM(alpha_1[k]) = (MUL_R(IM(ac->r01), RE(ac->r12)) + MUL_R(RE(ac->r01), IM(ac->r12)) - MUL_R(IM(ac->r02), RE(ac->r11))) * tmp;
 #endif
     }
 
-    if (RE(ac.r11) == 0)
+    if (RE(ac->r11) == 0)
     {
         RE(alpha_0[k]) = 0;
         IM(alpha_0[k]) = 0;
     } else {
 #ifdef FIXED_POINT
-        tmp = -(RE(ac.r01) + MUL_R(RE(alpha_1[k]), RE(ac.r12)) + MUL_R(IM(alpha_1[k]), IM(ac.r12)));
-        RE(alpha_0[k]) = DIV_R(tmp, RE(ac.r11));
-        tmp = -(IM(ac.r01) + MUL_R(IM(alpha_1[k]), RE(ac.r12)) - MUL_R(RE(alpha_1[k]), IM(ac.r12)));
-        IM(alpha_0[k]) = DIV_R(tmp, RE(ac.r11));
+        tmp = -(RE(ac->r01) + MUL_R(RE(alpha_1[k]), RE(ac->r12)) + MUL_R(IM(alpha_1[k]), IM(ac->r12)));
+        RE(alpha_0[k]) = DIV_R(tmp, RE(ac->r11));
+        tmp = -(IM(ac->r01) + MUL_R(IM(alpha_1[k]), RE(ac->r12)) - MUL_R(RE(alpha_1[k]), IM(ac->r12)));
+        IM(alpha_0[k]) = DIV_R(tmp, RE(ac->r11));
 #else
-        tmp = 1.0f / RE(ac.r11);
-        RE(alpha_0[k]) = -(RE(ac.r01) + MUL_R(RE(alpha_1[k]), RE(ac.r12)) + MUL_R(IM(alpha_1[k]), IM(ac.r12))) * tmp;
-        IM(alpha_0[k]) = -(IM(ac.r01) + MUL_R(IM(alpha_1[k]), RE(ac.r12)) - MUL_R(RE(alpha_1[k]), IM(ac.r12))) * tmp;
+        tmp = 1.0f / RE(ac->r11);
+        RE(alpha_0[k]) = -(RE(ac->r01) + MUL_R(RE(alpha_1[k]), RE(ac->r12)) + MUL_R(IM(alpha_1[k]), IM(ac->r12))) * tmp;
+        IM(alpha_0[k]) = -(IM(ac->r01) + MUL_R(IM(alpha_1[k]), RE(ac->r12)) - MUL_R(RE(alpha_1[k]), IM(ac->r12))) * tmp;
 #endif
     }
 
@@ -478,8 +578,58 @@ static void calc_prediction_coef(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
     RE(alpha_1[k]) = 0;
     IM(alpha_1[k]) = 0;
 }
-#else
-static void calc_prediction_coef_lp(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
+
+static void calc_prediction_coef(sbr_info *sbr, qmf_row_t Xlow[MAX_NTSRHFG],
+                                 complex_t *alpha_0, complex_t *alpha_1, uint8_t k)
+{
+    acorr_coef ac;
+
+    auto_correlation(sbr, &ac, Xlow, k, sbr->numTimeSlotsRate + 6);
+    prediction_coef(&ac, alpha_0, alpha_1, k);
+}
+
+#ifdef USE_SSE
+/* calculate the coefficients of all low bands that get patched with
+ * filtering up front, so that neighbouring bands share one
+ * auto_correlation_sse() call
+ */
+static void calc_prediction_coef_sse(sbr_info *sbr, qmf_row_t Xlow[MAX_NTSRHFG],
+                                     complex_t *alpha_0, complex_t *alpha_1, uint8_t ch)
+{
+    uint8_t i, x, k, p, j;
+    uint8_t filtered[64] = {0};
+    acorr_coef ac[4];
+
+    k = sbr->kx;
+    for (i = 0; i < sbr->noPatches; i++)
+    {
+        for (x = 0; x < sbr->patchNoSubbands[i]; x++, k++)
+        {
+            real_t bw = sbr->bwArray[ch][sbr->table_map_k_to_g[k]];
+
+            if (MUL_C(bw, bw) > 0)
+                filtered[sbr->patchStartSubband[i] + x] = 1;
+        }
+    }
+
+    for (p = 0; p < 64; p += 4)
+    {
+        if (!(filtered[p] | filtered[p+1] | filtered[p+2] | filtered[p+3]))
+            continue;
+
+        auto_correlation_sse(sbr, ac, Xlow, p, sbr->numTimeSlotsRate + 6);
+
+        for (j = 0; j < 4; j++)
+        {
+            if (filtered[p+j])
+                prediction_coef(&ac[j], alpha_0, alpha_1, p+j);
+        }
+    }
+}
+#endif
+#endif
+
+static void calc_prediction_coef_lp(sbr_info *sbr, qmf_row_t Xlow[MAX_NTSRHFG],
                                     complex_t *alpha_0, complex_t *alpha_1, real_t *rxx)
 {
     uint8_t k;
@@ -488,7 +638,7 @@ static void calc_prediction_coef_lp(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
 
     for (k = 1; k < sbr->f_master[0]; k++)
     {
-        auto_correlation(sbr, &ac, Xlow, k, sbr->numTimeSlotsRate + 6);
+        auto_correlation_lp(sbr, &ac, Xlow, k, sbr->numTimeSlotsRate + 6);
 
         if (ac.det == 0)
         {
@@ -563,7 +713,6 @@ static void calc_aliasing_degree(sbr_info *sbr, real_t *rxx, real_t *deg)
         }
     }
 }
-#endif
 
 /* FIXED POINT: bwArray = COEF */
 static real_t mapNewBw(uint8_t invf_mode, uint8_t invf_mode_prev)
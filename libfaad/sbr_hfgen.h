@@ -35,12 +35,8 @@
 extern "C" {
 #endif
 
-void hf_generation(sbr_info *sbr, qmf_t Xlow[MAX_NTSRHFG][64],
-                   qmf_t Xhigh[MAX_NTSRHFG][64]
-#ifdef SBR_LOW_POWER
-                   ,real_t *deg
-#endif
-                   ,uint8_t ch);
+void hf_generation(sbr_info *sbr, qmf_row_t Xlow[MAX_NTSRHFG],
+                   qmf_row_t Xhigh[MAX_NTSRHFG], real_t *deg, uint8_t ch);
 
 #ifdef __cplusplus
 }
@@ -40,12 +40,90 @@
 #include "sbr_qmf_c.h"
 #include "sbr_syntax.h"
 
-qmfa_info *qmfa_init(uint8_t channels)
+#ifdef USE_SSE
+#include <xmmintrin.h>
+
+/* four window coefficients with stride 2 */
+static INLINE SSE_TARGET __m128 load_even(const real_t *a)
+{
+    return _mm_shuffle_ps(_mm_loadu_ps(a), _mm_loadu_ps(a + 4), _MM_SHUFFLE(2,0,2,0));
+}
+
+/* window and summation of sbr_qmf_analysis_32 */
+static SSE_TARGET void qmfa_window_sse(const real_t *x, real_t *u)
+{
+    uint32_t n;
+
+    for (n = 0; n < 64; n += 4)
+    {
+        __m128 s = _mm_mul_ps(_mm_loadu_ps(x + n), load_even(qmf_c + 2*n));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(x + n + 64), load_even(qmf_c + 2*(n + 64))));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(x + n + 128), load_even(qmf_c + 2*(n + 128))));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(x + n + 192), load_even(qmf_c + 2*(n + 192))));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(x + n + 256), load_even(qmf_c + 2*(n + 256))));
+        _mm_storeu_ps(u + n, s);
+    }
+}
+
+#ifndef SBR_LOW_POWER
+/* output window of sbr_qmf_synthesis_32 */
+static SSE_TARGET void qmfs32_window_sse(const real_t *v, real_t *output)
+{
+    uint32_t k;
+
+    for (k = 0; k < 32; k += 4)
+    {
+        __m128 s = _mm_mul_ps(_mm_loadu_ps(v + k), load_even(qmf_c + 2*k));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + 96 + k),  load_even(qmf_c + 64 + 2*k)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + 128 + k), load_even(qmf_c + 128 + 2*k)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + 224 + k), load_even(qmf_c + 192 + 2*k)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + 256 + k), load_even(qmf_c + 256 + 2*k)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + 352 + k), load_even(qmf_c + 320 + 2*k)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + 384 + k), load_even(qmf_c + 384 + 2*k)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + 480 + k), load_even(qmf_c + 448 + 2*k)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + 512 + k), load_even(qmf_c + 512 + 2*k)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + 608 + k), load_even(qmf_c + 576 + 2*k)));
+        _mm_storeu_ps(output + k, s);
+    }
+}
+
+/* output window of sbr_qmf_synthesis_64 */
+static SSE_TARGET void qmfs64_window_sse(const real_t *v, real_t *output)
+{
+    uint32_t k;
+
+    for (k = 0; k < 64; k += 4)
+    {
+        __m128 s = _mm_mul_ps(_mm_loadu_ps(v + k), _mm_loadu_ps(qmf_c + k));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + k + 192),         _mm_loadu_ps(qmf_c + k + 64)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + k + 256),         _mm_loadu_ps(qmf_c + k + 128)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + k + (256 + 192)), _mm_loadu_ps(qmf_c + k + 192)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + k + 512),         _mm_loadu_ps(qmf_c + k + 256)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + k + (512 + 192)), _mm_loadu_ps(qmf_c + k + 320)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + k + 768),         _mm_loadu_ps(qmf_c + k + 384)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + k + (768 + 192)), _mm_loadu_ps(qmf_c + k + 448)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + k + 1024),        _mm_loadu_ps(qmf_c + k + 512)));
+        s = _mm_add_ps(s, _mm_mul_ps(_mm_loadu_ps(v + k + (1024 + 192)), _mm_loadu_ps(qmf_c + k + 576)));
+        _mm_storeu_ps(output + k, s);
+    }
+}
+#endif
+#endif
+
+qmfa_info *qmfa_init(allocator_info *alloc, uint8_t channels)
 {
-    qmfa_info *qmfa = (qmfa_info*)faad_malloc(sizeof(qmfa_info));
+    qmfa_info *qmfa = (qmfa_info*)faad_malloc(alloc, sizeof(qmfa_info));
+
+    if (qmfa == NULL)
+        return NULL;
 
 	/* x is implemented as double ringbuffer */
-    qmfa->x = (real_t*)faad_malloc(2 * channels * 10 * sizeof(real_t));
+    qmfa->x = (real_t*)faad_malloc(alloc, 2 * channels * 10 * sizeof(real_t));
+    if (qmfa->x == NULL)
+    {
+        faad_free(alloc, qmfa);
+        return NULL;
+    }
     memset(qmfa->x, 0, 2 * channels * 10 * sizeof(real_t));
 
 	/* ringbuffer index */
@@ -53,35 +131,38 @@ qmfa_info *qmfa_init(uint8_t channels)
 
     qmfa->channels = channels;
 
+#ifdef USE_SSE
+    qmfa->sse = cpu_has_sse();
+#endif
+
     return qmfa;
 }
 
-void qmfa_end(qmfa_info *qmfa)
+void qmfa_end(allocator_info *alloc, qmfa_info *qmfa)
 {
     if (qmfa)
     {
-        if (qmfa->x) faad_free(qmfa->x);
-        faad_free(qmfa);
+        if (qmfa->x) faad_free(alloc, qmfa->x);
+        faad_free(alloc, qmfa);
     }
 }
 
 void sbr_qmf_analysis_32(sbr_info *sbr, qmfa_info *qmfa, const real_t *input,
-                         qmf_t X[MAX_NTSRHFG][64], uint8_t offset, uint8_t kx)
+                         qmf_row_t X[MAX_NTSRHFG], uint8_t offset, uint8_t kx)
 {
     ALIGN real_t u[64];
-#ifndef SBR_LOW_POWER
-    ALIGN real_t in_real[32], in_imag[32], out_real[32], out_imag[32];
-#else
     ALIGN real_t y[32];
+#ifndef SBR_LOW_POWER
+    /* DCT-IV input of all time slots, transformed in one batch */
+    ALIGN real_t dct_real[MAX_NTSR][32], dct_imag[MAX_NTSR][32];
 #endif
     uint32_t in = 0;
+    int16_t n;
     uint8_t l;
 
     /* qmf subsample l */
     for (l = 0; l < sbr->numTimeSlotsRate; l++)
     {
-        int16_t n;
-
         /* shift input buffer x */
 		/* input buffer is not shifted anymore, x is implemented as double ringbuffer */
         //memmove(qmfa->x + 32, qmfa->x, (320-32)*sizeof(real_t));
@@ -97,6 +178,12 @@ void sbr_qmf_analysis_32(sbr_info *sbr, qmfa_info *qmfa, const real_t *input,
         }
 
         /* window and summation to create array u */
+#ifdef USE_SSE
+        if (qmfa->sse)
+        {
+            qmfa_window_sse(qmfa->x + qmfa->x_index, u);
+        } else
+#endif
         for (n = 0; n < 64; n++)
         {
             u[n] = MUL_F(qmfa->x[qmfa->x_index + n], qmf_c[2*n]) +
@@ -112,7 +199,24 @@ void sbr_qmf_analysis_32(sbr_info *sbr, qmfa_info *qmfa, const real_t *input,
 			qmfa->x_index = (320-32);
 
         /* calculate 32 subband samples by introducing X */
-#ifdef SBR_LOW_POWER
+#ifndef SBR_LOW_POWER
+        if (!sbr->lp)
+        {
+            // Reordering of data moved from DCT_IV to here
+            dct_imag[l][31] = u[1];
+            dct_real[l][0] = u[0];
+            for (n = 1; n < 31; n++)
+            {
+                dct_imag[l][31 - n] = u[n+1];
+                dct_real[l][n] = -u[64-n];
+            }
+            dct_imag[l][0] = u[32];
+            dct_real[l][31] = -u[33];
+            continue;
+        }
+#endif
+
+        /* low power: real valued subband samples */
         y[0] = u[48];
         for (n = 1; n < 16; n++)
             y[n] = u[n+48] + u[48-n];
@@ -126,64 +230,67 @@ void sbr_qmf_analysis_32(sbr_info *sbr, qmfa_info *qmfa, const real_t *input,
             if (n < kx)
             {
 #ifdef FIXED_POINT
-                QMF_RE(X[l + offset][n]) = u[n] /*<< 1*/;
+                QMF_RE_AT(X[l + offset], n) = u[n] /*<< 1*/;
 #else
-                QMF_RE(X[l + offset][n]) = 2. * u[n];
+                QMF_RE_AT(X[l + offset], n) = 2. * u[n];
 #endif
             } else {
-                QMF_RE(X[l + offset][n]) = 0;
+                QMF_RE_AT(X[l + offset], n) = 0;
             }
         }
-#else
+    }
 
-        // Reordering of data moved from DCT_IV to here
-        in_imag[31] = u[1];
-        in_real[0] = u[0];
-        for (n = 1; n < 31; n++)
-        {
-            in_imag[31 - n] = u[n+1];
-            in_real[n] = -u[64-n];
-        }
-        in_imag[0] = u[32];
-        in_real[31] = -u[33];
+#ifndef SBR_LOW_POWER
+    if (sbr->lp)
+        return;
+
+    // dct4_kernel is DCT_IV without reordering which is done before and after FFT
+#ifdef USE_SSE
+    if (qmfa->sse)
+        dct4_kernel_batch_sse(dct_real, dct_imag, sbr->numTimeSlotsRate);
+    else
+#endif
+    dct4_kernel_batch(dct_real, dct_imag, sbr->numTimeSlotsRate);
 
-        // dct4_kernel is DCT_IV without reordering which is done before and after FFT
-        dct4_kernel(in_real, in_imag, out_real, out_imag);
+    for (l = 0; l < sbr->numTimeSlotsRate; l++)
+    {
+        const real_t *out_real = dct_real[l];
+        const real_t *out_imag = dct_imag[l];
 
         // Reordering of data moved from DCT_IV to here
         for (n = 0; n < 16; n++) {
             if (2*n+1 < kx) {
 #ifdef FIXED_POINT
-                QMF_RE(X[l + offset][2*n])   = out_real[n];
-                QMF_IM(X[l + offset][2*n])   = out_imag[n];
-                QMF_RE(X[l + offset][2*n+1]) = -out_imag[31-n];
-                QMF_IM(X[l + offset][2*n+1]) = -out_real[31-n];
+                QMF_RE_AT(X[l + offset], 2*n)   = out_real[n];
+                QMF_IM_AT(X[l + offset], 2*n)   = out_imag[n];
+                QMF_RE_AT(X[l + offset], 2*n+1) = -out_imag[31-n];
+                QMF_IM_AT(X[l + offset], 2*n+1) = -out_real[31-n];
 #else
-                QMF_RE(X[l + offset][2*n])   = 2. * out_real[n];
-                QMF_IM(X[l + offset][2*n])   = 2. * out_imag[n];
-                QMF_RE(X[l + offset][2*n+1]) = -2. * out_imag[31-n];
-                QMF_IM(X[l + offset][2*n+1]) = -2. * out_real[31-n];
+                QMF_RE_AT(X[l + offset], 2*n)   = 2. * out_real[n];
+                QMF_IM_AT(X[l + offset], 2*n)   = 2. * out_imag[n];
+                QMF_RE_AT(X[l + offset], 2*n+1) = -2. * out_imag[31-n];
+                QMF_IM_AT(X[l + offset], 2*n+1) = -2. * out_real[31-n];
 #endif
             } else {
                 if (2*n < kx) {
 #ifdef FIXED_POINT
-                    QMF_RE(X[l + offset][2*n])   = out_real[n];
-                    QMF_IM(X[l + offset][2*n])   = out_imag[n];
+                    QMF_RE_AT(X[l + offset], 2*n)   = out_real[n];
+                    QMF_IM_AT(X[l + offset], 2*n)   = out_imag[n];
 #else
-                    QMF_RE(X[l + offset][2*n])   = 2. * out_real[n];
-                    QMF_IM(X[l + offset][2*n])   = 2. * out_imag[n];
+                    QMF_RE_AT(X[l + offset], 2*n)   = 2. * out_real[n];
+                    QMF_IM_AT(X[l + offset], 2*n)   = 2. * out_imag[n];
 #endif
                 }
                 else {
-                    QMF_RE(X[l + offset][2*n]) = 0;
-                    QMF_IM(X[l + offset][2*n]) = 0;
+                    QMF_RE_AT(X[l + offset], 2*n) = 0;
+                    QMF_IM_AT(X[l + offset], 2*n) = 0;
                 }
-                QMF_RE(X[l + offset][2*n+1]) = 0;
-                QMF_IM(X[l + offset][2*n+1]) = 0;
+                QMF_RE_AT(X[l + offset], 2*n+1) = 0;
+                QMF_IM_AT(X[l + offset], 2*n+1) = 0;
             }
         }
-#endif
     }
+#endif
 }
 
 static const complex_t qmf32_pre_twiddle[] =
@@ -222,34 +329,45 @@ static const complex_t qmf32_pre_twiddle[] =
     { FRAC_CONST(0.715730825283819), FRAC_CONST(-0.698376249408973) }
 };
 
-qmfs_info *qmfs_init(uint8_t channels)
+qmfs_info *qmfs_init(allocator_info *alloc, uint8_t channels)
 {
-    qmfs_info *qmfs = (qmfs_info*)faad_malloc(sizeof(qmfs_info));
+    qmfs_info *qmfs = (qmfs_info*)faad_malloc(alloc, sizeof(qmfs_info));
+
+    if (qmfs == NULL)
+        return NULL;
 
 	/* v is a double ringbuffer */
-    qmfs->v = (real_t*)faad_malloc(2 * channels * 20 * sizeof(real_t));
+    qmfs->v = (real_t*)faad_malloc(alloc, 2 * channels * 20 * sizeof(real_t));
+    if (qmfs->v == NULL)
+    {
+        faad_free(alloc, qmfs);
+        return NULL;
+    }
     memset(qmfs->v, 0, 2 * channels * 20 * sizeof(real_t));
 
     qmfs->v_index = 0;
 
     qmfs->channels = channels;
 
+#ifdef USE_SSE
+    qmfs->sse = cpu_has_sse();
+#endif
+
     return qmfs;
 }
 
-void qmfs_end(qmfs_info *qmfs)
+void qmfs_end(allocator_info *alloc, qmfs_info *qmfs)
 {
     if (qmfs)
     {
-        if (qmfs->v) faad_free(qmfs->v);
-        faad_free(qmfs);
+        if (qmfs->v) faad_free(alloc, qmfs->v);
+        faad_free(alloc, qmfs);
     }
 }
 
-#ifdef SBR_LOW_POWER
-
-void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][64],
-                          real_t *output)
+/* low power synthesis filterbanks, using only the real part of X */
+static void sbr_qmf_synthesis_32_lp(sbr_info *sbr, qmfs_info *qmfs, qmf_row_t X[MAX_NTSRHFG],
+                                    real_t *output)
 {
     ALIGN real_t x[16];
     ALIGN real_t y[16];
@@ -267,11 +385,11 @@ void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
         for (k = 0; k < 16; k++)
         {
 #ifdef FIXED_POINT
-            y[k] = (QMF_RE(X[l][k]) - QMF_RE(X[l][31 - k]));
-            x[k] = (QMF_RE(X[l][k]) + QMF_RE(X[l][31 - k]));
+            y[k] = (QMF_RE_AT(X[l], k) - QMF_RE_AT(X[l], 31 - k));
+            x[k] = (QMF_RE_AT(X[l], k) + QMF_RE_AT(X[l], 31 - k));
 #else
-            y[k] = (QMF_RE(X[l][k]) - QMF_RE(X[l][31 - k])) / 32.0;
-            x[k] = (QMF_RE(X[l][k]) + QMF_RE(X[l][31 - k])) / 32.0;
+            y[k] = (QMF_RE_AT(X[l], k) - QMF_RE_AT(X[l], 31 - k)) / 32.0;
+            x[k] = (QMF_RE_AT(X[l], k) + QMF_RE_AT(X[l], 31 - k)) / 32.0;
 #endif
         }
 
@@ -317,8 +435,8 @@ void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
     }
 }
 
-void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][64],
-                          real_t *output)
+static void sbr_qmf_synthesis_64_lp(sbr_info *sbr, qmfs_info *qmfs, qmf_row_t X[MAX_NTSRHFG],
+                                    real_t *output)
 {
     ALIGN real_t x[64];
     ALIGN real_t y[64];
@@ -337,11 +455,11 @@ void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
         for (k = 0; k < 32; k++)
         {
 #ifdef FIXED_POINT
-            y[k] = (QMF_RE(X[l][k]) - QMF_RE(X[l][63 - k]));
-            x[k] = (QMF_RE(X[l][k]) + QMF_RE(X[l][63 - k]));
+            y[k] = (QMF_RE_AT(X[l], k) - QMF_RE_AT(X[l], 63 - k));
+            x[k] = (QMF_RE_AT(X[l], k) + QMF_RE_AT(X[l], 63 - k));
 #else
-            y[k] = (QMF_RE(X[l][k]) - QMF_RE(X[l][63 - k])) / 32.0;
-            x[k] = (QMF_RE(X[l][k]) + QMF_RE(X[l][63 - k])) / 32.0;
+            y[k] = (QMF_RE_AT(X[l], k) - QMF_RE_AT(X[l], 63 - k)) / 32.0;
+            x[k] = (QMF_RE_AT(X[l], k) + QMF_RE_AT(X[l], 63 - k)) / 32.0;
 #endif
         }
 
@@ -386,8 +504,21 @@ void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
             qmfs->v_index = (1280-128);
     }
 }
+
+#ifdef SBR_LOW_POWER
+void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_row_t X[MAX_NTSRHFG],
+                          real_t *output)
+{
+    sbr_qmf_synthesis_32_lp(sbr, qmfs, X, output);
+}
+
+void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_row_t X[MAX_NTSRHFG],
+                          real_t *output)
+{
+    sbr_qmf_synthesis_64_lp(sbr, qmfs, X, output);
+}
 #else
-void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][64],
+void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_row_t X[MAX_NTSRHFG],
                           real_t *output)
 {
     ALIGN real_t x1[32], x2[32];
@@ -397,6 +528,12 @@ void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
     int32_t n, k, out = 0;
     uint8_t l;
 
+    if (sbr->lp)
+    {
+        sbr_qmf_synthesis_32_lp(sbr, qmfs, X, output);
+        return;
+    }
+
 
     /* qmf subsample l */
     for (l = 0; l < sbr->numTimeSlotsRate; l++)
@@ -409,8 +546,8 @@ void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
         /* complex pre-twiddle */
         for (k = 0; k < 32; k++)
         {
-            x1[k] = MUL_F(QMF_RE(X[l][k]), RE(qmf32_pre_twiddle[k])) - MUL_F(QMF_IM(X[l][k]), IM(qmf32_pre_twiddle[k]));
-            x2[k] = MUL_F(QMF_IM(X[l][k]), RE(qmf32_pre_twiddle[k])) + MUL_F(QMF_RE(X[l][k]), IM(qmf32_pre_twiddle[k]));
+            x1[k] = MUL_F(QMF_RE_AT(X[l], k), RE(qmf32_pre_twiddle[k])) - MUL_F(QMF_IM_AT(X[l], k), IM(qmf32_pre_twiddle[k]));
+            x2[k] = MUL_F(QMF_IM_AT(X[l], k), RE(qmf32_pre_twiddle[k])) + MUL_F(QMF_RE_AT(X[l], k), IM(qmf32_pre_twiddle[k]));
 
 #ifndef FIXED_POINT
             x1[k] *= scale;
@@ -432,6 +569,13 @@ void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
         }
 
         /* calculate 32 output samples and window */
+#ifdef USE_SSE
+        if (qmfs->sse)
+        {
+            qmfs32_window_sse(qmfs->v + qmfs->v_index, output + out);
+            out += 32;
+        } else
+#endif
         for (k = 0; k < 32; k++)
         {
             output[out++] = MUL_F(qmfs->v[qmfs->v_index + k], qmf_c[2*k]) +
@@ -453,15 +597,17 @@ void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
     }
 }
 
-void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][64],
+void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_row_t X[MAX_NTSRHFG],
                           real_t *output)
 {
 //    ALIGN real_t x1[64], x2[64];
 #ifndef SBR_LOW_POWER
-    ALIGN real_t in_real1[32], in_imag1[32], out_real1[32], out_imag1[32];
-    ALIGN real_t in_real2[32], in_imag2[32], out_real2[32], out_imag2[32];
+    /* DCT-IV input of all time slots, two per slot, transformed in one batch */
+    ALIGN real_t dct_real[2*MAX_NTSR][32], dct_imag[2*MAX_NTSR][32];
+    real_t *in_real1, *in_imag1, *in_real2, *in_imag2;
+    const real_t *out_real1, *out_imag1, *out_real2, *out_imag2;
 #endif
-    qmf_t * pX;
+    qmf_row_t * pX;
     real_t * pring_buffer_1, * pring_buffer_3;
 //    real_t * ptemp_1, * ptemp_2;
 #ifdef PREFER_POINTERS
@@ -480,6 +626,11 @@ void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
     int32_t n, k, out = 0;
     uint8_t l;
 
+    if (sbr->lp)
+    {
+        sbr_qmf_synthesis_64_lp(sbr, qmfs, X, output);
+        return;
+    }
 
     /* qmf subsample l */
     for (l = 0; l < sbr->numTimeSlotsRate; l++)
@@ -489,53 +640,68 @@ void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
 		//memmove(qmfs->v + 128, qmfs->v, (1280-128)*sizeof(real_t));
 
         /* calculate 128 samples */
+        in_real1 = dct_real[2*l];
+        in_imag1 = dct_imag[2*l];
+        in_real2 = dct_real[2*l+1];
+        in_imag2 = dct_imag[2*l+1];
+
 #ifndef FIXED_POINT
 
-        pX = X[l];
+        pX = &X[l];
 
-        in_imag1[31] = scale*QMF_RE(pX[1]);
-        in_real1[0]  = scale*QMF_RE(pX[0]);
-        in_imag2[31] = scale*QMF_IM(pX[63-1]);
-        in_real2[0]  = scale*QMF_IM(pX[63-0]);
+        in_imag1[31] = scale*QMF_RE_AT(*pX, 1);
+        in_real1[0]  = scale*QMF_RE_AT(*pX, 0);
+        in_imag2[31] = scale*QMF_IM_AT(*pX, 63-1);
+        in_real2[0]  = scale*QMF_IM_AT(*pX, 63-0);
         for (k = 1; k < 31; k++)
         {
-            in_imag1[31 - k] = scale*QMF_RE(pX[2*k + 1]);
-            in_real1[     k] = scale*QMF_RE(pX[2*k    ]);
-            in_imag2[31 - k] = scale*QMF_IM(pX[63 - (2*k + 1)]);
-            in_real2[     k] = scale*QMF_IM(pX[63 - (2*k    )]);
+            in_imag1[31 - k] = scale*QMF_RE_AT(*pX, 2*k + 1);
+            in_real1[     k] = scale*QMF_RE_AT(*pX, 2*k);
+            in_imag2[31 - k] = scale*QMF_IM_AT(*pX, 63 - (2*k + 1));
+            in_real2[     k] = scale*QMF_IM_AT(*pX, 63 - (2*k    ));
         }
-        in_imag1[0]  = scale*QMF_RE(pX[63]);
-        in_real1[31] = scale*QMF_RE(pX[62]);
-        in_imag2[0]  = scale*QMF_IM(pX[63-63]);
-        in_real2[31] = scale*QMF_IM(pX[63-62]);
+        in_imag1[0]  = scale*QMF_RE_AT(*pX, 63);
+        in_real1[31] = scale*QMF_RE_AT(*pX, 62);
+        in_imag2[0]  = scale*QMF_IM_AT(*pX, 63-63);
+        in_real2[31] = scale*QMF_IM_AT(*pX, 63-62);
 
 #else
 
-        pX = X[l];
+        pX = &X[l];
 
-        in_imag1[31] = QMF_RE(pX[1]) >> 1;
-        in_real1[0]  = QMF_RE(pX[0]) >> 1;
-        in_imag2[31] = QMF_IM(pX[62]) >> 1;
-        in_real2[0]  = QMF_IM(pX[63]) >> 1;
+        in_imag1[31] = QMF_RE_AT(*pX, 1) >> 1;
+        in_real1[0]  = QMF_RE_AT(*pX, 0) >> 1;
+        in_imag2[31] = QMF_IM_AT(*pX, 62) >> 1;
+        in_real2[0]  = QMF_IM_AT(*pX, 63) >> 1;
         for (k = 1; k < 31; k++)
         {
-            in_imag1[31 - k] = QMF_RE(pX[2*k + 1]) >> 1;
-            in_real1[     k] = QMF_RE(pX[2*k    ]) >> 1;
-            in_imag2[31 - k] = QMF_IM(pX[63 - (2*k + 1)]) >> 1;
-            in_real2[     k] = QMF_IM(pX[63 - (2*k    )]) >> 1;
+            in_imag1[31 - k] = QMF_RE_AT(*pX, 2*k + 1) >> 1;
+            in_real1[     k] = QMF_RE_AT(*pX, 2*k) >> 1;
+            in_imag2[31 - k] = QMF_IM_AT(*pX, 63 - (2*k + 1)) >> 1;
+            in_real2[     k] = QMF_IM_AT(*pX, 63 - (2*k    )) >> 1;
         }
-        in_imag1[0]  = QMF_RE(pX[63]) >> 1;
-        in_real1[31] = QMF_RE(pX[62]) >> 1;
-        in_imag2[0]  = QMF_IM(pX[0]) >> 1;
-        in_real2[31] = QMF_IM(pX[1]) >> 1;
+        in_imag1[0]  = QMF_RE_AT(*pX, 63) >> 1;
+        in_real1[31] = QMF_RE_AT(*pX, 62) >> 1;
+        in_imag2[0]  = QMF_IM_AT(*pX, 0) >> 1;
+        in_real2[31] = QMF_IM_AT(*pX, 1) >> 1;
 
 #endif
+    }
 
+    // dct4_kernel is DCT_IV without reordering which is done before and after FFT
+#ifdef USE_SSE
+    if (qmfs->sse)
+        dct4_kernel_batch_sse(dct_real, dct_imag, 2*sbr->numTimeSlotsRate);
+    else
+#endif
+    dct4_kernel_batch(dct_real, dct_imag, 2*sbr->numTimeSlotsRate);
 
-        // dct4_kernel is DCT_IV without reordering which is done before and after FFT
-        dct4_kernel(in_real1, in_imag1, out_real1, out_imag1);
-        dct4_kernel(in_real2, in_imag2, out_real2, out_imag2);
-
+    for (l = 0; l < sbr->numTimeSlotsRate; l++)
+    {
+        out_real1 = dct_real[2*l];
+        out_imag1 = dct_imag[2*l];
+        out_real2 = dct_real[2*l+1];
+        out_imag2 = dct_imag[2*l+1];
 
         pring_buffer_1 = qmfs->v + qmfs->v_index;
         pring_buffer_3 = pring_buffer_1 + 1280;
@@ -595,6 +761,13 @@ void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][6
 #endif // #ifdef PREFER_POINTERS
 
         /* calculate 64 output samples and window */
+#ifdef USE_SSE
+        if (qmfs->sse)
+        {
+            qmfs64_window_sse(pring_buffer_1, output + out);
+            out += 64;
+        } else
+#endif
         for (k = 0; k < 64; k++)
         {
 #ifdef PREFER_POINTERS
@@ -35,16 +35,16 @@
 extern "C" {
 #endif
 
-qmfa_info *qmfa_init(uint8_t channels);
-void qmfa_end(qmfa_info *qmfa);
-qmfs_info *qmfs_init(uint8_t channels);
-void qmfs_end(qmfs_info *qmfs);
+qmfa_info *qmfa_init(allocator_info *alloc, uint8_t channels);
+void qmfa_end(allocator_info *alloc, qmfa_info *qmfa);
+qmfs_info *qmfs_init(allocator_info *alloc, uint8_t channels);
+void qmfs_end(allocator_info *alloc, qmfs_info *qmfs);
 
 void sbr_qmf_analysis_32(sbr_info *sbr, qmfa_info *qmfa, const real_t *input,
-                         qmf_t X[MAX_NTSRHFG][64], uint8_t offset, uint8_t kx);
-void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][64],
+                         qmf_row_t X[MAX_NTSRHFG], uint8_t offset, uint8_t kx);
+void sbr_qmf_synthesis_32(sbr_info *sbr, qmfs_info *qmfs, qmf_row_t X[MAX_NTSRHFG],
                           real_t *output);
-void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_t X[MAX_NTSRHFG][64],
+void sbr_qmf_synthesis_64(sbr_info *sbr, qmfs_info *qmfs, qmf_row_t X[MAX_NTSRHFG],
                           real_t *output);
 
 
@@ -864,7 +864,11 @@ static uint16_t sbr_extension(bitfile *ld, sbr_info *sbr,
     case EXTENSION_ID_PS:
         if (!sbr->ps)
         {
-            sbr->ps = ps_init(get_sr_index(sbr->sample_rate), sbr->numTimeSlotsRate);
+            sbr->ps = ps_init(sbr->alloc, get_sr_index(sbr->sample_rate), sbr->numTimeSlotsRate,
+                sbr->fast_math);
+            /* no memory for PS, the extension is skipped */
+            if (!sbr->ps)
+                return 0;
         }
         if (sbr->psResetFlag)
         {
@@ -887,15 +891,18 @@ static uint16_t sbr_extension(bitfile *ld, sbr_info *sbr,
 #endif
 #ifdef DRM_PS
     case DRM_PARAMETRIC_STEREO:
+        if (!sbr->drm_ps)
+        {
+            sbr->drm_ps = drm_ps_init(sbr->alloc);
+            /* no memory for PS, the extension is skipped */
+            if (!sbr->drm_ps)
+                return 0;
+        }
         /* If not expected then only decode but do not expose. */
         if (sbr->Is_DRM_SBR)
         {
             sbr->ps_used = 1;
         }
-        if (!sbr->drm_ps)
-        {
-            sbr->drm_ps = drm_ps_init();
-        }
         return drm_ps_data(sbr->drm_ps, ld);
 #endif
     default:
@@ -55,6 +55,10 @@
 #include "ssr_fb.h"
 #endif
 
+#ifdef USE_SSE
+#include <xmmintrin.h>
+#endif
+
 
 /* static function declarations */
 static uint8_t quant_to_spec(NeAACDecStruct *hDecoder,
@@ -527,6 +531,47 @@ ALIGN static const real_t pow2sf_tab[] = {
 };
 #endif
 
+#ifdef USE_SSE
+/* iquant() * scf for one window of a scalefactor band, four values at a
+ * time; the sign is applied as a bit mask instead of with a branch */
+static SSE_TARGET void iquant_band_sse(const int16_t *quant_data, real_t *spec_data,
+                                       uint16_t width, real_t scf, const real_t *tab,
+                                       uint8_t *error)
+{
+    const __m128 mscf = _mm_set1_ps(scf);
+    uint16_t bin;
+    uint8_t i;
+
+    for (bin = 0; bin < width; bin += 4)
+    {
+        union { uint32_t u[4]; float f[4]; } sign;
+        int aq[4];
+        __m128 x;
+
+        for (i = 0; i < 4; i++)
+        {
+            int q = quant_data[bin+i];
+
+            aq[i] = (q < 0) ? -q : q;
+            sign.u[i] = (uint32_t)(q < 0) << 31;
+        }
+
+        /* escape values outside the table, let iquant() flag the error */
+        if (aq[0] >= IQ_TABLE_SIZE || aq[1] >= IQ_TABLE_SIZE ||
+            aq[2] >= IQ_TABLE_SIZE || aq[3] >= IQ_TABLE_SIZE)
+        {
+            for (i = 0; i < 4; i++)
+                spec_data[bin+i] = iquant(quant_data[bin+i], tab, error) * scf;
+            continue;
+        }
+
+        x = _mm_set_ps(tab[aq[3]], tab[aq[2]], tab[aq[1]], tab[aq[0]]);
+        x = _mm_xor_ps(_mm_mul_ps(x, mscf), _mm_loadu_ps(sign.f));
+        _mm_storeu_ps(&spec_data[bin], x);
+    }
+}
+#endif
+
 /* quant_to_spec: perform dequantisation and scaling
  * and in case of short block it also does the deinterleaving
  */
@@ -633,6 +678,16 @@ static uint8_t quant_to_spec(NeAACDecStruct *hDecoder,
 
             for (win = 0; win < ics->window_group_length[g]; win++)
             {
+#ifdef USE_SSE
+                if (hDecoder->sse)
+                {
+                    iquant_band_sse(&quant_data[k], &spec_data[wa], width, scf, tab, &error);
+                    gincrease += width;
+                    k += width;
+                    wa += win_inc;
+                    continue;
+                }
+#endif
                 for (bin = 0; bin < width; bin += 4)
                 {
                     uint16_t wb = wa + bin;
@@ -698,6 +753,22 @@ static uint8_t quant_to_spec(NeAACDecStruct *hDecoder,
     return error;
 }
 
+/* Returns a buffer of size bytes for a channel, replacing buf.
+ * Preallocated channels already have buffers of the worst case size, so
+ * these are handed back as they are.
+ */
+static void *channel_buffer(NeAACDecStruct *hDecoder, void *buf, uint8_t channel,
+                            size_t size)
+{
+    if ((buf != NULL) && (channel < hDecoder->prealloc_channels))
+        return buf;
+
+    if (buf != NULL)
+        faad_free(&hDecoder->alloc, buf);
+
+    return faad_malloc(&hDecoder->alloc, size);
+}
+
 static uint8_t allocate_single_channel(NeAACDecStruct *hDecoder, uint8_t channel,
                                        uint8_t output_channels)
 {
@@ -708,13 +779,10 @@ static uint8_t allocate_single_channel(NeAACDecStruct *hDecoder, uint8_t channel
     if (hDecoder->object_type == MAIN)
     {
         /* allocate the state only when needed */
-        if (hDecoder->pred_stat[channel] != NULL)
-        {
-            faad_free(hDecoder->pred_stat[channel]);
-            hDecoder->pred_stat[channel] = NULL;
-        }
-
-        hDecoder->pred_stat[channel] = (pred_state*)faad_malloc(hDecoder->frameLength * sizeof(pred_state));
+        hDecoder->pred_stat[channel] = (pred_state*)channel_buffer(hDecoder, hDecoder->pred_stat[channel],
+            channel, hDecoder->frameLength * sizeof(pred_state));
+        if (hDecoder->pred_stat[channel] == NULL)
+            return 39;
         reset_all_predictors(hDecoder->pred_stat[channel], hDecoder->frameLength);
     }
 #endif
@@ -723,23 +791,14 @@ static uint8_t allocate_single_channel(NeAACDecStruct *hDecoder, uint8_t channel
     if (is_ltp_ot(hDecoder->object_type))
     {
         /* allocate the state only when needed */
-        if (hDecoder->lt_pred_stat[channel] != NULL)
-        {
-            faad_free(hDecoder->lt_pred_stat[channel]);
-            hDecoder->lt_pred_stat[channel] = NULL;
-        }
-
-        hDecoder->lt_pred_stat[channel] = (int16_t*)faad_malloc(hDecoder->frameLength*4 * sizeof(int16_t));
+        hDecoder->lt_pred_stat[channel] = (int16_t*)channel_buffer(hDecoder, hDecoder->lt_pred_stat[channel],
+            channel, hDecoder->frameLength*4 * sizeof(int16_t));
+        if (hDecoder->lt_pred_stat[channel] == NULL)
+            return 39;
         memset(hDecoder->lt_pred_stat[channel], 0, hDecoder->frameLength*4 * sizeof(int16_t));
     }
 #endif
 
-    if (hDecoder->time_out[channel] != NULL)
-    {
-        faad_free(hDecoder->time_out[channel]);
-        hDecoder->time_out[channel] = NULL;
-    }
-
     {
         mul = 1;
 #ifdef SBR_DEC
@@ -751,31 +810,28 @@ static uint8_t allocate_single_channel(NeAACDecStruct *hDecoder, uint8_t channel
             hDecoder->sbr_alloced[hDecoder->fr_ch_ele] = 1;
         }
 #endif
-        hDecoder->time_out[channel] = (real_t*)faad_malloc(mul*hDecoder->frameLength*sizeof(real_t));
+        hDecoder->time_out[channel] = (real_t*)channel_buffer(hDecoder, hDecoder->time_out[channel],
+            channel, mul*hDecoder->frameLength*sizeof(real_t));
+        if (hDecoder->time_out[channel] == NULL)
+            return 39;
         memset(hDecoder->time_out[channel], 0, mul*hDecoder->frameLength*sizeof(real_t));
     }
 
 #if (defined(PS_DEC) || defined(DRM_PS))
     if (output_channels == 2)
     {
-        if (hDecoder->time_out[channel+1] != NULL)
-        {
-            faad_free(hDecoder->time_out[channel+1]);
-            hDecoder->time_out[channel+1] = NULL;
-        }
-
-        hDecoder->time_out[channel+1] = (real_t*)faad_malloc(mul*hDecoder->frameLength*sizeof(real_t));
+        hDecoder->time_out[channel+1] = (real_t*)channel_buffer(hDecoder, hDecoder->time_out[channel+1],
+            channel+1, mul*hDecoder->frameLength*sizeof(real_t));
+        if (hDecoder->time_out[channel+1] == NULL)
+            return 39;
         memset(hDecoder->time_out[channel+1], 0, mul*hDecoder->frameLength*sizeof(real_t));
     }
 #endif
 
-    if (hDecoder->fb_intermed[channel] != NULL)
-    {
-        faad_free(hDecoder->fb_intermed[channel]);
-        hDecoder->fb_intermed[channel] = NULL;
-    }
-
-    hDecoder->fb_intermed[channel] = (real_t*)faad_malloc(hDecoder->frameLength*sizeof(real_t));
+    hDecoder->fb_intermed[channel] = (real_t*)channel_buffer(hDecoder, hDecoder->fb_intermed[channel],
+        channel, hDecoder->frameLength*sizeof(real_t));
+    if (hDecoder->fb_intermed[channel] == NULL)
+        return 39;
     memset(hDecoder->fb_intermed[channel], 0, hDecoder->frameLength*sizeof(real_t));
 
 #ifdef SSR_DEC
@@ -783,13 +839,13 @@ static uint8_t allocate_single_channel(NeAACDecStruct *hDecoder, uint8_t channel
     {
         if (hDecoder->ssr_overlap[channel] == NULL)
         {
-            hDecoder->ssr_overlap[channel] = (real_t*)faad_malloc(2*hDecoder->frameLength*sizeof(real_t));
+            hDecoder->ssr_overlap[channel] = (real_t*)faad_malloc(&hDecoder->alloc, 2*hDecoder->frameLength*sizeof(real_t));
             memset(hDecoder->ssr_overlap[channel], 0, 2*hDecoder->frameLength*sizeof(real_t));
         }
         if (hDecoder->prev_fmd[channel] == NULL)
         {
             uint16_t k;
-            hDecoder->prev_fmd[channel] = (real_t*)faad_malloc(2*hDecoder->frameLength*sizeof(real_t));
+            hDecoder->prev_fmd[channel] = (real_t*)faad_malloc(&hDecoder->alloc, 2*hDecoder->frameLength*sizeof(real_t));
             for (k = 0; k < 2*hDecoder->frameLength; k++)
                 hDecoder->prev_fmd[channel][k] = REAL_CONST(-1);
         }
@@ -811,12 +867,16 @@ static uint8_t allocate_channel_pair(NeAACDecStruct *hDecoder,
         /* allocate the state only when needed */
         if (hDecoder->pred_stat[channel] == NULL)
         {
-            hDecoder->pred_stat[channel] = (pred_state*)faad_malloc(hDecoder->frameLength * sizeof(pred_state));
+            hDecoder->pred_stat[channel] = (pred_state*)faad_malloc(&hDecoder->alloc, hDecoder->frameLength * sizeof(pred_state));
+            if (hDecoder->pred_stat[channel] == NULL)
+                return 39;
             reset_all_predictors(hDecoder->pred_stat[channel], hDecoder->frameLength);
         }
         if (hDecoder->pred_stat[paired_channel] == NULL)
         {
-            hDecoder->pred_stat[paired_channel] = (pred_state*)faad_malloc(hDecoder->frameLength * sizeof(pred_state));
+            hDecoder->pred_stat[paired_channel] = (pred_state*)faad_malloc(&hDecoder->alloc, hDecoder->frameLength * sizeof(pred_state));
+            if (hDecoder->pred_stat[paired_channel] == NULL)
+                return 39;
             reset_all_predictors(hDecoder->pred_stat[paired_channel], hDecoder->frameLength);
         }
     }
@@ -828,12 +888,16 @@ static uint8_t allocate_channel_pair(NeAACDecStruct *hDecoder,
         /* allocate the state only when needed */
         if (hDecoder->lt_pred_stat[channel] == NULL)
         {
-            hDecoder->lt_pred_stat[channel] = (int16_t*)faad_malloc(hDecoder->frameLength*4 * sizeof(int16_t));
+            hDecoder->lt_pred_stat[channel] = (int16_t*)faad_malloc(&hDecoder->alloc, hDecoder->frameLength*4 * sizeof(int16_t));
+            if (hDecoder->lt_pred_stat[channel] == NULL)
+                return 39;
             memset(hDecoder->lt_pred_stat[channel], 0, hDecoder->frameLength*4 * sizeof(int16_t));
         }
         if (hDecoder->lt_pred_stat[paired_channel] == NULL)
         {
-            hDecoder->lt_pred_stat[paired_channel] = (int16_t*)faad_malloc(hDecoder->frameLength*4 * sizeof(int16_t));
+            hDecoder->lt_pred_stat[paired_channel] = (int16_t*)faad_malloc(&hDecoder->alloc, hDecoder->frameLength*4 * sizeof(int16_t));
+            if (hDecoder->lt_pred_stat[paired_channel] == NULL)
+                return 39;
             memset(hDecoder->lt_pred_stat[paired_channel], 0, hDecoder->frameLength*4 * sizeof(int16_t));
         }
     }
@@ -851,34 +915,26 @@ static uint8_t allocate_channel_pair(NeAACDecStruct *hDecoder,
         }
 #endif
     }
-    if (hDecoder->time_out[channel] != NULL)
-    {
-        faad_free(hDecoder->time_out[channel]);
-        hDecoder->time_out[channel] = NULL;
-    }
-    if (hDecoder->time_out[paired_channel] != NULL)
-    {
-        faad_free(hDecoder->time_out[paired_channel]);
-        hDecoder->time_out[paired_channel] = NULL;
-    }
-    hDecoder->time_out[channel] = (real_t*)faad_malloc(mul*hDecoder->frameLength*sizeof(real_t));
+    hDecoder->time_out[channel] = (real_t*)channel_buffer(hDecoder, hDecoder->time_out[channel],
+        channel, mul*hDecoder->frameLength*sizeof(real_t));
+    if (hDecoder->time_out[channel] == NULL)
+        return 39;
     memset(hDecoder->time_out[channel], 0, mul*hDecoder->frameLength*sizeof(real_t));
-    hDecoder->time_out[paired_channel] = (real_t*)faad_malloc(mul*hDecoder->frameLength*sizeof(real_t));
+    hDecoder->time_out[paired_channel] = (real_t*)channel_buffer(hDecoder, hDecoder->time_out[paired_channel],
+        paired_channel, mul*hDecoder->frameLength*sizeof(real_t));
+    if (hDecoder->time_out[paired_channel] == NULL)
+        return 39;
     memset(hDecoder->time_out[paired_channel], 0, mul*hDecoder->frameLength*sizeof(real_t));
 
-    if (hDecoder->fb_intermed[channel] != NULL)
-    {
-        faad_free(hDecoder->fb_intermed[channel]);
-        hDecoder->fb_intermed[channel] = NULL;
-    }
-    if (hDecoder->fb_intermed[paired_channel] != NULL)
-    {
-        faad_free(hDecoder->fb_intermed[paired_channel]);
-        hDecoder->fb_intermed[paired_channel] = NULL;
-    }
-    hDecoder->fb_intermed[channel] = (real_t*)faad_malloc(hDecoder->frameLength*sizeof(real_t));
+    hDecoder->fb_intermed[channel] = (real_t*)channel_buffer(hDecoder, hDecoder->fb_intermed[channel],
+        channel, hDecoder->frameLength*sizeof(real_t));
+    if (hDecoder->fb_intermed[channel] == NULL)
+        return 39;
     memset(hDecoder->fb_intermed[channel], 0, hDecoder->frameLength*sizeof(real_t));
-    hDecoder->fb_intermed[paired_channel] = (real_t*)faad_malloc(hDecoder->frameLength*sizeof(real_t));
+    hDecoder->fb_intermed[paired_channel] = (real_t*)channel_buffer(hDecoder, hDecoder->fb_intermed[paired_channel],
+        paired_channel, hDecoder->frameLength*sizeof(real_t));
+    if (hDecoder->fb_intermed[paired_channel] == NULL)
+        return 39;
     memset(hDecoder->fb_intermed[paired_channel], 0, hDecoder->frameLength*sizeof(real_t));
 
 #ifdef SSR_DEC
@@ -886,25 +942,25 @@ static uint8_t allocate_channel_pair(NeAACDecStruct *hDecoder,
     {
         if (hDecoder->ssr_overlap[cpe->channel] == NULL)
         {
-            hDecoder->ssr_overlap[cpe->channel] = (real_t*)faad_malloc(2*hDecoder->frameLength*sizeof(real_t));
+            hDecoder->ssr_overlap[cpe->channel] = (real_t*)faad_malloc(&hDecoder->alloc, 2*hDecoder->frameLength*sizeof(real_t));
             memset(hDecoder->ssr_overlap[cpe->channel], 0, 2*hDecoder->frameLength*sizeof(real_t));
         }
         if (hDecoder->ssr_overlap[cpe->paired_channel] == NULL)
         {
-            hDecoder->ssr_overlap[cpe->paired_channel] = (real_t*)faad_malloc(2*hDecoder->frameLength*sizeof(real_t));
+            hDecoder->ssr_overlap[cpe->paired_channel] = (real_t*)faad_malloc(&hDecoder->alloc, 2*hDecoder->frameLength*sizeof(real_t));
             memset(hDecoder->ssr_overlap[cpe->paired_channel], 0, 2*hDecoder->frameLength*sizeof(real_t));
         }
         if (hDecoder->prev_fmd[cpe->channel] == NULL)
         {
             uint16_t k;
-            hDecoder->prev_fmd[cpe->channel] = (real_t*)faad_malloc(2*hDecoder->frameLength*sizeof(real_t));
+            hDecoder->prev_fmd[cpe->channel] = (real_t*)faad_malloc(&hDecoder->alloc, 2*hDecoder->frameLength*sizeof(real_t));
             for (k = 0; k < 2*hDecoder->frameLength; k++)
                 hDecoder->prev_fmd[cpe->channel][k] = REAL_CONST(-1);
         }
         if (hDecoder->prev_fmd[cpe->paired_channel] == NULL)
         {
             uint16_t k;
-            hDecoder->prev_fmd[cpe->paired_channel] = (real_t*)faad_malloc(2*hDecoder->frameLength*sizeof(real_t));
+            hDecoder->prev_fmd[cpe->paired_channel] = (real_t*)faad_malloc(&hDecoder->alloc, 2*hDecoder->frameLength*sizeof(real_t));
             for (k = 0; k < 2*hDecoder->frameLength; k++)
                 hDecoder->prev_fmd[cpe->paired_channel][k] = REAL_CONST(-1);
         }
@@ -914,6 +970,345 @@ static uint8_t allocate_channel_pair(NeAACDecStruct *hDecoder,
     return 0;
 }
 
+/* Allocates up front the state of all channels and elements that the
+ * channel configuration (or the PCE when it is 0) can need, with the
+ * worst case sizes: SBR upsampling and PS on a single SCE. After this the
+ * decoding of a stream that sticks to its configuration does not allocate.
+ */
+uint8_t preallocate_elements(NeAACDecStruct *hDecoder, uint8_t channel_config)
+{
+    static const uint8_t config_elements[8][5] = {
+        { 0 },
+        { ID_SCE },
+        { ID_CPE },
+        { ID_SCE, ID_CPE },
+        { ID_SCE, ID_CPE, ID_SCE },
+        { ID_SCE, ID_CPE, ID_CPE },
+        { ID_SCE, ID_CPE, ID_CPE, ID_LFE },
+        { ID_SCE, ID_CPE, ID_CPE, ID_CPE, ID_LFE }
+    };
+    static const uint8_t config_num_elements[8] = { 0, 1, 1, 2, 3, 3, 4, 5 };
+    uint8_t id[MAX_SYNTAX_ELEMENTS];
+    uint8_t num_ele = 0;
+    uint8_t channels = 0;
+    uint8_t ele, ch, i;
+
+    if (channel_config > 7)
+        return 0;
+
+    if (channel_config != 0)
+    {
+        num_ele = config_num_elements[channel_config];
+        memcpy(id, config_elements[channel_config], num_ele);
+    } else if (hDecoder->pce_set) {
+        /* elements are assumed to come in PCE order */
+        program_config *pce = &hDecoder->pce;
+
+        for (i = 0; i < pce->num_front_channel_elements && num_ele < MAX_SYNTAX_ELEMENTS; i++)
+            id[num_ele++] = pce->front_element_is_cpe[i] ? ID_CPE : ID_SCE;
+        for (i = 0; i < pce->num_side_channel_elements && num_ele < MAX_SYNTAX_ELEMENTS; i++)
+            id[num_ele++] = pce->side_element_is_cpe[i] ? ID_CPE : ID_SCE;
+        for (i = 0; i < pce->num_back_channel_elements && num_ele < MAX_SYNTAX_ELEMENTS; i++)
+            id[num_ele++] = pce->back_element_is_cpe[i] ? ID_CPE : ID_SCE;
+        for (i = 0; i < pce->num_lfe_channel_elements && num_ele < MAX_SYNTAX_ELEMENTS; i++)
+            id[num_ele++] = ID_LFE;
+    }
+
+    for (ele = 0; ele < num_ele; ele++)
+        channels += (id[ele] == ID_CPE) ? 2 : 1;
+#if (defined(PS_DEC) || defined(DRM_PS))
+    /* PS can turn a lone SCE into 2 channels */
+    if (num_ele == 1 && id[0] == ID_SCE)
+        channels = 2;
+#endif
+    if (channels > MAX_CHANNELS)
+        channels = MAX_CHANNELS;
+
+    for (ch = 0; ch < channels; ch++)
+    {
+#ifdef MAIN_DEC
+        if (hDecoder->object_type == MAIN && hDecoder->pred_stat[ch] == NULL)
+        {
+            hDecoder->pred_stat[ch] = (pred_state*)faad_malloc(&hDecoder->alloc, hDecoder->frameLength * sizeof(pred_state));
+            if (hDecoder->pred_stat[ch] == NULL)
+                return 1;
+            reset_all_predictors(hDecoder->pred_stat[ch], hDecoder->frameLength);
+        }
+#endif
+#ifdef LTP_DEC
+        if (is_ltp_ot(hDecoder->object_type) && hDecoder->lt_pred_stat[ch] == NULL)
+        {
+            hDecoder->lt_pred_stat[ch] = (int16_t*)faad_malloc(&hDecoder->alloc, hDecoder->frameLength*4 * sizeof(int16_t));
+            if (hDecoder->lt_pred_stat[ch] == NULL)
+                return 1;
+            memset(hDecoder->lt_pred_stat[ch], 0, hDecoder->frameLength*4 * sizeof(int16_t));
+        }
+#endif
+        if (hDecoder->time_out[ch] == NULL)
+        {
+            /* room for SBR output */
+            hDecoder->time_out[ch] = (real_t*)faad_malloc(&hDecoder->alloc, 2*hDecoder->frameLength*sizeof(real_t));
+            if (hDecoder->time_out[ch] == NULL)
+                return 1;
+        }
+        if (hDecoder->fb_intermed[ch] == NULL)
+        {
+            hDecoder->fb_intermed[ch] = (real_t*)faad_malloc(&hDecoder->alloc, hDecoder->frameLength*sizeof(real_t));
+            if (hDecoder->fb_intermed[ch] == NULL)
+                return 1;
+        }
+        hDecoder->prealloc_channels = ch+1;
+    }
+
+#ifdef SBR_DEC
+    /* SBR data can show up in any stream */
+    for (ele = 0; ele < num_ele; ele++)
+    {
+        if (hDecoder->sbr[ele] == NULL)
+        {
+            hDecoder->sbr[ele] = sbrDecodeInit(&hDecoder->alloc, hDecoder->frameLength,
+                id[ele], 2*get_sample_rate(hDecoder->sf_index),
+                hDecoder->downSampledSBR, hDecoder->config.useLowPowerSBR,
+                hDecoder->config.useFastMathSBR
+#ifdef DRM
+                , 0
+#endif
+                );
+            /* frame lengths without SBR support */
+            if (hDecoder->sbr[ele] == NULL)
+                break;
+        }
+#ifdef PS_DEC
+        if (num_ele == 1 && id[0] == ID_SCE)
+            sbrAllocatePS(hDecoder->sbr[ele], hDecoder->downSampledSBR);
+#endif
+    }
+#endif
+
+    /* the internal output buffer, big enough for any output format */
+    if (hDecoder->sample_buffer == NULL && channels > 0)
+    {
+        hDecoder->sample_buffer_size = 2*hDecoder->frameLength*channels*sizeof(double);
+        hDecoder->sample_buffer = faad_malloc(&hDecoder->alloc, hDecoder->sample_buffer_size);
+        if (hDecoder->sample_buffer == NULL)
+        {
+            hDecoder->sample_buffer_size = 0;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+#ifdef SBR_DEC
+static uint8_t sbr_decode_element(NeAACDecStruct *hDecoder, sbr_job *job)
+{
+    uint8_t retval;
+    sbr_info *sbr = hDecoder->sbr[job->ele];
+
+    if (job->pair)
+    {
+        return sbrDecodeCoupleFrame(sbr, hDecoder->time_out[job->ch0],
+            hDecoder->time_out[job->ch1], hDecoder->postSeekResetFlag,
+            hDecoder->downSampledSBR);
+    }
+
+    /* check if any of the PS tools is used */
+#if (defined(PS_DEC) || defined(DRM_PS))
+    if (hDecoder->ps_used[job->ele])
+    {
+        return sbrDecodeSingleFramePS(sbr, hDecoder->time_out[job->ch0],
+            hDecoder->time_out[job->ch1], hDecoder->postSeekResetFlag,
+            hDecoder->downSampledSBR);
+    }
+#endif
+
+    retval = sbrDecodeSingleFrame(sbr, hDecoder->time_out[job->ch0],
+        hDecoder->postSeekResetFlag, hDecoder->downSampledSBR);
+
+    /* copy L to R when no PS is used */
+#if (defined(PS_DEC) || defined(DRM_PS))
+    if ((retval == 0) && (hDecoder->element_output_channels[job->ele] == 2))
+    {
+        memcpy(hDecoder->time_out[job->ch1], hDecoder->time_out[job->ch0],
+            2*hDecoder->frameLength*sizeof(real_t));
+    }
+#endif
+
+    return retval;
+}
+
+static void sbr_job_run(void *arg, unsigned long i)
+{
+    NeAACDecStruct *hDecoder = (NeAACDecStruct*)arg;
+    sbr_job *job = &hDecoder->sbr_jobs[i];
+
+    job->error = sbr_decode_element(hDecoder, job);
+}
+
+/* SBR of the elements queued by sbr_element, each element has its own
+ * sbr_info and output channels so they run on the worker pool in parallel
+ */
+uint8_t sbr_decode_elements(NeAACDecStruct *hDecoder)
+{
+    uint8_t i;
+    uint8_t count = hDecoder->sbr_job_count;
+
+    hDecoder->sbr_job_count = 0;
+
+    tpool_run(hDecoder->pool, sbr_job_run, hDecoder, count);
+
+    /* report the error of the first failing element */
+    for (i = 0; i < count; i++)
+    {
+        if (hDecoder->sbr_jobs[i].error > 0)
+            return hDecoder->sbr_jobs[i].error;
+    }
+
+    return 0;
+}
+
+/* SBR state of an element, created here when forceUpSampling == 1 */
+static sbr_info *element_sbr(NeAACDecStruct *hDecoder, uint8_t ele)
+{
+    if (hDecoder->sbr[ele] == NULL)
+    {
+        hDecoder->sbr[ele] = sbrDecodeInit(&hDecoder->alloc, hDecoder->frameLength,
+            hDecoder->element_id[ele], 2*get_sample_rate(hDecoder->sf_index),
+            hDecoder->downSampledSBR, hDecoder->config.useLowPowerSBR,
+            hDecoder->config.useFastMathSBR
+#ifdef DRM
+            , 0
+#endif
+            );
+    }
+
+    return hDecoder->sbr[ele];
+}
+
+/* runs the SBR of an element, or queues it when there is a worker pool */
+static uint8_t sbr_element(NeAACDecStruct *hDecoder, uint8_t ele,
+                           uint8_t ch0, uint8_t ch1, uint8_t pair)
+{
+    sbr_job job;
+
+    if (hDecoder->pool != NULL)
+    {
+        sbr_job *queued = &hDecoder->sbr_jobs[hDecoder->sbr_job_count++];
+
+        queued->ele = ele;
+        queued->ch0 = ch0;
+        queued->ch1 = ch1;
+        queued->pair = pair;
+        queued->error = 0;
+        return 0;
+    }
+
+    job.ele = ele;
+    job.ch0 = ch0;
+    job.ch1 = ch1;
+    job.pair = pair;
+
+    return sbr_decode_element(hDecoder, &job);
+}
+#endif
+
+/* true when the caller needs none of the output channels of the element,
+ * the output channel of an element is mapped as in decode_sce_lfe() and
+ * decode_cpe()
+ */
+static uint8_t element_skipped(NeAACDecStruct *hDecoder, element *ele,
+                               uint8_t output_channels)
+{
+    unsigned long skip = hDecoder->config.skipChannels;
+    uint8_t first = ele->channel;
+    uint8_t i;
+
+    if (skip == 0)
+        return 0;
+
+#if (defined(PS_DEC) || defined(DRM_PS))
+    /* a mono stream is output on 2 channels, as long as no second element
+       turned up the first one can be a mono stream */
+    if ((output_channels == 1) && (hDecoder->fr_ch_ele == 0) &&
+        (hDecoder->element_id[1] == INVALID_ELEMENT_ID))
+    {
+        output_channels = 2;
+    }
+#endif
+
+    if (hDecoder->pce_set)
+    {
+        if (ele->paired_channel != -1)
+            first = hDecoder->pce.cpe_channel[ele->element_instance_tag];
+        else if (hDecoder->element_output_channels[hDecoder->fr_ch_ele] == 1)
+            first = hDecoder->pce.sce_channel[ele->element_instance_tag];
+    }
+
+    for (i = 0; i < output_channels; i++)
+    {
+        if ((first + i >= 32) || !(skip & (1UL << (first + i))))
+            return 0;
+    }
+
+    return 1;
+}
+
+/* skipped element: the output is silence and the state the tools carry to
+ * the next frame starts over, as after a seek
+ */
+static uint8_t skip_element(NeAACDecStruct *hDecoder, element *ele,
+                            ic_stream *ics1, ic_stream *ics2,
+                            uint8_t output_channels)
+{
+    uint8_t i;
+    uint8_t ele_no = hDecoder->fr_ch_ele;
+    uint16_t frame_size = hDecoder->frameLength;
+
+#ifdef SBR_DEC
+    if (hDecoder->sbr_alloced[ele_no])
+        frame_size *= 2;
+#endif
+
+    for (i = 0; i < output_channels; i++)
+        memset(hDecoder->time_out[ele->channel+i], 0, frame_size*sizeof(real_t));
+
+    for (i = 0; i < ((ics2 != NULL) ? 2 : 1); i++)
+    {
+        uint8_t ch = ele->channel + i;
+        ic_stream *ics = (i == 0) ? ics1 : ics2;
+
+        memset(hDecoder->fb_intermed[ch], 0, hDecoder->frameLength*sizeof(real_t));
+        hDecoder->window_shape_prev[ch] = ics->window_shape;
+
+#ifdef MAIN_DEC
+        if ((hDecoder->object_type == MAIN) && hDecoder->pred_stat[ch])
+            reset_all_predictors(hDecoder->pred_stat[ch], hDecoder->frameLength);
+#endif
+#ifdef LTP_DEC
+        if (is_ltp_ot(hDecoder->object_type) && hDecoder->lt_pred_stat[ch])
+            memset(hDecoder->lt_pred_stat[ch], 0, hDecoder->frameLength*4 * sizeof(int16_t));
+#endif
+    }
+
+#ifdef SBR_DEC
+    if ((hDecoder->sbr_present_flag == 1) || (hDecoder->forceUpSampling == 1))
+    {
+        if (!hDecoder->sbr_alloced[ele_no])
+            return 23;
+        if (element_sbr(hDecoder, ele_no) == NULL)
+            return 19;
+
+        /* the SBR data is delta coded from frame to frame */
+        return sbrSkipFrame(hDecoder->sbr[ele_no]);
+    }
+#else
+    (void)ele_no;
+#endif
+
+    return 0;
+}
+
 uint8_t reconstruct_single_channel(NeAACDecStruct *hDecoder, ic_stream *ics,
                                    element *sce, int16_t *spec_data)
 {
@@ -977,6 +1372,15 @@ uint8_t reconstruct_single_channel(NeAACDecStruct *hDecoder, ic_stream *ics,
     if(!hDecoder->fb_intermed[sce->channel])
         return 15;
 
+    if (element_skipped(hDecoder, sce, output_channels))
+    {
+        /* the noise of the PNS bands advances the random generator that
+           the decoded channels share */
+        pns_decode(ics, NULL, spec_coef, NULL, hDecoder->frameLength, 0, hDecoder->object_type,
+            &(hDecoder->__r1), &(hDecoder->__r2));
+        return skip_element(hDecoder, sce, ics, NULL, output_channels);
+    }
+
     /* dequantisation and scaling */
     retval = quant_to_spec(hDecoder, ics, spec_data, spec_coef, hDecoder->frameLength);
     if (retval > 0)
@@ -1081,18 +1485,7 @@ uint8_t reconstruct_single_channel(NeAACDecStruct *hDecoder, ic_stream *ics,
         int ele = hDecoder->fr_ch_ele;
         int ch = sce->channel;
 
-        /* following case can happen when forceUpSampling == 1 */
-        if (hDecoder->sbr[ele] == NULL)
-        {
-            hDecoder->sbr[ele] = sbrDecodeInit(hDecoder->frameLength,
-                hDecoder->element_id[ele], 2*get_sample_rate(hDecoder->sf_index),
-                hDecoder->downSampledSBR
-#ifdef DRM
-                , 0
-#endif
-                );
-        }
-        if (!hDecoder->sbr[ele])
+        if (element_sbr(hDecoder, ele) == NULL)
             return 19;
 
         if (sce->ics1.window_sequence == EIGHT_SHORT_SEQUENCE)
@@ -1100,22 +1493,8 @@ uint8_t reconstruct_single_channel(NeAACDecStruct *hDecoder, ic_stream *ics,
         else
             hDecoder->sbr[ele]->maxAACLine = min(sce->ics1.swb_offset[max(sce->ics1.max_sfb-1, 0)], sce->ics1.swb_offset_max);
 
-        /* check if any of the PS tools is used */
-#if (defined(PS_DEC) || defined(DRM_PS))
-        if (hDecoder->ps_used[ele] == 0)
-        {
-#endif
-            retval = sbrDecodeSingleFrame(hDecoder->sbr[ele], hDecoder->time_out[ch],
-                hDecoder->postSeekResetFlag, hDecoder->downSampledSBR);
-#if (defined(PS_DEC) || defined(DRM_PS))
-        } else {
-            retval = sbrDecodeSingleFramePS(hDecoder->sbr[ele], hDecoder->time_out[ch],
-                hDecoder->time_out[ch+1], hDecoder->postSeekResetFlag,
-                hDecoder->downSampledSBR);
-        }
-#endif
-        if (retval > 0)
-            return retval;
+        /* this also copies L to R when no PS is used */
+        return sbr_element(hDecoder, ele, ch, ch+1, 0);
     } else if (((hDecoder->sbr_present_flag == 1) || (hDecoder->forceUpSampling == 1))
         && !hDecoder->sbr_alloced[hDecoder->fr_ch_ele])
     {
@@ -1140,12 +1519,105 @@ uint8_t reconstruct_single_channel(NeAACDecStruct *hDecoder, ic_stream *ics,
     return 0;
 }
 
+/* the two channels of a CPE after the joint stereo tools */
+typedef struct
+{
+    NeAACDecStruct *hDecoder;
+    ic_stream *ics[2];
+#ifdef LTP_DEC
+    ltp_info *ltp[2];
+#endif
+    real_t *spec_coef[2];
+    uint8_t channel[2];
+} pair_channels;
+
+/* prediction, TNS, DRC, filterbank and LTP state update of one channel;
+ * these only touch the state of that channel, so the two channels of
+ * a pair can run at the same time
+ */
+static void pair_channel_run(void *arg, unsigned long i)
+{
+    pair_channels *pair = (pair_channels*)arg;
+    NeAACDecStruct *hDecoder = pair->hDecoder;
+    ic_stream *ics = pair->ics[i];
+    real_t *spec_coef = pair->spec_coef[i];
+    uint8_t ch = pair->channel[i];
+
+#ifdef MAIN_DEC
+    /* MAIN object type prediction */
+    if (hDecoder->object_type == MAIN)
+    {
+        /* intra channel prediction */
+        ic_prediction(ics, spec_coef, hDecoder->pred_stat[ch], hDecoder->frameLength,
+            hDecoder->sf_index);
+
+        /* In addition, for scalefactor bands coded by perceptual
+           noise substitution the predictors belonging to the
+           corresponding spectral coefficients are reset.
+        */
+        pns_reset_pred_state(ics, hDecoder->pred_stat[ch]);
+    }
+#endif
+
+#ifdef LTP_DEC
+    if (is_ltp_ot(hDecoder->object_type))
+    {
+        /* long term prediction */
+        lt_prediction(ics, pair->ltp[i], spec_coef, hDecoder->lt_pred_stat[ch], hDecoder->fb,
+            ics->window_shape, hDecoder->window_shape_prev[ch],
+            hDecoder->sf_index, hDecoder->object_type, hDecoder->frameLength);
+    }
+#endif
+
+    /* tns decoding */
+    tns_decode_frame(ics, &(ics->tns), hDecoder->sf_index, hDecoder->object_type,
+        spec_coef, hDecoder->frameLength);
+
+    /* drc decoding */
+#if APPLY_DRC
+    if (hDecoder->drc->present)
+    {
+        if (!hDecoder->drc->exclude_mask[ch] || !hDecoder->drc->excluded_chns_present)
+            drc_decode(hDecoder->drc, spec_coef);
+    }
+#endif
+    /* filter bank */
+#ifdef SSR_DEC
+    if (hDecoder->object_type != SSR)
+    {
+#endif
+        ifilter_bank(hDecoder->fb, ics->window_sequence, ics->window_shape,
+            hDecoder->window_shape_prev[ch], spec_coef,
+            hDecoder->time_out[ch], hDecoder->fb_intermed[ch],
+            hDecoder->object_type, hDecoder->frameLength);
+#ifdef SSR_DEC
+    } else {
+        ssr_decode(&(ics->ssr), hDecoder->fb, ics->window_sequence, ics->window_shape,
+            hDecoder->window_shape_prev[ch], spec_coef, hDecoder->time_out[ch],
+            hDecoder->ssr_overlap[ch], hDecoder->ipqf_buffer[ch],
+            hDecoder->prev_fmd[ch], hDecoder->frameLength);
+    }
+#endif
+
+    /* save window shape for next frame */
+    hDecoder->window_shape_prev[ch] = ics->window_shape;
+
+#ifdef LTP_DEC
+    if (is_ltp_ot(hDecoder->object_type))
+    {
+        lt_update_state(hDecoder->lt_pred_stat[ch], hDecoder->time_out[ch],
+            hDecoder->fb_intermed[ch], hDecoder->frameLength, hDecoder->object_type);
+    }
+#endif
+}
+
 uint8_t reconstruct_channel_pair(NeAACDecStruct *hDecoder, ic_stream *ics1, ic_stream *ics2,
                                  element *cpe, int16_t *spec_data1, int16_t *spec_data2)
 {
     uint8_t retval;
     ALIGN real_t spec_coef1[1024];
     ALIGN real_t spec_coef2[1024];
+    pair_channels pair;
 
 #ifdef PROFILE
     int64_t count = faad_get_ts();
@@ -1165,6 +1637,16 @@ uint8_t reconstruct_channel_pair(NeAACDecStruct *hDecoder, ic_stream *ics1, ic_s
     if(!hDecoder->fb_intermed[cpe->channel] || !hDecoder->fb_intermed[cpe->paired_channel])
         return 15;
 
+    if (element_skipped(hDecoder, cpe, 2))
+    {
+        /* the noise of the PNS bands advances the random generator that
+           the decoded channels share */
+        pns_decode(ics1, ics2, spec_coef1, spec_coef2, hDecoder->frameLength,
+            (ics1->ms_mask_present) ? 1 : 0, hDecoder->object_type,
+            &(hDecoder->__r1), &(hDecoder->__r2));
+        return skip_element(hDecoder, cpe, ics1, ics2, 2);
+    }
+
     /* dequantisation and scaling */
     retval = quant_to_spec(hDecoder, ics1, spec_data1, spec_coef1, hDecoder->frameLength);
     if (retval > 0)
@@ -1226,25 +1708,6 @@ uint8_t reconstruct_channel_pair(NeAACDecStruct *hDecoder, ic_stream *ics1, ic_s
     }
 #endif
 
-#ifdef MAIN_DEC
-    /* MAIN object type prediction */
-    if (hDecoder->object_type == MAIN)
-    {
-        /* intra channel prediction */
-        ic_prediction(ics1, spec_coef1, hDecoder->pred_stat[cpe->channel], hDecoder->frameLength,
-            hDecoder->sf_index);
-        ic_prediction(ics2, spec_coef2, hDecoder->pred_stat[cpe->paired_channel], hDecoder->frameLength,
-            hDecoder->sf_index);
-
-        /* In addition, for scalefactor bands coded by perceptual
-           noise substitution the predictors belonging to the
-           corresponding spectral coefficients are reset.
-        */
-        pns_reset_pred_state(ics1, hDecoder->pred_stat[cpe->channel]);
-        pns_reset_pred_state(ics2, hDecoder->pred_stat[cpe->paired_channel]);
-    }
-#endif
-
 #ifdef LTP_DEC
     if (is_ltp_ot(hDecoder->object_type))
     {
@@ -1267,72 +1730,29 @@ uint8_t reconstruct_channel_pair(NeAACDecStruct *hDecoder, ic_stream *ics1, ic_s
             ltp2->lag = hDecoder->ltp_lag[cpe->paired_channel];
         }
 #endif
-
-        /* long term prediction */
-        lt_prediction(ics1, ltp1, spec_coef1, hDecoder->lt_pred_stat[cpe->channel], hDecoder->fb,
-            ics1->window_shape, hDecoder->window_shape_prev[cpe->channel],
-            hDecoder->sf_index, hDecoder->object_type, hDecoder->frameLength);
-        lt_prediction(ics2, ltp2, spec_coef2, hDecoder->lt_pred_stat[cpe->paired_channel], hDecoder->fb,
-            ics2->window_shape, hDecoder->window_shape_prev[cpe->paired_channel],
-            hDecoder->sf_index, hDecoder->object_type, hDecoder->frameLength);
+        pair.ltp[0] = ltp1;
+        pair.ltp[1] = ltp2;
     }
 #endif
 
-    /* tns decoding */
-    tns_decode_frame(ics1, &(ics1->tns), hDecoder->sf_index, hDecoder->object_type,
-        spec_coef1, hDecoder->frameLength);
-    tns_decode_frame(ics2, &(ics2->tns), hDecoder->sf_index, hDecoder->object_type,
-        spec_coef2, hDecoder->frameLength);
+    /* from here on the channels are independent */
+    pair.hDecoder = hDecoder;
+    pair.ics[0] = ics1;
+    pair.ics[1] = ics2;
+    pair.spec_coef[0] = spec_coef1;
+    pair.spec_coef[1] = spec_coef2;
+    pair.channel[0] = cpe->channel;
+    pair.channel[1] = (uint8_t)cpe->paired_channel;
 
-    /* drc decoding */
-#if APPLY_DRC
-    if (hDecoder->drc->present)
-    {
-        if (!hDecoder->drc->exclude_mask[cpe->channel] || !hDecoder->drc->excluded_chns_present)
-            drc_decode(hDecoder->drc, spec_coef1);
-        if (!hDecoder->drc->exclude_mask[cpe->paired_channel] || !hDecoder->drc->excluded_chns_present)
-            drc_decode(hDecoder->drc, spec_coef2);
-    }
-#endif
-    /* filter bank */
-#ifdef SSR_DEC
-    if (hDecoder->object_type != SSR)
-    {
-#endif
-        ifilter_bank(hDecoder->fb, ics1->window_sequence, ics1->window_shape,
-            hDecoder->window_shape_prev[cpe->channel], spec_coef1,
-            hDecoder->time_out[cpe->channel], hDecoder->fb_intermed[cpe->channel],
-            hDecoder->object_type, hDecoder->frameLength);
-        ifilter_bank(hDecoder->fb, ics2->window_sequence, ics2->window_shape,
-            hDecoder->window_shape_prev[cpe->paired_channel], spec_coef2,
-            hDecoder->time_out[cpe->paired_channel], hDecoder->fb_intermed[cpe->paired_channel],
-            hDecoder->object_type, hDecoder->frameLength);
 #ifdef SSR_DEC
-    } else {
-        ssr_decode(&(ics1->ssr), hDecoder->fb, ics1->window_sequence, ics1->window_shape,
-            hDecoder->window_shape_prev[cpe->channel], spec_coef1, hDecoder->time_out[cpe->channel],
-            hDecoder->ssr_overlap[cpe->channel], hDecoder->ipqf_buffer[cpe->channel],
-            hDecoder->prev_fmd[cpe->channel], hDecoder->frameLength);
-        ssr_decode(&(ics2->ssr), hDecoder->fb, ics2->window_sequence, ics2->window_shape,
-            hDecoder->window_shape_prev[cpe->paired_channel], spec_coef2, hDecoder->time_out[cpe->paired_channel],
-            hDecoder->ssr_overlap[cpe->paired_channel], hDecoder->ipqf_buffer[cpe->paired_channel],
-            hDecoder->prev_fmd[cpe->paired_channel], hDecoder->frameLength);
-    }
-#endif
-
-    /* save window shape for next frame */
-    hDecoder->window_shape_prev[cpe->channel] = ics1->window_shape;
-    hDecoder->window_shape_prev[cpe->paired_channel] = ics2->window_shape;
-
-#ifdef LTP_DEC
-    if (is_ltp_ot(hDecoder->object_type))
+    /* the SSR filterbank keeps its scratch buffer in fb_info */
+    if (hDecoder->object_type == SSR)
     {
-        lt_update_state(hDecoder->lt_pred_stat[cpe->channel], hDecoder->time_out[cpe->channel],
-            hDecoder->fb_intermed[cpe->channel], hDecoder->frameLength, hDecoder->object_type);
-        lt_update_state(hDecoder->lt_pred_stat[cpe->paired_channel], hDecoder->time_out[cpe->paired_channel],
-            hDecoder->fb_intermed[cpe->paired_channel], hDecoder->frameLength, hDecoder->object_type);
-    }
+        pair_channel_run(&pair, 0);
+        pair_channel_run(&pair, 1);
+    } else
 #endif
+        tpool_run(hDecoder->pool, pair_channel_run, &pair, 2);
 
 #ifdef SBR_DEC
     if (((hDecoder->sbr_present_flag == 1) || (hDecoder->forceUpSampling == 1))
@@ -1342,18 +1762,7 @@ uint8_t reconstruct_channel_pair(NeAACDecStruct *hDecoder, ic_stream *ics1, ic_s
         int ch0 = cpe->channel;
         int ch1 = cpe->paired_channel;
 
-        /* following case can happen when forceUpSampling == 1 */
-        if (hDecoder->sbr[ele] == NULL)
-        {
-            hDecoder->sbr[ele] = sbrDecodeInit(hDecoder->frameLength,
-                hDecoder->element_id[ele], 2*get_sample_rate(hDecoder->sf_index),
-                hDecoder->downSampledSBR
-#ifdef DRM
-                , 0
-#endif
-                );
-        }
-        if (!hDecoder->sbr[ele])
+        if (element_sbr(hDecoder, ele) == NULL)
             return 19;
 
         if (cpe->ics1.window_sequence == EIGHT_SHORT_SEQUENCE)
@@ -1361,9 +1770,7 @@ uint8_t reconstruct_channel_pair(NeAACDecStruct *hDecoder, ic_stream *ics1, ic_s
         else
             hDecoder->sbr[ele]->maxAACLine = min(cpe->ics1.swb_offset[max(cpe->ics1.max_sfb-1, 0)], cpe->ics1.swb_offset_max);
 
-        retval = sbrDecodeCoupleFrame(hDecoder->sbr[ele],
-            hDecoder->time_out[ch0], hDecoder->time_out[ch1],
-            hDecoder->postSeekResetFlag, hDecoder->downSampledSBR);
+        retval = sbr_element(hDecoder, ele, ch0, ch1, 1);
         if (retval > 0)
             return retval;
     } else if (((hDecoder->sbr_present_flag == 1) || (hDecoder->forceUpSampling == 1))
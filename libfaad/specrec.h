@@ -38,10 +38,14 @@ extern "C" {
 #include "syntax.h"
 
 uint8_t window_grouping_info(NeAACDecStruct *hDecoder, ic_stream *ics);
+uint8_t preallocate_elements(NeAACDecStruct *hDecoder, uint8_t channel_config);
 uint8_t reconstruct_channel_pair(NeAACDecStruct *hDecoder, ic_stream *ics1, ic_stream *ics2,
                                  element *cpe, int16_t *spec_data1, int16_t *spec_data2);
 uint8_t reconstruct_single_channel(NeAACDecStruct *hDecoder, ic_stream *ics, element *sce,
                                 int16_t *spec_data);
+#ifdef SBR_DEC
+uint8_t sbr_decode_elements(NeAACDecStruct *hDecoder);
+#endif
 
 #ifdef __cplusplus
 }
@@ -37,6 +37,7 @@
 #include "filtbank.h"
 #include "ssr.h"
 #include "ssr_fb.h"
+#include "ssr_ipqf.h"
 
 void ssr_decode(ssr_info *ssr, fb_info *fb, uint8_t window_sequence,
                 uint8_t window_shape, uint8_t window_shape_prev,
@@ -77,7 +78,7 @@ void ssr_decode(ssr_info *ssr, fb_info *fb, uint8_t window_sequence,
     }
 
     /* inverse pqf to bring subbands together again */
-    ssr_ipqf(ssr, output, time_out, ipqf_buffer, frame_len, SSR_BANDS);
+    ssr_ipqf(ssr, fb, output, time_out, ipqf_buffer, frame_len, SSR_BANDS);
 }
 
 static void ssr_gain_control(ssr_info *ssr, real_t *data, real_t *output,
@@ -39,17 +39,33 @@
 #include "mdct.h"
 #include "ssr_fb.h"
 #include "ssr_win.h"
+#include "ssr.h"
+#include "ssr_ipqf.h"
 
-fb_info *ssr_filter_bank_init(uint16_t frame_len)
+fb_info *ssr_filter_bank_init(allocator_info *alloc, uint16_t frame_len)
 {
     uint16_t nshort = frame_len/8;
 
-    fb_info *fb = (fb_info*)faad_malloc(sizeof(fb_info));
+    fb_info *fb = (fb_info*)faad_malloc(alloc, sizeof(fb_info));
+    if (fb == NULL)
+        return NULL;
     memset(fb, 0, sizeof(fb_info));
 
     /* normal */
-    fb->mdct256 = faad_mdct_init(2*nshort);
-    fb->mdct2048 = faad_mdct_init(2*frame_len);
+    fb->mdct256 = faad_mdct_init(alloc, 2*nshort);
+    fb->mdct2048 = faad_mdct_init(alloc, 2*frame_len);
+
+    fb->ssr_transf_buf = (real_t*)faad_malloc(alloc, 2*frame_len*sizeof(real_t));
+    fb->pqf_q0 = (real_t*)faad_malloc(alloc, SSR_BANDS*SSR_BANDS*sizeof(real_t));
+    fb->pqf_t0 = (real_t*)faad_malloc(alloc, PQFTAPS/2*sizeof(real_t));
+    fb->pqf_t1 = (real_t*)faad_malloc(alloc, PQFTAPS/2*sizeof(real_t));
+    if ((fb->mdct256 == NULL) || (fb->mdct2048 == NULL) || (fb->ssr_transf_buf == NULL) ||
+        (fb->pqf_q0 == NULL) || (fb->pqf_t0 == NULL) || (fb->pqf_t1 == NULL))
+    {
+        ssr_filter_bank_end(alloc, fb);
+        return NULL;
+    }
+    ssr_ipqf_init(fb);
 
     fb->long_window[0]  = sine_long_256;
     fb->short_window[0] = sine_short_32;
@@ -59,12 +75,20 @@ fb_info *ssr_filter_bank_init(uint16_t frame_len)
     return fb;
 }
 
-void ssr_filter_bank_end(fb_info *fb)
+void ssr_filter_bank_end(allocator_info *alloc, fb_info *fb)
 {
-    faad_mdct_end(fb->mdct256);
-    faad_mdct_end(fb->mdct2048);
+    if (fb == NULL)
+        return;
+
+    if (fb->pqf_t1) faad_free(alloc, fb->pqf_t1);
+    if (fb->pqf_t0) faad_free(alloc, fb->pqf_t0);
+    if (fb->pqf_q0) faad_free(alloc, fb->pqf_q0);
+    if (fb->ssr_transf_buf) faad_free(alloc, fb->ssr_transf_buf);
 
-    if (fb) faad_free(fb);
+    faad_mdct_end(alloc, fb->mdct256);
+    faad_mdct_end(alloc, fb->mdct2048);
+
+    faad_free(alloc, fb);
 }
 
 static INLINE void imdct_ssr(fb_info *fb, real_t *in_data,
@@ -104,7 +128,7 @@ void ssr_ifilter_bank(fb_info *fb, uint8_t window_sequence, uint8_t window_shape
 
     uint16_t nflat_ls = (nlong-nshort)/2;
 
-    transf_buf = (real_t*)faad_malloc(2*nlong*sizeof(real_t));
+    transf_buf = fb->ssr_transf_buf;
 
     window_long       = fb->long_window[window_shape];
     window_long_prev  = fb->long_window[window_shape_prev];
@@ -176,8 +200,6 @@ void ssr_ifilter_bank(fb_info *fb, uint8_t window_sequence, uint8_t window_shape
             time_out[nlong+i] = MUL_R_C(transf_buf[nlong+i],window_long[nlong-1-i]);
 		break;
     }
-
-    faad_free(transf_buf);
 }
 
 
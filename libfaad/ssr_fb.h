@@ -35,8 +35,8 @@
 extern "C" {
 #endif
 
-fb_info *ssr_filter_bank_init(uint16_t frame_len);
-void ssr_filter_bank_end(fb_info *fb);
+fb_info *ssr_filter_bank_init(allocator_info *alloc, uint16_t frame_len);
+void ssr_filter_bank_end(allocator_info *alloc, fb_info *fb);
 
 /*non overlapping inverse filterbank */
 void ssr_ifilter_bank(fb_info *fb,
@@ -36,10 +36,7 @@
 #include "ssr.h"
 #include "ssr_ipqf.h"
 
-static real_t **app_pqfbuf;
-static real_t **pp_q0, **pp_t0, **pp_t1;
-
-void gc_set_protopqf(real_t *p_proto)
+static void gc_set_protopqf(real_t *p_proto)
 {
     int	j;
     static real_t a_half[48] =
@@ -68,74 +65,65 @@ void gc_set_protopqf(real_t *p_proto)
     }
 }
 
-void gc_setcoef_eff_pqfsyn(int mm,
-                           int kk,
-                           real_t *p_proto,
-                           real_t ***ppp_q0,
-                           real_t ***ppp_t0,
-                           real_t ***ppp_t1)
+/* q0 is mm x mm, t0 and t1 are mm x kk, row by row */
+static void gc_setcoef_eff_pqfsyn(int mm,
+                                  int kk,
+                                  real_t *p_proto,
+                                  real_t *p_q0,
+                                  real_t *p_t0,
+                                  real_t *p_t1)
 {
     int	i, k, n;
     real_t	w;
 
     /* Set 1st Mul&Acc Coef's */
-    *ppp_q0 = (real_t **) calloc(mm, sizeof(real_t *));
-    for (n = 0; n < mm; ++n)
-    {
-        (*ppp_q0)[n] = (real_t *) calloc(mm, sizeof(real_t));
-    }
     for (n = 0; n < mm/2; ++n)
     {
         for (i = 0; i < mm; ++i)
         {
             w = (2*i+1)*(2*n+1-mm)*M_PI/(4*mm);
-            (*ppp_q0)[n][i] = 2.0 * cos((real_t) w);
+            p_q0[n*mm + i] = 2.0 * cos((real_t) w);
 
             w = (2*i+1)*(2*(mm+n)+1-mm)*M_PI/(4*mm);
-            (*ppp_q0)[n + mm/2][i] = 2.0 * cos((real_t) w);
+            p_q0[(n + mm/2)*mm + i] = 2.0 * cos((real_t) w);
         }
     }
 
     /* Set 2nd Mul&Acc Coef's */
-    *ppp_t0 = (real_t **) calloc(mm, sizeof(real_t *));
-    *ppp_t1 = (real_t **) calloc(mm, sizeof(real_t *));
-    for (n = 0; n < mm; ++n)
-    {
-        (*ppp_t0)[n] = (real_t *) calloc(kk, sizeof(real_t));
-        (*ppp_t1)[n] = (real_t *) calloc(kk, sizeof(real_t));
-    }
     for (n = 0; n < mm; ++n)
     {
         for (k = 0; k < kk; ++k)
         {
-            (*ppp_t0)[n][k] = mm * p_proto[2*k    *mm + n];
-            (*ppp_t1)[n][k] = mm * p_proto[(2*k+1)*mm + n];
+            p_t0[n*kk + k] = mm * p_proto[2*k    *mm + n];
+            p_t1[n*kk + k] = mm * p_proto[(2*k+1)*mm + n];
 
             if (k%2 != 0)
             {
-                (*ppp_t0)[n][k] = -(*ppp_t0)[n][k];
-                (*ppp_t1)[n][k] = -(*ppp_t1)[n][k];
+                p_t0[n*kk + k] = -p_t0[n*kk + k];
+                p_t1[n*kk + k] = -p_t1[n*kk + k];
             }
         }
     }
 }
 
-void ssr_ipqf(ssr_info *ssr, real_t *in_data, real_t *out_data,
-              real_t buffer[SSR_BANDS][96/4],
-              uint16_t frame_len, uint8_t bands)
+/* fills the inverse PQF coefficients of the SSR filterbank */
+void ssr_ipqf_init(fb_info *fb)
 {
-    static int initFlag = 0;
     real_t a_pqfproto[PQFTAPS];
 
-    int	i;
+    gc_set_protopqf(a_pqfproto);
+    gc_setcoef_eff_pqfsyn(SSR_BANDS, PQFTAPS/(2*SSR_BANDS), a_pqfproto,
+        fb->pqf_q0, fb->pqf_t0, fb->pqf_t1);
+}
 
-    if (initFlag == 0)
-    {
-        gc_set_protopqf(a_pqfproto);
-        gc_setcoef_eff_pqfsyn(SSR_BANDS, PQFTAPS/(2*SSR_BANDS), a_pqfproto,
-            &pp_q0, &pp_t0, &pp_t1);
-        initFlag = 1;
-    }
+void ssr_ipqf(ssr_info *ssr, fb_info *fb, real_t *in_data, real_t *out_data,
+              real_t buffer[SSR_BANDS][96/4],
+              uint16_t frame_len, uint8_t bands)
+{
+    const real_t *pp_q0 = fb->pqf_q0;
+    const real_t *pp_t0 = fb->pqf_t0;
+    const real_t *pp_t1 = fb->pqf_t1;
+    int	i;
 
     for (i = 0; i < frame_len / SSR_BANDS; i++)
     {
@@ -156,7 +144,7 @@ void ssr_ipqf(ssr_info *ssr, real_t *in_data, real_t *out_data,
             real_t acc = 0.0;
             for (l = 0; l < mm; l++)
             {
-                acc += pp_q0[n][l] * in_data[l*frame_len/SSR_BANDS + i];
+                acc += pp_q0[n*mm + l] * in_data[l*frame_len/SSR_BANDS + i];
             }
             buffer[n][2*kk-1] = acc;
         }
@@ -166,22 +154,22 @@ void ssr_ipqf(ssr_info *ssr, real_t *in_data, real_t *out_data,
             real_t acc = 0.0;
             for (k = 0; k < kk; k++)
             {
-                acc += pp_t0[n][k] * buffer[n][2*kk-1-2*k];
+                acc += pp_t0[n*kk + k] * buffer[n][2*kk-1-2*k];
             }
             for (k = 0; k < kk; ++k)
             {
-                acc += pp_t1[n][k] * buffer[n + mm/2][2*kk-2-2*k];
+                acc += pp_t1[n*kk + k] * buffer[n + mm/2][2*kk-2-2*k];
             }
             out_data[i*SSR_BANDS + n] = acc;
 
             acc = 0.0;
             for (k = 0; k < kk; k++)
             {
-                acc += pp_t0[mm-1-n][k] * buffer[n][2*kk-1-2*k];
+                acc += pp_t0[(mm-1-n)*kk + k] * buffer[n][2*kk-1-2*k];
             }
             for (k = 0; k < kk; k++)
             {
-                acc -= pp_t1[mm-1-n][k] * buffer[n + mm/2][2*kk-2-2*k];
+                acc -= pp_t1[(mm-1-n)*kk + k] * buffer[n + mm/2][2*kk-2-2*k];
             }
             out_data[i*SSR_BANDS + mm-1-n] = acc;
         }
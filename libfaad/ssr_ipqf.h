@@ -35,7 +35,8 @@
 extern "C" {
 #endif
 
-void ssr_ipqf(ssr_info *ssr, real_t *in_data, real_t *out_data,
+void ssr_ipqf_init(fb_info *fb);
+void ssr_ipqf(ssr_info *ssr, fb_info *fb, real_t *in_data, real_t *out_data,
               real_t buffer[SSR_BANDS][96/4],
               uint16_t frame_len, uint8_t bands);
 
@@ -39,6 +39,8 @@ extern "C" {
 #ifdef SBR_DEC
 #include "sbr_dec.h"
 #endif
+#include "tpool.h"
+#include "resample.h"
 
 #define MAX_CHANNELS        64
 #define MAX_SYNTAX_ELEMENTS 48
@@ -77,6 +79,16 @@ typedef struct
     mdct_info *mdct1024;
 #endif
     mdct_info *mdct2048;
+#ifdef SSR_DEC
+    /* SSR: IMDCT output of one band and the inverse PQF coefficients */
+    real_t *ssr_transf_buf;
+    real_t *pqf_q0;
+    real_t *pqf_t0;
+    real_t *pqf_t1;
+#endif
+#ifdef USE_SSE
+    uint8_t sse;
+#endif
 #ifdef PROFILE
     int64_t cycles;
 #endif
@@ -143,6 +155,22 @@ typedef struct
     uint8_t cpe_channel[16];
 } program_config;
 
+/* most channels a downmix can output */
+#define DMX_MAX_OUT 8
+
+/* downmix of the decoded channels, output channel o is
+   gain[o] * sum(coef[o][k] * time_out[in[o][k]]) over k < terms[o];
+   in fixed point the gain is part of coef */
+typedef struct
+{
+    uint8_t out_channels;
+    uint8_t terms[DMX_MAX_OUT];
+    uint8_t in[DMX_MAX_OUT][MAX_CHANNELS];
+    real_t coef[DMX_MAX_OUT][MAX_CHANNELS];
+    real_t gain[DMX_MAX_OUT];
+    uint8_t position[DMX_MAX_OUT];
+} downmix_info;
+
 typedef struct
 {
     uint16_t syncword;
@@ -329,6 +357,66 @@ typedef struct {
     uint32_t ASCbits;
 } latm_header;
 
+#ifdef SBR_DEC
+/* SBR of one channel element, queued while parsing the frame
+   when the decoder has a worker pool */
+typedef struct
+{
+    uint8_t ele;
+    uint8_t ch0;
+    uint8_t ch1;
+    uint8_t pair;
+    uint8_t error;
+} sbr_job;
+#endif
+
+/* sample layouts produced by aac_frame_decode() */
+#define OUTPUT_INTERLEAVED 0
+#define OUTPUT_PLANAR      1
+#define OUTPUT_TIME_OUT    2
+
+/* frames NeAACDecParse() can be ahead of NeAACDecSynthesize() */
+#define PARSED_FRAMES 2
+
+/* channel element read ahead by NeAACDecParse() */
+typedef struct
+{
+    ALIGN int16_t spec_data[2][1024];
+    element ele;
+    uint8_t paired;
+    /* bit position in the frame after the element */
+    uint32_t end_bit;
+} parsed_element;
+
+/* frame waiting for NeAACDecSynthesize(), its bytes are kept because all
+   but the channel elements are read again in the synthesis stage */
+typedef struct
+{
+    uint8_t *data;
+    uint32_t data_size;
+    uint32_t data_alloc;
+
+    parsed_element *ele[MAX_SYNTAX_ELEMENTS];
+    uint8_t ele_count;
+    uint8_t ele_next;
+    /* error that stopped the parsing after the last element */
+    uint8_t error;
+} parsed_frame;
+
+/* read-only state that any number of decoders can use at the same time */
+typedef struct
+{
+    allocator_info alloc;
+
+    /* one reference per decoder plus the one of the creator */
+    long refcount;
+
+    fb_info *fb;
+#ifdef ALLOW_SMALL_FRAMELENGTH
+    fb_info *fb960;
+#endif
+} NeAACDecSharedStruct;
+
 typedef struct
 {
     uint8_t adts_header_present;
@@ -342,6 +430,8 @@ typedef struct
     uint8_t aacSectionDataResilienceFlag;
     uint8_t aacScalefactorDataResilienceFlag;
     uint8_t aacSpectralDataResilienceFlag;
+    /* scratch of the RVLC scalefactor decoding, RVLC_BUFFER_SIZE bytes */
+    uint8_t *rvlc_buffer;
 #endif
     uint16_t frameLength;
 
@@ -349,8 +439,15 @@ typedef struct
 
     uint32_t sample_buffer_size;
 
+    /* downMatrix: a downmix described by dmx is applied to the output */
     uint8_t downMatrix;
     uint8_t upMatrix;
+    downmix_info dmx;
+    /* matrix from NeAACDecSetDownmixMatrix, used when dmx_in_channels
+       is not 0 */
+    uint8_t dmx_in_channels;
+    uint8_t dmx_out_channels;
+    float32_t dmx_matrix[DMX_MAX_OUT*MAX_CHANNELS];
     uint8_t first_syn_ele;
     uint8_t has_lfe;
     /* number of channels in current frame */
@@ -366,6 +463,10 @@ typedef struct
        determines whether the data needed for the element is allocated or not
     */
     uint8_t element_alloced[MAX_SYNTAX_ELEMENTS];
+    /* prealloc_channels:
+       number of channels with worst case sized buffers from preallocate_elements()
+    */
+    uint8_t prealloc_channels;
     /* sample_buffer_size:
        (internal) output dara buffer size
     */
@@ -379,6 +480,9 @@ typedef struct
 #ifdef LTP_DEC
     uint16_t ltp_lag[MAX_CHANNELS];
 #endif
+    allocator_info alloc;
+    NeAACDecSharedStruct *shared;
+
     fb_info *fb;
     drc_info *drc;
 
@@ -389,6 +493,33 @@ typedef struct
     sbr_info *sbr[MAX_SYNTAX_ELEMENTS];
 #endif
 
+    /* worker pool from NeAACDecSetThreads or NeAACDecSetScheduler,
+       NULL when decoding on one thread */
+    tpool *pool;
+#ifdef SBR_DEC
+    sbr_job sbr_jobs[MAX_SYNTAX_ELEMENTS];
+    uint8_t sbr_job_count;
+#endif
+
+    /* queue of the split decoding interface, the counters are only
+       written by NeAACDecParse and NeAACDecSynthesize respectively */
+    parsed_frame *parsed[PARSED_FRAMES];
+    long parse_count;
+    long synth_count;
+    /* frame being synthesized, NULL when decoding in one go */
+    parsed_frame *replay;
+
+    /* output layout of the frame being decoded, OUTPUT_PLANAR takes one
+       buffer per channel, OUTPUT_TIME_OUT hands out time_out_ref */
+    uint8_t output_layout;
+    uint8_t planar_channels;
+    void **planar_buffer;
+    const real_t *time_out_ref[MAX_CHANNELS];
+
+    /* conversion to config.outputSampleRate, NULL when the decoded rate
+       is output */
+    resampler *resample;
+
 #ifdef SSR_DEC
     real_t *ssr_overlap[MAX_CHANNELS];
     real_t *prev_fmd[MAX_CHANNELS];
@@ -406,6 +537,13 @@ typedef struct
     uint32_t __r1;
     uint32_t __r2;
 
+#ifdef USE_SSE
+    /* CPU has SSE, selects the SSE code paths */
+    uint8_t sse;
+    /* CPU has SSE2, selects the packed PCM conversion */
+    uint8_t sse2;
+#endif
+
 #ifdef SBR_DEC
     int8_t sbr_present_flag;
     int8_t forceUpSampling;
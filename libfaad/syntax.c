@@ -59,6 +59,17 @@ static void decode_sce_lfe(NeAACDecStruct *hDecoder, NeAACDecFrameInfo *hInfo, b
                            uint8_t id_syn_ele);
 static void decode_cpe(NeAACDecStruct *hDecoder, NeAACDecFrameInfo *hInfo, bitfile *ld,
                        uint8_t id_syn_ele);
+#ifdef SBR_DEC
+static void check_sbr_element(NeAACDecStruct *hDecoder, uint8_t id_syn_ele);
+#endif
+static uint8_t parse_element(NeAACDecStruct *hDecoder, bitfile *ld,
+                             parsed_frame *frame, uint8_t id_syn_ele, uint8_t grow);
+static uint8_t replay_element(NeAACDecStruct *hDecoder, bitfile *ld,
+                              uint8_t paired, parsed_element **pe);
+static uint8_t sce_parse(NeAACDecStruct *hDecoder, bitfile *ld,
+                         element *sce, int16_t *spec_data);
+static uint8_t cpe_parse(NeAACDecStruct *hDecoder, bitfile *ld, element *cpe,
+                         int16_t *spec_data1, int16_t *spec_data2);
 static uint8_t single_lfe_channel_element(NeAACDecStruct *hDecoder, bitfile *ld,
                                           uint8_t channel, uint8_t *tag);
 static uint8_t channel_pair_element(NeAACDecStruct *hDecoder, bitfile *ld,
@@ -73,6 +84,7 @@ static uint8_t fill_element(NeAACDecStruct *hDecoder, bitfile *ld, drc_info *drc
                             ,uint8_t sbr_ele
 #endif
                             );
+static uint8_t skip_fill_element(bitfile *ld);
 static uint8_t individual_channel_stream(NeAACDecStruct *hDecoder, element *ele,
                                          bitfile *ld, ic_stream *ics, uint8_t scal_flag,
                                          int16_t *spec_data);
@@ -322,6 +334,21 @@ static uint8_t program_config_element(program_config *pce, bitfile *ld)
     return 0;
 }
 
+#ifdef SBR_DEC
+/* SBR elements preallocated from the channel configuration have to match
+   the element type that is actually found in the stream */
+static void check_sbr_element(NeAACDecStruct *hDecoder, uint8_t id_syn_ele)
+{
+    sbr_info *sbr = hDecoder->sbr[hDecoder->fr_ch_ele];
+
+    if ((sbr != NULL) && (sbr->id_aac != id_syn_ele))
+    {
+        sbrDecodeEnd(sbr);
+        hDecoder->sbr[hDecoder->fr_ch_ele] = NULL;
+    }
+}
+#endif
+
 static void decode_sce_lfe(NeAACDecStruct *hDecoder,
                            NeAACDecFrameInfo *hInfo, bitfile *ld,
                            uint8_t id_syn_ele)
@@ -355,6 +382,10 @@ static void decode_sce_lfe(NeAACDecStruct *hDecoder,
         return;
     }
 
+#ifdef SBR_DEC
+    check_sbr_element(hDecoder, id_syn_ele);
+#endif
+
     /* save the syntax element id */
     hDecoder->element_id[hDecoder->fr_ch_ele] = id_syn_ele;
 
@@ -426,6 +457,10 @@ static void decode_cpe(NeAACDecStruct *hDecoder, NeAACDecFrameInfo *hInfo, bitfi
         return;
     }
 
+#ifdef SBR_DEC
+    check_sbr_element(hDecoder, id_syn_ele);
+#endif
+
     /* save the syntax element id */
     hDecoder->element_id[hDecoder->fr_ch_ele] = id_syn_ele;
 
@@ -647,24 +682,175 @@ void raw_data_block(NeAACDecStruct *hDecoder, NeAACDecFrameInfo *hInfo,
     return;
 }
 
+/* reads a SCE, LFE or CPE into the next element record of frame */
+static uint8_t parse_element(NeAACDecStruct *hDecoder, bitfile *ld,
+                             parsed_frame *frame, uint8_t id_syn_ele, uint8_t grow)
+{
+    parsed_element *pe;
+    uint8_t result;
+
+    if (frame->ele_count+1 > MAX_SYNTAX_ELEMENTS)
+        return 13;
+
+    /* records are added to all frames of the queue at once, and only while
+       none of them waits for synthesis */
+    if (frame->ele[frame->ele_count] == NULL)
+    {
+        uint8_t i;
+
+        if (!grow)
+            return 34;
+
+        for (i = 0; i < PARSED_FRAMES; i++)
+        {
+            parsed_frame *f = hDecoder->parsed[i];
+
+            if (f->ele[frame->ele_count] == NULL)
+            {
+                f->ele[frame->ele_count] = (parsed_element*)faad_malloc(&hDecoder->alloc,
+                    sizeof(parsed_element));
+                if (f->ele[frame->ele_count] == NULL)
+                    return 34;
+            }
+        }
+    }
+    pe = frame->ele[frame->ele_count];
+
+    memset(&pe->ele, 0, sizeof(element));
+    memset(pe->spec_data[0], 0, sizeof(pe->spec_data[0]));
+    pe->paired = (id_syn_ele == ID_CPE);
+
+    if (pe->paired)
+    {
+        memset(pe->spec_data[1], 0, sizeof(pe->spec_data[1]));
+        result = cpe_parse(hDecoder, ld, &pe->ele, pe->spec_data[0], pe->spec_data[1]);
+    } else {
+        result = sce_parse(hDecoder, ld, &pe->ele, pe->spec_data[0]);
+    }
+    if (result > 0)
+        return result;
+
+    pe->end_bit = faad_get_processed_bits(ld);
+    frame->ele_count++;
+
+    return 0;
+}
+
+/* Parse stage of NeAACDecParse(): only the channel elements of the
+   raw_data_block() are read into frame, the other elements are stepped over
+   and read again by raw_data_block() in the synthesis stage */
+uint8_t raw_data_block_parse(NeAACDecStruct *hDecoder, bitfile *ld,
+                             parsed_frame *frame, uint8_t grow)
+{
+    uint8_t id_syn_ele;
+    uint8_t ele_this_frame = 0;
+    uint8_t result;
+
+#ifdef ERROR_RESILIENCE
+    if (hDecoder->object_type < ER_OBJECT_START)
+    {
+#endif
+        while ((id_syn_ele = (uint8_t)faad_getbits(ld, LEN_SE_ID
+            DEBUGVAR(1,4,"NeAACDecParse(): id_syn_ele"))) != ID_END)
+        {
+            switch (id_syn_ele) {
+            case ID_SCE:
+            case ID_CPE:
+                ele_this_frame++;
+                if ((result = parse_element(hDecoder, ld, frame, id_syn_ele, grow)) > 0)
+                    return result;
+                break;
+            case ID_LFE:
+#ifdef DRM
+                return 32;
+#else
+                ele_this_frame++;
+                if ((result = parse_element(hDecoder, ld, frame, id_syn_ele, grow)) > 0)
+                    return result;
+                break;
+#endif
+            case ID_CCE:
+#ifdef DRM
+                return 32;
+#else
+                ele_this_frame++;
+#ifdef COUPLING_DEC
+                if ((result = coupling_channel_element(hDecoder, ld)) > 0)
+                    return result;
+                break;
+#else
+                return 6;
+#endif
+#endif
+            case ID_DSE:
+                ele_this_frame++;
+                data_stream_element(hDecoder, ld);
+                break;
+            case ID_PCE:
+            {
+                program_config pce;
+
+                if (ele_this_frame != 0)
+                    return 31;
+                ele_this_frame++;
+                program_config_element(&pce, ld);
+                break;
+            }
+            case ID_FIL:
+                ele_this_frame++;
+                if ((result = skip_fill_element(ld)) > 0)
+                    return result;
+                break;
+            }
+            if (ld->error != 0)
+                return 32;
+        }
+#ifdef ERROR_RESILIENCE
+    } else {
+        /* Table 262: er_raw_data_block() */
+        static const uint8_t er_elements[7][5] = {
+            { ID_SCE, ID_END, ID_END, ID_END, ID_END },
+            { ID_CPE, ID_END, ID_END, ID_END, ID_END },
+            { ID_SCE, ID_CPE, ID_END, ID_END, ID_END },
+            { ID_SCE, ID_CPE, ID_SCE, ID_END, ID_END },
+            { ID_SCE, ID_CPE, ID_CPE, ID_END, ID_END },
+            { ID_SCE, ID_CPE, ID_CPE, ID_LFE, ID_END },
+            { ID_SCE, ID_CPE, ID_CPE, ID_CPE, ID_LFE }
+        };
+        uint8_t i;
+
+        if ((hDecoder->channelConfiguration < 1) || (hDecoder->channelConfiguration > 7))
+            return 7;
+
+        for (i = 0; i < 5; i++)
+        {
+            id_syn_ele = er_elements[hDecoder->channelConfiguration-1][i];
+            if (id_syn_ele == ID_END)
+                break;
+            if ((result = parse_element(hDecoder, ld, frame, id_syn_ele, grow)) > 0)
+                return result;
+        }
+    }
+#endif
+
+    /* new in corrigendum 14496-3:2002 */
+    faad_byte_align(ld);
+
+    return 0;
+}
+
 /* Table 4.4.4 and */
 /* Table 4.4.9 */
-static uint8_t single_lfe_channel_element(NeAACDecStruct *hDecoder, bitfile *ld,
-                                          uint8_t channel, uint8_t *tag)
+static uint8_t sce_parse(NeAACDecStruct *hDecoder, bitfile *ld,
+                         element *sce, int16_t *spec_data)
 {
     uint8_t retval = 0;
-    element sce = {0};
-    ic_stream *ics = &(sce.ics1);
-    ALIGN int16_t spec_data[1024] = {0};
+    ic_stream *ics = &(sce->ics1);
 
-    sce.element_instance_tag = (uint8_t)faad_getbits(ld, LEN_TAG
+    sce->element_instance_tag = (uint8_t)faad_getbits(ld, LEN_TAG
         DEBUGVAR(1,38,"single_lfe_channel_element(): element_instance_tag"));
 
-    *tag = sce.element_instance_tag;
-    sce.channel = channel;
-    sce.paired_channel = -1;
-
-    retval = individual_channel_stream(hDecoder, &sce, ld, ics, 0, spec_data);
+    retval = individual_channel_stream(hDecoder, sce, ld, ics, 0, spec_data);
     if (retval > 0)
         return retval;
 
@@ -672,6 +858,54 @@ static uint8_t single_lfe_channel_element(NeAACDecStruct *hDecoder, bitfile *ld,
     if (ics->is_used)
         return 32;
 
+    return 0;
+}
+
+/* hands out the next element that NeAACDecParse() read ahead and continues
+   after its bits */
+static uint8_t replay_element(NeAACDecStruct *hDecoder, bitfile *ld,
+                              uint8_t paired, parsed_element **pe)
+{
+    parsed_frame *frame = hDecoder->replay;
+
+    if (frame->ele_next >= frame->ele_count)
+        return (frame->error > 0) ? frame->error : 32;
+
+    *pe = frame->ele[frame->ele_next++];
+    if ((*pe)->paired != paired)
+        return 32;
+
+    faad_resetbits(ld, (*pe)->end_bit);
+
+    return 0;
+}
+
+static uint8_t single_lfe_channel_element(NeAACDecStruct *hDecoder, bitfile *ld,
+                                          uint8_t channel, uint8_t *tag)
+{
+    uint8_t retval = 0;
+    element sce_local = {0};
+    ALIGN int16_t spec_local[1024] = {0};
+    element *sce = &sce_local;
+    int16_t *spec_data = spec_local;
+
+    if (hDecoder->replay != NULL)
+    {
+        parsed_element *pe = NULL;
+
+        if ((retval = replay_element(hDecoder, ld, 0, &pe)) > 0)
+            return retval;
+        sce = &pe->ele;
+        spec_data = pe->spec_data[0];
+    } else {
+        if ((retval = sce_parse(hDecoder, ld, sce, spec_data)) > 0)
+            return retval;
+    }
+
+    *tag = sce->element_instance_tag;
+    sce->channel = channel;
+    sce->paired_channel = -1;
+
 #ifdef SBR_DEC
     /* check if next bitstream element is a fill element */
     /* if so, read it now so SBR decoding can be done in case of a file with SBR */
@@ -688,7 +922,7 @@ static uint8_t single_lfe_channel_element(NeAACDecStruct *hDecoder, bitfile *ld,
 #endif
 
     /* noiseless coding is done, spectral reconstruction is done now */
-    retval = reconstruct_single_channel(hDecoder, ics, &sce, spec_data);
+    retval = reconstruct_single_channel(hDecoder, &sce->ics1, sce, spec_data);
     if (retval > 0)
         return retval;
 
@@ -696,28 +930,21 @@ static uint8_t single_lfe_channel_element(NeAACDecStruct *hDecoder, bitfile *ld,
 }
 
 /* Table 4.4.5 */
-static uint8_t channel_pair_element(NeAACDecStruct *hDecoder, bitfile *ld,
-                                    uint8_t channels, uint8_t *tag)
+static uint8_t cpe_parse(NeAACDecStruct *hDecoder, bitfile *ld, element *cpe,
+                         int16_t *spec_data1, int16_t *spec_data2)
 {
-    ALIGN int16_t spec_data1[1024] = {0};
-    ALIGN int16_t spec_data2[1024] = {0};
-    element cpe = {0};
-    ic_stream *ics1 = &(cpe.ics1);
-    ic_stream *ics2 = &(cpe.ics2);
+    ic_stream *ics1 = &(cpe->ics1);
+    ic_stream *ics2 = &(cpe->ics2);
     uint8_t result;
 
-    cpe.channel        = channels;
-    cpe.paired_channel = channels+1;
-
-    cpe.element_instance_tag = (uint8_t)faad_getbits(ld, LEN_TAG
+    cpe->element_instance_tag = (uint8_t)faad_getbits(ld, LEN_TAG
         DEBUGVAR(1,39,"channel_pair_element(): element_instance_tag"));
-    *tag = cpe.element_instance_tag;
 
-    if ((cpe.common_window = faad_get1bit(ld
+    if ((cpe->common_window = faad_get1bit(ld
         DEBUGVAR(1,40,"channel_pair_element(): common_window"))) & 1)
     {
         /* both channels have common ics information */
-        if ((result = ics_info(hDecoder, ics1, ld, cpe.common_window)) > 0)
+        if ((result = ics_info(hDecoder, ics1, ld, cpe->common_window)) > 0)
             return result;
 
         ics1->ms_mask_present = (uint8_t)faad_getbits(ld, 2
@@ -766,14 +993,14 @@ static uint8_t channel_pair_element(NeAACDecStruct *hDecoder, bitfile *ld,
         ics1->ms_mask_present = 0;
     }
 
-    if ((result = individual_channel_stream(hDecoder, &cpe, ld, ics1,
+    if ((result = individual_channel_stream(hDecoder, cpe, ld, ics1,
         0, spec_data1)) > 0)
     {
         return result;
     }
 
 #ifdef ERROR_RESILIENCE
-    if (cpe.common_window && (hDecoder->object_type >= ER_OBJECT_START) &&
+    if (cpe->common_window && (hDecoder->object_type >= ER_OBJECT_START) &&
         (ics1->predictor_data_present))
     {
         if ((
@@ -794,12 +1021,44 @@ static uint8_t channel_pair_element(NeAACDecStruct *hDecoder, bitfile *ld,
     }
 #endif
 
-    if ((result = individual_channel_stream(hDecoder, &cpe, ld, ics2,
+    if ((result = individual_channel_stream(hDecoder, cpe, ld, ics2,
         0, spec_data2)) > 0)
     {
         return result;
     }
 
+    return 0;
+}
+
+static uint8_t channel_pair_element(NeAACDecStruct *hDecoder, bitfile *ld,
+                                    uint8_t channels, uint8_t *tag)
+{
+    ALIGN int16_t spec_local1[1024] = {0};
+    ALIGN int16_t spec_local2[1024] = {0};
+    element cpe_local = {0};
+    element *cpe = &cpe_local;
+    int16_t *spec_data1 = spec_local1;
+    int16_t *spec_data2 = spec_local2;
+    uint8_t result;
+
+    if (hDecoder->replay != NULL)
+    {
+        parsed_element *pe = NULL;
+
+        if ((result = replay_element(hDecoder, ld, 1, &pe)) > 0)
+            return result;
+        cpe = &pe->ele;
+        spec_data1 = pe->spec_data[0];
+        spec_data2 = pe->spec_data[1];
+    } else {
+        if ((result = cpe_parse(hDecoder, ld, cpe, spec_data1, spec_data2)) > 0)
+            return result;
+    }
+
+    *tag = cpe->element_instance_tag;
+    cpe->channel        = channels;
+    cpe->paired_channel = channels+1;
+
 #ifdef SBR_DEC
     /* check if next bitstream element is a fill element */
     /* if so, read it now so SBR decoding can be done in case of a file with SBR */
@@ -816,7 +1075,7 @@ static uint8_t channel_pair_element(NeAACDecStruct *hDecoder, bitfile *ld,
 #endif
 
     /* noiseless coding is done, spectral reconstruction is done now */
-    if ((result = reconstruct_channel_pair(hDecoder, ics1, ics2, &cpe,
+    if ((result = reconstruct_channel_pair(hDecoder, &cpe->ics1, &cpe->ics2, cpe,
         spec_data1, spec_data2)) > 0)
     {
         return result;
@@ -1139,9 +1398,10 @@ static uint8_t fill_element(NeAACDecStruct *hDecoder, bitfile *ld, drc_info *drc
 
             if (!hDecoder->sbr[sbr_ele])
             {
-                hDecoder->sbr[sbr_ele] = sbrDecodeInit(hDecoder->frameLength,
+                hDecoder->sbr[sbr_ele] = sbrDecodeInit(&hDecoder->alloc, hDecoder->frameLength,
                     hDecoder->element_id[sbr_ele], 2*get_sample_rate(hDecoder->sf_index),
-                    hDecoder->downSampledSBR
+                    hDecoder->downSampledSBR, hDecoder->config.useLowPowerSBR,
+                    hDecoder->config.useFastMathSBR
 #ifdef DRM
                     , 0
 #endif
@@ -1196,6 +1456,56 @@ static uint8_t fill_element(NeAACDecStruct *hDecoder, bitfile *ld, drc_info *drc
     return 0;
 }
 
+/* Table 4.4.11, only the length: the parse stage of NeAACDecParse() steps
+   over fill elements, fill_element() reads them in the synthesis stage */
+static uint8_t skip_fill_element(bitfile *ld)
+{
+    uint16_t count;
+
+    count = (uint16_t)faad_getbits(ld, 4
+        DEBUGVAR(1,65,"fill_element(): count"));
+    if (count == 15)
+    {
+        count += (uint16_t)faad_getbits(ld, 8
+            DEBUGVAR(1,66,"fill_element(): extra count")) - 1;
+    }
+
+    if (count > 0)
+    {
+#ifdef SBR_DEC
+        uint8_t bs_extension_type = (uint8_t)faad_showbits(ld, 4);
+
+        /* sbr_extension_data() always ends count bytes further */
+        if ((bs_extension_type == EXT_SBR_DATA) ||
+            (bs_extension_type == EXT_SBR_DATA_CRC))
+        {
+            faad_flushbits_ex(ld, 8*(uint32_t)count);
+            return 0;
+        }
+#endif
+#ifndef DRM
+        {
+            drc_info drc;
+
+            memset(&drc, 0, sizeof(drc_info));
+            while (count > 0)
+            {
+                uint16_t payload_bytes = extension_payload(ld, &drc, count);
+                if (payload_bytes <= count) {
+                    count -= payload_bytes;
+                } else {
+                    count = 0;
+                }
+            }
+        }
+#else
+        return 30;
+#endif
+    }
+
+    return 0;
+}
+
 /* Table 4.4.12 */
 #ifdef SSR_DEC
 static void gain_control_data(bitfile *ld, ic_stream *ics)
@@ -1421,8 +1731,9 @@ void DRM_aac_scalable_main_element(NeAACDecStruct *hDecoder, NeAACDecFrameInfo *
 
         if (!hDecoder->sbr[0])
         {
-            hDecoder->sbr[0] = sbrDecodeInit(hDecoder->frameLength, hDecoder->element_id[0],
-                2*get_sample_rate(hDecoder->sf_index), 0 /* ds SBR */, 1);
+            hDecoder->sbr[0] = sbrDecodeInit(&hDecoder->alloc, hDecoder->frameLength, hDecoder->element_id[0],
+                2*get_sample_rate(hDecoder->sf_index), 0 /* ds SBR */,
+                hDecoder->config.useLowPowerSBR, hDecoder->config.useFastMathSBR, 1);
         }
         if (!hDecoder->sbr[0])
         {
@@ -1431,7 +1742,12 @@ void DRM_aac_scalable_main_element(NeAACDecStruct *hDecoder, NeAACDecFrameInfo *
         }
 
         /* Reverse bit reading of SBR data in DRM audio frame */
-        revbuffer = (uint8_t*)faad_malloc(buffer_size*sizeof(uint8_t));
+        revbuffer = (uint8_t*)faad_malloc(&hDecoder->alloc, buffer_size*sizeof(uint8_t));
+        if (revbuffer == NULL)
+        {
+            hInfo->error = 39;
+            return;
+        }
         prevbufstart = revbuffer;
         pbufend = &buffer[buffer_size - 1];
         for (i = 0; i < buffer_size; i++)
@@ -1476,7 +1792,7 @@ void DRM_aac_scalable_main_element(NeAACDecStruct *hDecoder, NeAACDecFrameInfo *
         faad_endbits(&ld_sbr);
 
         if (revbuffer)
-            faad_free(revbuffer);
+            faad_free(&hDecoder->alloc, revbuffer);
     }
 #endif
 #endif
@@ -1659,7 +1975,9 @@ static uint8_t side_info(NeAACDecStruct *hDecoder, element *ele,
     /* RVLC spectral data is put here */
     if (hDecoder->aacScalefactorDataResilienceFlag)
     {
-        if ((result = rvlc_decode_scale_factors(ics, ld)) > 0)
+        if (hDecoder->rvlc_buffer == NULL)
+            return 39;
+        if ((result = rvlc_decode_scale_factors(ics, ld, hDecoder->rvlc_buffer)) > 0)
             return result;
     }
 #endif
@@ -2205,22 +2523,23 @@ static uint8_t spectral_data(NeAACDecStruct *hDecoder, ic_stream *ics, bitfile *
 #ifdef SFBO_PRINT
                 printf("%d\n", ics->sect_sfb_offset[g][ics->sect_start[g][i]]);
 #endif
-                for (k = ics->sect_sfb_offset[g][ics->sect_start[g][i]];
-                     k < ics->sect_sfb_offset[g][ics->sect_end[g][i]]; k += inc)
-                {
-                    if ((result = huffman_spectral_data(sect_cb, ld, &spectral_data[p])) > 0)
-                        return result;
+                k = ics->sect_sfb_offset[g][ics->sect_end[g][i]] -
+                    ics->sect_sfb_offset[g][ics->sect_start[g][i]];
+                /* the section is a whole number of codewords */
+                k = (k + inc - 1) / inc * inc;
+
+                if ((result = huffman_spectral_section(sect_cb, ld, &spectral_data[p], k)) > 0)
+                    return result;
 #ifdef SD_PRINT
+                {
+                    int j;
+                    for (j = p; j < p+k; j++)
                     {
-                        int j;
-                        for (j = p; j < p+inc; j++)
-                        {
-                            printf("%d\n", spectral_data[j]);
-                        }
+                        printf("%d\n", spectral_data[j]);
                     }
-#endif
-                    p += inc;
                 }
+#endif
+                p += k;
                 break;
             }
         }
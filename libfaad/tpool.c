@@ -0,0 +1,303 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**
+** $Id: tpool.c,v 1.0 $
+**/
+
+#include "common.h"
+#include "structs.h"
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef USE_THREADS
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+#endif
+
+#include "tpool.h"
+
+#ifdef USE_THREADS
+/* the SBR and PS code keep their QMF matrices on the stack */
+#define TPOOL_STACK_SIZE (1 << 20)
+
+#ifdef _WIN32
+typedef HANDLE tpool_thread;
+typedef CRITICAL_SECTION tpool_mutex;
+typedef CONDITION_VARIABLE tpool_cond;
+# define mutex_init(m)      InitializeCriticalSection(m)
+# define mutex_destroy(m)   DeleteCriticalSection(m)
+# define mutex_lock(m)      EnterCriticalSection(m)
+# define mutex_unlock(m)    LeaveCriticalSection(m)
+# define cond_init(c)       InitializeConditionVariable(c)
+# define cond_destroy(c)
+# define cond_wait(c, m)    SleepConditionVariableCS(c, m, INFINITE)
+# define cond_signal(c)     WakeConditionVariable(c)
+# define cond_broadcast(c)  WakeAllConditionVariable(c)
+#else
+typedef pthread_t tpool_thread;
+typedef pthread_mutex_t tpool_mutex;
+typedef pthread_cond_t tpool_cond;
+# define mutex_init(m)      pthread_mutex_init(m, NULL)
+# define mutex_destroy(m)   pthread_mutex_destroy(m)
+# define mutex_lock(m)      pthread_mutex_lock(m)
+# define mutex_unlock(m)    pthread_mutex_unlock(m)
+# define cond_init(c)       pthread_cond_init(c, NULL)
+# define cond_destroy(c)    pthread_cond_destroy(c)
+# define cond_wait(c, m)    pthread_cond_wait(c, m)
+# define cond_signal(c)     pthread_cond_signal(c)
+# define cond_broadcast(c)  pthread_cond_broadcast(c)
+#endif
+#endif
+
+struct tpool
+{
+    /* set when the caller's scheduler runs the jobs */
+    NeAACDecScheduler scheduler;
+
+#ifdef USE_THREADS
+    tpool_mutex lock;
+    /* signalled for a new job and on shutdown */
+    tpool_cond work;
+    /* signalled when the last item of a job is finished */
+    tpool_cond done;
+
+    /* current job, items are handed out in order */
+    tpool_func func;
+    void *arg;
+    unsigned long count;
+    unsigned long next;
+    unsigned long pending;
+
+    uint8_t quit;
+    uint8_t workers;
+    tpool_thread thread[MAX_THREADS-1];
+#endif
+};
+
+#ifdef USE_THREADS
+static void tpool_work(tpool *pool)
+{
+    mutex_lock(&pool->lock);
+    for (;;)
+    {
+        unsigned long i;
+
+        while (!pool->quit && pool->next >= pool->count)
+            cond_wait(&pool->work, &pool->lock);
+        if (pool->quit)
+            break;
+
+        i = pool->next++;
+        mutex_unlock(&pool->lock);
+
+        pool->func(pool->arg, i);
+
+        mutex_lock(&pool->lock);
+        if (--pool->pending == 0)
+            cond_signal(&pool->done);
+    }
+    mutex_unlock(&pool->lock);
+}
+
+#ifdef _WIN32
+static unsigned __stdcall tpool_worker(void *arg)
+{
+    tpool_work((tpool*)arg);
+    return 0;
+}
+
+static uint8_t thread_create(tpool_thread *t, tpool *pool)
+{
+    *t = (HANDLE)_beginthreadex(NULL, TPOOL_STACK_SIZE, tpool_worker, pool, 0, NULL);
+    return (*t != 0);
+}
+
+static void thread_join(tpool_thread t)
+{
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+}
+#else
+static void *tpool_worker(void *arg)
+{
+    tpool_work((tpool*)arg);
+    return NULL;
+}
+
+static uint8_t thread_create(tpool_thread *t, tpool *pool)
+{
+    int ret;
+    pthread_attr_t attr;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, TPOOL_STACK_SIZE);
+    ret = pthread_create(t, &attr, tpool_worker, pool);
+    pthread_attr_destroy(&attr);
+
+    return (ret == 0);
+}
+
+static void thread_join(tpool_thread t)
+{
+    pthread_join(t, NULL);
+}
+#endif
+#endif
+
+tpool *tpool_init(allocator_info *alloc, uint8_t threads)
+{
+#ifdef USE_THREADS
+    uint8_t i;
+    tpool *pool;
+
+    if (threads < 2)
+        return NULL;
+    if (threads > MAX_THREADS)
+        threads = MAX_THREADS;
+
+    pool = (tpool*)faad_malloc(alloc, sizeof(tpool));
+    if (pool == NULL)
+        return NULL;
+    memset(pool, 0, sizeof(tpool));
+
+    mutex_init(&pool->lock);
+    cond_init(&pool->work);
+    cond_init(&pool->done);
+
+    /* the thread calling tpool_run does its share of the work */
+    for (i = 0; i < threads-1; i++)
+    {
+        if (!thread_create(&pool->thread[i], pool))
+            break;
+    }
+    pool->workers = i;
+
+    if (pool->workers == 0)
+    {
+        tpool_end(alloc, pool);
+        return NULL;
+    }
+
+    return pool;
+#else
+    /* built without thread support */
+    (void)alloc;
+    (void)threads;
+    return NULL;
+#endif
+}
+
+tpool *tpool_init_scheduler(allocator_info *alloc, const NeAACDecScheduler *scheduler)
+{
+    tpool *pool;
+
+    if (scheduler == NULL || scheduler->run == NULL)
+        return NULL;
+
+    pool = (tpool*)faad_malloc(alloc, sizeof(tpool));
+    if (pool == NULL)
+        return NULL;
+    memset(pool, 0, sizeof(tpool));
+
+    pool->scheduler = *scheduler;
+
+    return pool;
+}
+
+void tpool_end(allocator_info *alloc, tpool *pool)
+{
+    if (pool == NULL)
+        return;
+
+#ifdef USE_THREADS
+    if (pool->scheduler.run == NULL)
+    {
+        uint8_t i;
+
+        mutex_lock(&pool->lock);
+        pool->quit = 1;
+        cond_broadcast(&pool->work);
+        mutex_unlock(&pool->lock);
+
+        for (i = 0; i < pool->workers; i++)
+            thread_join(pool->thread[i]);
+
+        cond_destroy(&pool->done);
+        cond_destroy(&pool->work);
+        mutex_destroy(&pool->lock);
+    }
+#endif
+
+    faad_free(alloc, pool);
+}
+
+void tpool_run(tpool *pool, tpool_func func, void *arg, unsigned long count)
+{
+    unsigned long i;
+
+    if (pool == NULL || count < 2)
+    {
+        for (i = 0; i < count; i++)
+            func(arg, i);
+        return;
+    }
+
+    if (pool->scheduler.run != NULL)
+    {
+        pool->scheduler.run(pool->scheduler.user_data, func, arg, count);
+        return;
+    }
+
+#ifdef USE_THREADS
+    mutex_lock(&pool->lock);
+    pool->func = func;
+    pool->arg = arg;
+    pool->count = count;
+    pool->next = 0;
+    pool->pending = count;
+    cond_broadcast(&pool->work);
+
+    while (pool->next < pool->count)
+    {
+        i = pool->next++;
+        mutex_unlock(&pool->lock);
+
+        func(arg, i);
+
+        mutex_lock(&pool->lock);
+        pool->pending--;
+    }
+
+    while (pool->pending > 0)
+        cond_wait(&pool->done, &pool->lock);
+    mutex_unlock(&pool->lock);
+#endif
+}
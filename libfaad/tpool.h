@@ -0,0 +1,56 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**
+** $Id: tpool.h,v 1.0 $
+**/
+
+#ifndef __TPOOL_H__
+#define __TPOOL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* worker threads of one decoder, the caller of tpool_run is one of them */
+#define MAX_THREADS 16
+
+/* runs the parallel parts of a frame, on worker threads owned by the
+   decoder or on a scheduler supplied by the caller */
+typedef struct tpool tpool;
+
+/* runs func(arg, i) for i = 0..count-1 */
+typedef void (*tpool_func)(void *arg, unsigned long i);
+
+tpool *tpool_init(allocator_info *alloc, uint8_t threads);
+tpool *tpool_init_scheduler(allocator_info *alloc, const NeAACDecScheduler *scheduler);
+void tpool_end(allocator_info *alloc, tpool *pool);
+void tpool_run(tpool *pool, tpool_func func, void *arg, unsigned long count);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,388 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**/
+
+/* Generator of random but valid AAC LC streams for the tests that decode
+ * whole frames. The frames are raw data blocks at 48 kHz for channel
+ * configurations 1 to 7, with long and short windows, M/S stereo and
+ * spectral data in all spectral codebooks. The Huffman codewords are
+ * taken from random bits through the decoder's own Huffman functions.
+ * Needs common.h and structs.h.
+ */
+
+#ifndef __AAC_STREAM_H__
+#define __AAC_STREAM_H__
+
+#include "syntax.h"
+#include "bits.h"
+#include "huffman.h"
+
+/* the largest frame of a 7.1 stream */
+#define AAC_STREAM_MAX_FRAME (FAAD_MIN_STREAMSIZE*8)
+
+typedef struct
+{
+    uint8_t *data;
+    uint32_t size;
+    uint32_t bits;
+} stream_writer;
+
+typedef struct
+{
+    uint8_t window_sequence;
+    uint8_t max_sfb;
+    uint8_t scale_factor_grouping;
+    uint8_t num_window_groups;
+    uint8_t window_group_length[8];
+} stream_ics;
+
+static const uint16_t stream_swb_long[] =
+{
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 48, 56, 64, 72,
+    80, 88, 96, 108, 120, 132, 144, 160, 176, 196, 216, 240, 264, 292,
+    320, 352, 384, 416, 448, 480, 512, 544, 576, 608, 640, 672, 704, 736,
+    768, 800, 832, 864, 896, 928, 1024
+};
+
+static const uint16_t stream_swb_short[] =
+{
+    0, 4, 8, 12, 16, 20, 28, 36, 44, 56, 68, 80, 96, 112, 128
+};
+
+static uint32_t stream_state = 1;
+
+static void stream_seed(uint32_t seed)
+{
+    stream_state = seed ? seed : 1;
+}
+
+/* xorshift32 */
+static uint32_t stream_random(void)
+{
+    stream_state ^= stream_state << 13;
+    stream_state ^= stream_state >> 17;
+    stream_state ^= stream_state << 5;
+    return stream_state;
+}
+
+static void put_bits(stream_writer *w, uint32_t value, uint8_t n)
+{
+    while (n-- > 0)
+    {
+        if ((w->bits >> 3) < w->size)
+        {
+            uint8_t mask = (uint8_t)(0x80 >> (w->bits & 7));
+
+            if ((value >> n) & 1)
+                w->data[w->bits >> 3] |= mask;
+            else
+                w->data[w->bits >> 3] &= ~mask;
+        }
+        w->bits++;
+    }
+}
+
+/* copies the first n bits of random */
+static void put_random_bits(stream_writer *w, const uint8_t *random, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+        put_bits(w, (random[i >> 3] >> (7 - (i & 7))) & 1, 1);
+}
+
+/* len spectral values in codebook cb; the random bits are decoded as a
+ * section and the bits the decoder took are written */
+static void put_spectral_section(stream_writer *w, uint8_t cb, uint16_t len)
+{
+    static uint8_t random[4*1024 + 16];
+    int16_t sp[1024];
+    uint32_t n = 4*len + 16;
+    uint32_t i;
+    bitfile ld;
+
+    for (;;)
+    {
+        uint8_t err;
+
+        for (i = 0; i < n; i++)
+            random[i] = (uint8_t)stream_random();
+
+        faad_initbits(&ld, random, n);
+        err = huffman_spectral_section(cb, &ld, sp, len);
+        if (!err && !ld.error)
+            break;
+        faad_endbits(&ld);
+    }
+
+    put_random_bits(w, random, faad_get_processed_bits(&ld));
+    faad_endbits(&ld);
+}
+
+/* a small random scale factor step that keeps *sf within 60..200 */
+static void put_scale_factor(stream_writer *w, int16_t *sf)
+{
+    uint8_t random[4];
+    uint8_t i;
+    int16_t t;
+    bitfile ld;
+
+    for (;;)
+    {
+        for (i = 0; i < 4; i++)
+            random[i] = (uint8_t)stream_random();
+
+        faad_initbits(&ld, random, 4);
+        t = huffman_scale_factor(&ld) - 60;
+        if (t >= -4 && t <= 4 && *sf + t >= 60 && *sf + t <= 200)
+            break;
+        faad_endbits(&ld);
+    }
+
+    put_random_bits(w, random, faad_get_processed_bits(&ld));
+    faad_endbits(&ld);
+    *sf += t;
+}
+
+static void random_ics(stream_ics *ics, uint8_t lfe)
+{
+    uint8_t g;
+
+    ics->window_sequence = lfe ? ONLY_LONG_SEQUENCE : stream_random() % 4;
+    if (ics->window_sequence == EIGHT_SHORT_SEQUENCE)
+    {
+        ics->max_sfb = stream_random() % 15;
+        ics->scale_factor_grouping = stream_random() & 0x7F;
+        ics->num_window_groups = 1;
+        ics->window_group_length[0] = 1;
+        for (g = 0; g < 7; g++)
+        {
+            if (ics->scale_factor_grouping & (0x40 >> g))
+            {
+                ics->window_group_length[ics->num_window_groups-1]++;
+            } else {
+                ics->num_window_groups++;
+                ics->window_group_length[ics->num_window_groups-1] = 1;
+            }
+        }
+    } else {
+        ics->max_sfb = stream_random() % (lfe ? 13 : 41);
+        ics->num_window_groups = 1;
+        ics->window_group_length[0] = 1;
+    }
+}
+
+static void put_ics_info(stream_writer *w, const stream_ics *ics)
+{
+    put_bits(w, 0, 1); /* ics_reserved_bit */
+    put_bits(w, ics->window_sequence, 2);
+    put_bits(w, stream_random() & 1, 1); /* window_shape */
+    if (ics->window_sequence == EIGHT_SHORT_SEQUENCE)
+    {
+        put_bits(w, ics->max_sfb, 4);
+        put_bits(w, ics->scale_factor_grouping, 7);
+    } else {
+        put_bits(w, ics->max_sfb, 6);
+        put_bits(w, 0, 1); /* predictor_data_present */
+    }
+}
+
+static void put_ics(stream_writer *w, const stream_ics *ics, uint8_t common_window)
+{
+    uint8_t sfb_cb[8][MAX_SFB];
+    uint8_t sect_start[8][MAX_SFB], sect_end[8][MAX_SFB], num_sec[8];
+    uint8_t short_window = (ics->window_sequence == EIGHT_SHORT_SEQUENCE);
+    uint8_t sect_bits = short_window ? 3 : 5;
+    uint8_t sect_esc_val = (1 << sect_bits) - 1;
+    const uint16_t *swb = short_window ? stream_swb_short : stream_swb_long;
+    uint8_t g, i, sfb;
+    int16_t sf = 140 + stream_random() % 24;
+
+    put_bits(w, sf, 8); /* global_gain */
+    if (!common_window)
+        put_ics_info(w, ics);
+
+    /* section_data() */
+    for (g = 0; g < ics->num_window_groups; g++)
+    {
+        uint8_t k = 0;
+
+        num_sec[g] = 0;
+        while (k < ics->max_sfb)
+        {
+            uint8_t cb = stream_random() % 12;
+            uint8_t len = 1 + stream_random() % (ics->max_sfb - k);
+            uint8_t left = len;
+
+            put_bits(w, cb, 4);
+            while (left >= sect_esc_val)
+            {
+                put_bits(w, sect_esc_val, sect_bits);
+                left -= sect_esc_val;
+            }
+            put_bits(w, left, sect_bits);
+
+            sect_start[g][num_sec[g]] = k;
+            sect_end[g][num_sec[g]] = k + len;
+            num_sec[g]++;
+            for (sfb = k; sfb < k + len; sfb++)
+                sfb_cb[g][sfb] = cb;
+            k += len;
+        }
+    }
+
+    /* scale_factor_data() */
+    for (g = 0; g < ics->num_window_groups; g++)
+    {
+        for (sfb = 0; sfb < ics->max_sfb; sfb++)
+        {
+            if (sfb_cb[g][sfb] != ZERO_HCB)
+                put_scale_factor(w, &sf);
+        }
+    }
+
+    put_bits(w, 0, 1); /* pulse_data_present */
+    put_bits(w, 0, 1); /* tns_data_present */
+    put_bits(w, 0, 1); /* gain_control_data_present */
+
+    /* spectral_data() */
+    for (g = 0; g < ics->num_window_groups; g++)
+    {
+        for (i = 0; i < num_sec[g]; i++)
+        {
+            uint8_t cb = sfb_cb[g][sect_start[g][i]];
+
+            if (cb != ZERO_HCB)
+            {
+                put_spectral_section(w, cb, ics->window_group_length[g] *
+                    (swb[sect_end[g][i]] - swb[sect_start[g][i]]));
+            }
+        }
+    }
+}
+
+static void put_single_element(stream_writer *w, uint8_t id_syn_ele, uint8_t tag)
+{
+    stream_ics ics;
+
+    put_bits(w, id_syn_ele, LEN_SE_ID);
+    put_bits(w, tag, LEN_TAG);
+    random_ics(&ics, id_syn_ele == ID_LFE);
+    put_ics(w, &ics, 0);
+}
+
+static void put_channel_pair(stream_writer *w, uint8_t tag)
+{
+    stream_ics ics1, ics2;
+    uint8_t common_window = stream_random() & 1;
+
+    put_bits(w, ID_CPE, LEN_SE_ID);
+    put_bits(w, tag, LEN_TAG);
+    put_bits(w, common_window, 1);
+
+    random_ics(&ics1, 0);
+    if (common_window)
+    {
+        uint8_t ms_mask_present = stream_random() % 3;
+        uint8_t g, sfb;
+
+        put_ics_info(w, &ics1);
+        put_bits(w, ms_mask_present, 2);
+        if (ms_mask_present == 1)
+        {
+            for (g = 0; g < ics1.num_window_groups; g++)
+            {
+                for (sfb = 0; sfb < ics1.max_sfb; sfb++)
+                    put_bits(w, stream_random() & 1, 1);
+            }
+        }
+        ics2 = ics1;
+    } else {
+        random_ics(&ics2, 0);
+    }
+
+    put_ics(w, &ics1, common_window);
+    put_ics(w, &ics2, common_window);
+}
+
+/* AudioSpecificConfig of a 48 kHz AAC LC stream, 2 bytes */
+static void aac_stream_config(uint8_t *asc, uint8_t channel_config)
+{
+    stream_writer w;
+
+    w.data = asc;
+    w.size = 2;
+    w.bits = 0;
+    put_bits(&w, LC, 5);
+    put_bits(&w, 3, 4); /* 48000 Hz */
+    put_bits(&w, channel_config, 4);
+    put_bits(&w, 0, 3); /* frameLengthFlag, dependsOnCoreCoder, extensionFlag */
+}
+
+/* one raw data block with the elements of channel configuration 1 to 7,
+ * returns its size in bytes */
+static uint32_t aac_stream_frame(uint8_t *frame, uint32_t size, uint8_t channel_config)
+{
+    static const char *elements[] =
+    {
+        "", "S", "C", "SC", "SCS", "SCC", "SCCL", "SCCCL"
+    };
+    stream_writer w;
+
+    w.data = frame;
+    w.size = size;
+
+    /* frames over the 6144 bits per channel limit are generated again */
+    for (;;)
+    {
+        const char *e;
+        uint8_t sce = 0, cpe = 0, lfe = 0;
+
+        w.bits = 0;
+        for (e = elements[channel_config]; *e; e++)
+        {
+            if (*e == 'S')
+                put_single_element(&w, ID_SCE, sce++);
+            else if (*e == 'C')
+                put_channel_pair(&w, cpe++);
+            else
+                put_single_element(&w, ID_LFE, lfe++);
+        }
+        put_bits(&w, ID_END, LEN_SE_ID);
+        put_bits(&w, 0, (8 - (w.bits & 7)) & 7);
+
+        if (w.bits <= 8*FAAD_MIN_STREAMSIZE*(channel_config == 7 ? 8 : channel_config) &&
+            w.bits <= 8*size)
+        {
+            break;
+        }
+    }
+
+    return w.bits >> 3;
+}
+
+#endif
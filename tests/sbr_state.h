@@ -0,0 +1,177 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**/
+
+/* Random SBR states for the tests of the SBR HF generation and
+ * adjustment. Needs common.h, structs.h, sbr_dec.h and sbr_syntax.h.
+ */
+
+#ifndef __SBR_STATE_H__
+#define __SBR_STATE_H__
+
+#ifdef SBR_DEC
+static real_t random_real(real_t min, real_t max)
+{
+    return min + (max - min) * ((real_t)rand() / RAND_MAX);
+}
+
+/* a random but valid set of SBR frequency tables, envelopes and
+ * QMF input for channel 0 */
+static void sbr_random_state(sbr_info *sbr, real_t *G_temp, real_t *Q_temp)
+{
+    uint8_t i, k, l, b;
+    uint8_t kx, M, N_high, N_low, nq, n, left;
+
+    kx = 8 + rand() % 24;
+    M = 4 + rand() % 45;
+    if (kx + M > 64)
+        M = 64 - kx;
+    sbr->kx = kx;
+    sbr->M = M;
+    sbr->tHFAdj = T_HFADJ;
+    sbr->tHFGen = T_HFGEN;
+    sbr->numTimeSlotsRate = RATE * NO_TIME_SLOTS;
+
+    /* patches covering the M high band subbands */
+    sbr->noPatches = 0;
+    for (left = M; left > 0; left -= n)
+    {
+        n = 1 + rand() % (kx - 1);
+        if (n > left)
+            n = left;
+        sbr->patchNoSubbands[sbr->noPatches] = n;
+        sbr->patchStartSubband[sbr->noPatches] = rand() % (kx - n + 1);
+        sbr->noPatches++;
+    }
+
+    /* frequency band tables */
+    k = kx;
+    N_high = 0;
+    sbr->f_table_res[HI_RES][0] = kx;
+    while (k < kx + M)
+    {
+        k += 1 + rand() % 3;
+        if (k > kx + M)
+            k = kx + M;
+        sbr->f_table_res[HI_RES][++N_high] = k;
+    }
+    N_low = N_high/2 + (N_high & 1);
+    sbr->N_high = sbr->n[HI_RES] = N_high;
+    sbr->N_low = sbr->n[LO_RES] = N_low;
+    sbr->f_table_res[LO_RES][0] = kx;
+    for (i = 1; i <= N_low; i++)
+        sbr->f_table_res[LO_RES][i] = sbr->f_table_res[HI_RES][2*i - (N_high & 1)];
+
+    nq = 1 + rand() % 3;
+    if (nq > M)
+        nq = M;
+    sbr->N_Q = nq;
+    for (i = 0; i <= nq; i++)
+        sbr->f_table_noise[i] = kx + (M * i) / nq;
+    for (k = kx; k < kx + M; k++)
+    {
+        for (b = 0; b < nq; b++)
+        {
+            if (k >= sbr->f_table_noise[b] && k < sbr->f_table_noise[b+1])
+                sbr->table_map_k_to_g[k] = b;
+        }
+    }
+    for (b = 0; b < nq; b++)
+    {
+        sbr->bs_invf_mode[0][b] = rand() % 4;
+        sbr->bs_invf_mode_prev[0][b] = rand() % 4;
+        sbr->bwArray_prev[0][b] = random_real(0, 1);
+    }
+
+    n = 1 + rand() % 6;
+    sbr->bs_limiter_bands = rand() % 4;
+    sbr->bs_limiter_gains = rand() % 4;
+    sbr->N_L[sbr->bs_limiter_bands] = n;
+    for (i = 0; i <= n; i++)
+        sbr->f_table_lim[sbr->bs_limiter_bands][i] = (M * i) / n;
+
+    /* envelopes and noise floors */
+    sbr->L_E[0] = 1 + rand() % 4;
+    sbr->t_E[0][0] = rand() % 3;
+    for (l = 1; l <= sbr->L_E[0]; l++)
+        sbr->t_E[0][l] = sbr->t_E[0][l-1] + 1 + rand() % 8;
+    if (sbr->t_E[0][sbr->L_E[0]] > 32)
+        sbr->t_E[0][sbr->L_E[0]] = 32;
+    for (l = 0; l < sbr->L_E[0]; l++)
+        sbr->f[0][l] = rand() % 2;
+    sbr->t_Q[0][0] = sbr->t_E[0][0];
+    sbr->t_Q[0][1] = sbr->t_Q[0][2] = sbr->t_E[0][sbr->L_E[0]];
+    if (sbr->L_E[0] > 1 && rand() % 2)
+        sbr->t_Q[0][1] = sbr->t_E[0][1];
+
+    for (b = 0; b < 64; b++)
+    {
+        for (l = 0; l < MAX_L_E; l++)
+            sbr->E_orig[0][b][l] = random_real(0, 1e6);
+        for (l = 0; l < 2; l++)
+        {
+            sbr->Q_div[0][b][l] = random_real(0, 1);
+            sbr->Q_div2[0][b][l] = random_real(0, 1);
+        }
+        sbr->bs_add_harmonic[0][b] = (rand() % 4) == 0;
+        sbr->bs_add_harmonic_prev[0][b] = rand() % 2;
+    }
+    sbr->bs_add_harmonic_flag_prev[0] = rand() % 2;
+    sbr->bs_frame_class[0] = rand() % 4;
+    sbr->bs_pointer[0] = rand() % (sbr->L_E[0] + 1);
+    sbr->prevEnvIsShort[0] = (rand() % 3) - 1;
+    sbr->bs_interpol_freq = rand() % 2;
+    sbr->bs_smoothing_mode = rand() % 2;
+    sbr->Reset = rand() % 2;
+
+    /* gain smoothing history */
+    sbr->GQ_ringbuf_index[0] = rand() % 5;
+    sbr->index_noise_prev[0] = rand() % 512;
+    sbr->psi_is_prev[0] = rand() % 4;
+    for (i = 0; i < 5; i++)
+    {
+        sbr->G_temp_prev[0][i] = G_temp + i*64;
+        sbr->Q_temp_prev[0][i] = Q_temp + i*64;
+        for (k = 0; k < 64; k++)
+        {
+            sbr->G_temp_prev[0][i][k] = random_real(0, 10);
+            sbr->Q_temp_prev[0][i][k] = random_real(0, 10);
+        }
+    }
+
+    for (i = 0; i < MAX_NTSRHFG; i++)
+    {
+        for (k = 0; k < 64; k++)
+        {
+            QMF_RE_AT(sbr->Xsbr[0][i], k) = random_real(-1000, 1000);
+            QMF_IM_AT(sbr->Xsbr[0][i], k) = random_real(-1000, 1000);
+        }
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,127 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**/
+
+/* Checks the SSE passes of the complex FFT against the scalar ones. Both
+ * use the same operation order, so the results have to be identical.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "cfft.h"
+
+#define TEST_SKIPPED 77
+#define RUNS 16
+
+#ifdef USE_SSE
+static int check_size(uint16_t n)
+{
+    ALIGN complex_t in[MAX_CFFT_SIZE];
+    ALIGN complex_t scalar[MAX_CFFT_SIZE];
+    ALIGN complex_t sse[MAX_CFFT_SIZE];
+    cfft_info *cfft;
+    int errors = 0;
+    uint16_t i;
+    int run, dir;
+
+    cfft = cffti(NULL, n);
+    if (cfft == NULL)
+    {
+        printf("cffti(%d) failed\n", n);
+        return 1;
+    }
+
+    for (run = 0; run < RUNS; run++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            RE(in[i]) = (real_t)(rand() - RAND_MAX/2) / (RAND_MAX/2);
+            IM(in[i]) = (real_t)(rand() - RAND_MAX/2) / (RAND_MAX/2);
+        }
+
+        for (dir = 0; dir < 2; dir++)
+        {
+            memcpy(scalar, in, n*sizeof(complex_t));
+            memcpy(sse, in, n*sizeof(complex_t));
+
+            cfft->sse = 0;
+            if (dir == 0)
+                cfftf(cfft, scalar);
+            else
+                cfftb(cfft, scalar);
+
+            cfft->sse = 1;
+            if (dir == 0)
+                cfftf(cfft, sse);
+            else
+                cfftb(cfft, sse);
+
+            for (i = 0; i < n; i++)
+            {
+                if (RE(scalar[i]) != RE(sse[i]) || IM(scalar[i]) != IM(sse[i]))
+                {
+                    printf("n %d %s run %d bin %d: scalar (%g, %g) sse (%g, %g)\n",
+                        n, dir ? "backward" : "forward", run, i,
+                        RE(scalar[i]), IM(scalar[i]), RE(sse[i]), IM(sse[i]));
+                    errors++;
+                    break;
+                }
+            }
+        }
+    }
+
+    cfftu(NULL, cfft);
+
+    return errors;
+}
+#endif
+
+int main(void)
+{
+#ifdef USE_SSE
+    static const uint16_t sizes[] = { 64, 512, 60, 480 };
+    int errors = 0;
+    unsigned int i;
+
+    if (!cpu_has_sse())
+        return TEST_SKIPPED;
+
+    srand(1);
+    for (i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++)
+        errors += check_size(sizes[i]);
+
+    if (errors)
+        return 1;
+    printf("SSE and scalar FFT match\n");
+    return 0;
+#else
+    return TEST_SKIPPED;
+#endif
+}
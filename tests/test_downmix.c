@@ -0,0 +1,298 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**/
+
+
+/* Checks NeAACDecSetDownmixMatrix. Generated 5.1 and 7.1 streams are
+ * decoded with a random 6 to 3 and 8 to 3 matrix, and the float output
+ * has to match the matrix applied to the float output without a downmix.
+ * Matrices with too many output or no input channels have to be rejected,
+ * and the SSE2 conversion has to give the same output as the scalar one
+ * in every output format.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "common.h"
+#include "structs.h"
+#include "aac_stream.h"
+
+#define FRAMES 10
+
+static uint8_t stream[FRAMES][AAC_STREAM_MAX_FRAME];
+static unsigned long stream_size[FRAMES];
+static uint8_t asc[2];
+
+/* output of every frame, 8 channels of 32 bit samples at most */
+static uint8_t pcm[FRAMES][8*1024*4];
+static unsigned long pcm_samples[FRAMES];
+
+static const unsigned char sample_size[] = { 0, 2, 4, 4, 4 };
+
+static void random_matrix(float *matrix, int in_channels, int out_channels)
+{
+    int i;
+
+    /* a few zero gains, which the decoder leaves out of the mix */
+    for (i = 0; i < in_channels*out_channels; i++)
+    {
+        if (stream_random() % 4 == 0)
+            matrix[i] = 0.0f;
+        else
+            matrix[i] = (float)((int32_t)(stream_random() % 2001) - 1000) / 1000.0f;
+    }
+}
+
+/* decodes the stream, sse2 < 0 keeps the CPU detection of the decoder */
+static int decode(const float *matrix, int in_channels, int out_channels,
+                  unsigned char format, int sse2)
+{
+    NeAACDecHandle hDecoder = NeAACDecOpen();
+    NeAACDecConfigurationPtr config;
+    NeAACDecFrameInfo info;
+    unsigned long samplerate;
+    unsigned char channels;
+    void *samples;
+    int i;
+
+    if (hDecoder == NULL)
+        return 1;
+
+    config = NeAACDecGetCurrentConfiguration(hDecoder);
+    config->outputFormat = format;
+    NeAACDecSetConfiguration(hDecoder, config);
+    if (matrix != NULL && !NeAACDecSetDownmixMatrix(hDecoder, matrix, in_channels, out_channels))
+    {
+        printf("%d to %d matrix rejected\n", in_channels, out_channels);
+        NeAACDecClose(hDecoder);
+        return 1;
+    }
+    if (NeAACDecInit2(hDecoder, asc, sizeof(asc), &samplerate, &channels) < 0)
+    {
+        printf("decoder setup failed\n");
+        NeAACDecClose(hDecoder);
+        return 1;
+    }
+#ifdef USE_SSE
+    if (sse2 >= 0)
+        ((NeAACDecStruct*)hDecoder)->sse2 = (uint8_t)sse2;
+#else
+    (void)sse2;
+#endif
+
+    for (i = 0; i < FRAMES; i++)
+    {
+        samples = NeAACDecDecode(hDecoder, &info, stream[i], stream_size[i]);
+        if (info.error)
+        {
+            printf("frame %d: %s\n", i, NeAACDecGetErrorMessage(info.error));
+            NeAACDecClose(hDecoder);
+            return 1;
+        }
+        if (info.samples && info.channels != out_channels)
+        {
+            printf("frame %d: %d channels output instead of %d\n", i,
+                info.channels, out_channels);
+            NeAACDecClose(hDecoder);
+            return 1;
+        }
+        pcm_samples[i] = info.samples;
+        memcpy(pcm[i], samples, info.samples * sample_size[format]);
+    }
+
+    NeAACDecClose(hDecoder);
+    return 0;
+}
+
+static void make_stream(uint8_t channel_config)
+{
+    int i;
+
+    aac_stream_config(asc, channel_config);
+    for (i = 0; i < FRAMES; i++)
+        stream_size[i] = aac_stream_frame(stream[i], sizeof(stream[i]), channel_config);
+}
+
+/* the downmix of the float output against the matrix applied to the
+ * output without a downmix */
+static int check_mix(uint8_t channel_config, int in_channels, int out_channels)
+{
+    static float input[FRAMES][8*1024];
+    static unsigned long input_samples[FRAMES];
+    float matrix[8*8];
+    unsigned long n;
+    int i, o, c;
+
+    make_stream(channel_config);
+    random_matrix(matrix, in_channels, out_channels);
+
+    if (decode(NULL, in_channels, in_channels, FAAD_FMT_FLOAT, -1))
+        return 1;
+    memcpy(input, pcm, sizeof(input));
+    memcpy(input_samples, pcm_samples, sizeof(input_samples));
+    if (decode(matrix, in_channels, out_channels, FAAD_FMT_FLOAT, -1))
+        return 1;
+
+    for (i = 0; i < FRAMES; i++)
+    {
+        const float *out = (const float*)pcm[i];
+
+        if (pcm_samples[i] / out_channels != input_samples[i] / in_channels)
+        {
+            printf("%d to %d, frame %d: %lu samples output\n", in_channels,
+                out_channels, i, pcm_samples[i]);
+            return 1;
+        }
+        for (n = 0; n < input_samples[i] / in_channels; n++)
+        {
+            for (o = 0; o < out_channels; o++)
+            {
+                double ref = 0.0, mag = 0.0;
+
+                for (c = 0; c < in_channels; c++)
+                {
+                    double x = matrix[o*in_channels + c] * (double)input[i][n*in_channels + c];
+                    ref += x;
+                    mag += fabs(x);
+                }
+                /* the decoder sums in single precision */
+                if (fabs(out[n*out_channels + o] - ref) > 1e-5*mag + 1e-9)
+                {
+                    printf("%d to %d, frame %d, sample %lu, channel %d: %g instead of %g\n",
+                        in_channels, out_channels, i, n, o,
+                        out[n*out_channels + o], ref);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int check_rejected(void)
+{
+    NeAACDecHandle hDecoder = NeAACDecOpen();
+    float matrix[8*9];
+    int errors = 0;
+
+    if (hDecoder == NULL)
+        return 1;
+
+    memset(matrix, 0, sizeof(matrix));
+    if (NeAACDecSetDownmixMatrix(hDecoder, matrix, 6, 9))
+    {
+        printf("9 output channels accepted\n");
+        errors++;
+    }
+    if (NeAACDecSetDownmixMatrix(hDecoder, matrix, 0, 3))
+    {
+        printf("0 input channels accepted\n");
+        errors++;
+    }
+    if (!NeAACDecSetDownmixMatrix(hDecoder, matrix, 8, 8) ||
+        !NeAACDecSetDownmixMatrix(hDecoder, NULL, 0, 0))
+    {
+        printf("valid matrix rejected\n");
+        errors++;
+    }
+
+    NeAACDecClose(hDecoder);
+    return errors;
+}
+
+#ifdef USE_SSE
+/* the SSE2 conversion against the scalar one, every output format with
+ * and without a downmix */
+static int check_sse2(uint8_t channel_config, int in_channels)
+{
+    static uint8_t scalar[FRAMES][8*1024*4];
+    static unsigned long scalar_samples[FRAMES];
+    static const int outputs[] = { 0, 1, 2, 3, 6, 8 };
+    float matrix[8*8];
+    unsigned char format;
+    unsigned int k;
+    int i;
+
+    make_stream(channel_config);
+
+    for (k = 0; k < sizeof(outputs)/sizeof(outputs[0]); k++)
+    {
+        int out_channels = outputs[k] ? outputs[k] : in_channels;
+
+        random_matrix(matrix, in_channels, out_channels);
+        for (format = FAAD_FMT_16BIT; format <= FAAD_FMT_FLOAT; format++)
+        {
+            if (decode(outputs[k] ? matrix : NULL, in_channels, out_channels, format, 0))
+                return 1;
+            memcpy(scalar, pcm, sizeof(scalar));
+            memcpy(scalar_samples, pcm_samples, sizeof(scalar_samples));
+            if (decode(outputs[k] ? matrix : NULL, in_channels, out_channels, format, 1))
+                return 1;
+
+            for (i = 0; i < FRAMES; i++)
+            {
+                if (pcm_samples[i] != scalar_samples[i] ||
+                    memcmp(pcm[i], scalar[i], pcm_samples[i] * sample_size[format]))
+                {
+                    printf("%d to %d, format %d, frame %d: SSE2 output differs\n",
+                        in_channels, out_channels, format, i);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+#endif
+
+int main(void)
+{
+    int errors = 0;
+
+    stream_seed(1);
+
+    errors += check_rejected();
+    errors += check_mix(6, 6, 3);
+    errors += check_mix(7, 8, 3);
+#ifdef USE_SSE
+    if (cpu_has_sse2())
+    {
+        errors += check_sse2(6, 6);
+        errors += check_sse2(7, 8);
+    }
+#endif
+
+    if (errors)
+        return 1;
+    printf("downmix output matches the matrix\n");
+    return 0;
+}
@@ -0,0 +1,210 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**/
+
+/* Checks the SSE code of the PS decoder (hybrid analysis filters,
+ * transient detection and allpass filtering of the decorrelator, and the
+ * mixing) against the scalar code. Both do the same float operations in
+ * the same order, so the results have to be identical. Several frames are
+ * run through the same decoders, so the delay lines and the smoothing
+ * state are compared as well.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "structs.h"
+#include "sbr_dec.h"
+#include "sbr_syntax.h"
+#include "ps_dec.h"
+
+#define TEST_SKIPPED 77
+#define TRIALS 200
+#define FRAMES 6
+
+#if defined(USE_SSE) && defined(PS_DEC)
+static real_t random_real(real_t min, real_t max)
+{
+    return min + (max - min) * ((real_t)rand() / RAND_MAX);
+}
+
+/* random PS parameters, with any of IID, ICC and IPD/OPD in use */
+static void ps_random_params(ps_info *ps, uint8_t use34)
+{
+    uint8_t env, b;
+
+    ps->ps_data_available = 1;
+    ps->use34hybrid_bands = use34;
+    ps->enable_iid = (rand() % 4) != 0;
+    ps->enable_icc = (rand() % 4) != 0;
+    ps->enable_ipdopd = rand() % 2;
+    ps->iid_mode = use34 ? ((rand() % 2) ? 2 : 5) : ((rand() % 2) ? 1 : 4);
+    ps->icc_mode = use34 ? ((rand() % 2) ? 2 : 5) : ((rand() % 2) ? 1 : 4);
+    ps->nr_iid_par = ps->nr_icc_par = use34 ? 34 : 20;
+    ps->nr_ipdopd_par = use34 ? 17 : 11;
+    ps->frame_class = 0;
+    ps->num_env = 1 + rand() % 4;
+    for (env = 0; env < ps->num_env; env++)
+    {
+        ps->iid_dt[env] = ps->icc_dt[env] = rand() % 2;
+        ps->ipd_dt[env] = ps->opd_dt[env] = rand() % 2;
+        for (b = 0; b < 34; b++)
+        {
+            ps->iid_index[env][b] = rand() % 5 - 2;
+            ps->icc_index[env][b] = rand() % 3;
+        }
+        for (b = 0; b < 17; b++)
+        {
+            ps->ipd_index[env][b] = rand() % 8;
+            ps->opd_index[env][b] = rand() % 8;
+        }
+    }
+}
+
+static int compare_rows(const char *what, int trial, int frame, uint8_t slots,
+                        qmf_row_t *scalar, qmf_row_t *sse)
+{
+    uint8_t n, k;
+
+    for (n = 0; n < slots; n++)
+    {
+        for (k = 0; k < 64; k++)
+        {
+            if (QMF_RE_AT(scalar[n], k) != QMF_RE_AT(sse[n], k) ||
+                QMF_IM_AT(scalar[n], k) != QMF_IM_AT(sse[n], k))
+            {
+                printf("%s, trial %d frame %d, slot %d band %d: scalar (%g, %g) sse (%g, %g)\n",
+                    what, trial, frame, n, k,
+                    QMF_RE_AT(scalar[n], k), QMF_IM_AT(scalar[n], k),
+                    QMF_RE_AT(sse[n], k), QMF_IM_AT(sse[n], k));
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int compare_state(int trial, int frame, ps_info *scalar, ps_info *sse)
+{
+    if (memcmp(scalar->delay_Qmf, sse->delay_Qmf, sizeof(scalar->delay_Qmf)) ||
+        memcmp(scalar->delay_SubQmf, sse->delay_SubQmf, sizeof(scalar->delay_SubQmf)) ||
+        memcmp(scalar->delay_Qmf_ser, sse->delay_Qmf_ser, sizeof(scalar->delay_Qmf_ser)) ||
+        memcmp(scalar->delay_SubQmf_ser, sse->delay_SubQmf_ser, sizeof(scalar->delay_SubQmf_ser)) ||
+        memcmp(scalar->P_PeakDecayNrg, sse->P_PeakDecayNrg, sizeof(scalar->P_PeakDecayNrg)) ||
+        memcmp(scalar->P_prev, sse->P_prev, sizeof(scalar->P_prev)) ||
+        memcmp(scalar->P_SmoothPeakDecayDiffNrg_prev, sse->P_SmoothPeakDecayDiffNrg_prev,
+               sizeof(scalar->P_SmoothPeakDecayDiffNrg_prev)) ||
+        memcmp(scalar->h11_prev, sse->h11_prev, sizeof(scalar->h11_prev)) ||
+        memcmp(scalar->h12_prev, sse->h12_prev, sizeof(scalar->h12_prev)) ||
+        memcmp(scalar->h21_prev, sse->h21_prev, sizeof(scalar->h21_prev)) ||
+        memcmp(scalar->h22_prev, sse->h22_prev, sizeof(scalar->h22_prev)) ||
+        scalar->saved_delay != sse->saved_delay)
+    {
+        printf("trial %d frame %d: decoder state differs\n", trial, frame);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int check_ps(void)
+{
+    static qmf_row_t left_scalar[38], right_scalar[38], left_sse[38], right_sse[38];
+    int errors = 0;
+    int trial, frame;
+    uint8_t n, k;
+
+    for (trial = 0; trial < TRIALS && !errors; trial++)
+    {
+        uint8_t slots = (trial & 1) ? RATE * NO_TIME_SLOTS : RATE * NO_TIME_SLOTS_960;
+        uint8_t use34 = (trial >> 1) & 1;
+        ps_info *scalar = ps_init(NULL, 3 + trial % 6, slots, 0);
+        ps_info *sse = ps_init(NULL, 3 + trial % 6, slots, 0);
+
+        if (scalar == NULL || sse == NULL)
+        {
+            printf("ps_init failed\n");
+            return 1;
+        }
+        scalar->sse = 0;
+        sse->sse = 1;
+
+        for (frame = 0; frame < FRAMES && !errors; frame++)
+        {
+            srand(trial * 100 + frame + 1);
+            ps_random_params(scalar, use34);
+            srand(trial * 100 + frame + 1);
+            ps_random_params(sse, use34);
+
+            /* some loud slots to trigger the transient detection */
+            for (n = 0; n < 38; n++)
+            {
+                real_t gain = (rand() % 8) ? 1 : 50;
+
+                for (k = 0; k < 64; k++)
+                {
+                    QMF_RE_AT(left_scalar[n], k) = gain * random_real(-1e4, 1e4);
+                    QMF_IM_AT(left_scalar[n], k) = random_real(-1e4, 1e4);
+                }
+            }
+            memcpy(left_sse, left_scalar, sizeof(left_scalar));
+            memset(right_scalar, 0, sizeof(right_scalar));
+            memset(right_sse, 0, sizeof(right_sse));
+
+            ps_decode(scalar, left_scalar, right_scalar);
+            ps_decode(sse, left_sse, right_sse);
+
+            errors += compare_rows("left", trial, frame, slots, left_scalar, left_sse);
+            errors += compare_rows("right", trial, frame, slots, right_scalar, right_sse);
+            errors += compare_state(trial, frame, scalar, sse);
+        }
+
+        ps_free(NULL, scalar);
+        ps_free(NULL, sse);
+    }
+
+    return errors;
+}
+#endif
+
+int main(void)
+{
+#if defined(USE_SSE) && defined(PS_DEC)
+    if (!cpu_has_sse())
+        return TEST_SKIPPED;
+
+    if (check_ps())
+        return 1;
+    printf("SSE and scalar PS decoding match\n");
+    return 0;
+#else
+    return TEST_SKIPPED;
+#endif
+}
@@ -0,0 +1,256 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**/
+
+/* Compares the fast math mode (useFastMathSBR) of the SBR HF adjustment and
+ * the PS phase mixing against the exact code. The same random SBR and PS
+ * states are run through both, and the SNR of the fast output against the
+ * exact output has to be at least MIN_SNR_DB.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "structs.h"
+#include "sbr_dec.h"
+#include "sbr_syntax.h"
+#include "sbr_hfgen.h"
+#include "sbr_hfadj.h"
+#include "ps_dec.h"
+#include "sbr_state.h"
+
+#define TEST_SKIPPED 77
+
+/* the approximations have a relative error below 1e-5 */
+#define MIN_SNR_DB 90.0
+
+#define SBR_TRIALS 1000
+#define PS_TRIALS  200
+#define PS_FRAMES  4
+
+#if defined(SBR_DEC) && !defined(FIXED_POINT) && !defined(USE_DOUBLE_PRECISION)
+typedef struct
+{
+    double signal;
+    double noise;
+} snr_acc;
+
+static void snr_add(snr_acc *acc, real_t exact, real_t fast)
+{
+    acc->signal += (double)exact * exact;
+    acc->noise += (double)(exact - fast) * (exact - fast);
+}
+
+static int snr_check(const char *what, const snr_acc *acc)
+{
+    double snr;
+
+    if (acc->noise == 0)
+    {
+        printf("%s: identical output\n", what);
+        return 0;
+    }
+
+    snr = 10 * log10(acc->signal / acc->noise);
+    printf("%s: SNR %.1f dB\n", what, snr);
+
+    return (snr < MIN_SNR_DB) ? 1 : 0;
+}
+
+/* HF generation and adjustment of the same random states in exact and in
+ * fast math mode */
+static int check_sbr(const char *what, uint8_t lp, uint8_t sse)
+{
+    static sbr_info exact, fast;
+    static real_t G_exact[5*64], Q_exact[5*64], G_fast[5*64], Q_fast[5*64];
+    real_t deg_exact[64], deg_fast[64];
+    snr_acc acc = { 0, 0 };
+    uint8_t i, k;
+    int trial;
+
+    for (trial = 0; trial < SBR_TRIALS; trial++)
+    {
+        memset(&exact, 0, sizeof(exact));
+        memset(&fast, 0, sizeof(fast));
+        srand(trial + 1);
+        sbr_random_state(&exact, G_exact, Q_exact);
+        srand(trial + 1);
+        sbr_random_state(&fast, G_fast, Q_fast);
+
+        exact.lp = fast.lp = lp;
+#ifdef USE_SSE
+        exact.sse = fast.sse = sse;
+#else
+        (void)sse;
+#endif
+        exact.fast_math = 0;
+        fast.fast_math = 1;
+
+        memset(deg_exact, 0, sizeof(deg_exact));
+        memset(deg_fast, 0, sizeof(deg_fast));
+        hf_generation(&exact, exact.Xsbr[0], exact.Xsbr[0], deg_exact, 0);
+        hf_generation(&fast, fast.Xsbr[0], fast.Xsbr[0], deg_fast, 0);
+        hf_adjustment(&exact, exact.Xsbr[0], deg_exact, 0);
+        hf_adjustment(&fast, fast.Xsbr[0], deg_fast, 0);
+
+        for (i = 0; i < MAX_NTSRHFG; i++)
+        {
+            for (k = exact.kx; k < exact.kx + exact.M; k++)
+            {
+                snr_add(&acc, QMF_RE_AT(exact.Xsbr[0][i], k), QMF_RE_AT(fast.Xsbr[0][i], k));
+                if (!lp)
+                    snr_add(&acc, QMF_IM_AT(exact.Xsbr[0][i], k), QMF_IM_AT(fast.Xsbr[0][i], k));
+            }
+        }
+    }
+
+    return snr_check(what, &acc);
+}
+
+#ifdef PS_DEC
+/* random PS parameters with IPD/OPD, the only part fast math changes */
+static void ps_random_params(ps_info *ps, uint8_t use34)
+{
+    uint8_t env, b;
+
+    ps->ps_data_available = 1;
+    ps->use34hybrid_bands = use34;
+    ps->enable_iid = 1;
+    ps->enable_icc = 1;
+    ps->enable_ipdopd = 1;
+    ps->iid_mode = use34 ? ((rand() % 2) ? 2 : 5) : ((rand() % 2) ? 1 : 4);
+    ps->icc_mode = use34 ? ((rand() % 2) ? 2 : 5) : ((rand() % 2) ? 1 : 4);
+    ps->nr_iid_par = ps->nr_icc_par = use34 ? 34 : 20;
+    ps->nr_ipdopd_par = use34 ? 17 : 11;
+    ps->frame_class = 0;
+    ps->num_env = 1 + rand() % 4;
+    for (env = 0; env < ps->num_env; env++)
+    {
+        ps->iid_dt[env] = ps->icc_dt[env] = rand() % 2;
+        ps->ipd_dt[env] = ps->opd_dt[env] = rand() % 2;
+        for (b = 0; b < 34; b++)
+        {
+            ps->iid_index[env][b] = rand() % 5 - 2;
+            ps->icc_index[env][b] = rand() % 3;
+        }
+        for (b = 0; b < 17; b++)
+        {
+            ps->ipd_index[env][b] = rand() % 8;
+            ps->opd_index[env][b] = rand() % 8;
+        }
+    }
+}
+
+static int check_ps(void)
+{
+    static qmf_row_t left_exact[38], right_exact[38], left_fast[38], right_fast[38];
+    snr_acc acc = { 0, 0 };
+    int trial, frame;
+    uint8_t n, k;
+
+    for (trial = 0; trial < PS_TRIALS; trial++)
+    {
+        uint8_t slots = (trial & 1) ? RATE * NO_TIME_SLOTS : RATE * NO_TIME_SLOTS_960;
+        uint8_t use34 = (trial >> 1) & 1;
+        ps_info *exact = ps_init(NULL, 3 + trial % 6, slots, 0);
+        ps_info *fast = ps_init(NULL, 3 + trial % 6, slots, 1);
+
+        if (exact == NULL || fast == NULL)
+        {
+            printf("ps_init failed\n");
+            return 1;
+        }
+
+        for (frame = 0; frame < PS_FRAMES; frame++)
+        {
+            srand(trial * 100 + frame + 1);
+            ps_random_params(exact, use34);
+            srand(trial * 100 + frame + 1);
+            ps_random_params(fast, use34);
+
+            for (n = 0; n < 38; n++)
+            {
+                for (k = 0; k < 64; k++)
+                {
+                    QMF_RE_AT(left_exact[n], k) = random_real(-1e4, 1e4);
+                    QMF_IM_AT(left_exact[n], k) = random_real(-1e4, 1e4);
+                }
+            }
+            memcpy(left_fast, left_exact, sizeof(left_exact));
+
+            ps_decode(exact, left_exact, right_exact);
+            ps_decode(fast, left_fast, right_fast);
+
+            for (n = 0; n < slots; n++)
+            {
+                for (k = 0; k < 64; k++)
+                {
+                    snr_add(&acc, QMF_RE_AT(left_exact[n], k), QMF_RE_AT(left_fast[n], k));
+                    snr_add(&acc, QMF_IM_AT(left_exact[n], k), QMF_IM_AT(left_fast[n], k));
+                    snr_add(&acc, QMF_RE_AT(right_exact[n], k), QMF_RE_AT(right_fast[n], k));
+                    snr_add(&acc, QMF_IM_AT(right_exact[n], k), QMF_IM_AT(right_fast[n], k));
+                }
+            }
+        }
+
+        ps_free(NULL, exact);
+        ps_free(NULL, fast);
+    }
+
+    return snr_check("PS IPD/OPD mixing", &acc);
+}
+#endif
+#endif
+
+int main(void)
+{
+#if defined(SBR_DEC) && !defined(FIXED_POINT) && !defined(USE_DOUBLE_PRECISION)
+    int errors = 0;
+
+    errors += check_sbr("SBR HF adjustment", 0, 0);
+#ifdef USE_SSE
+    if (cpu_has_sse())
+        errors += check_sbr("SBR HF adjustment, SSE", 0, 1);
+#endif
+    errors += check_sbr("SBR HF adjustment, low power", 1, 0);
+#ifdef PS_DEC
+    errors += check_ps();
+#endif
+
+    if (errors)
+    {
+        printf("fast math SNR below %.0f dB\n", MIN_SNR_DB);
+        return 1;
+    }
+    return 0;
+#else
+    return TEST_SKIPPED;
+#endif
+}
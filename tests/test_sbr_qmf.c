@@ -0,0 +1,200 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**/
+
+/* Checks the SSE windowing and DCT-IV of the SBR QMF analysis and synthesis
+ * banks against the scalar code. Both do the operations in the same order,
+ * so the results have to be identical. Several frames are run through the
+ * same banks, so the ring buffer state is compared as well.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "structs.h"
+#include "sbr_dec.h"
+#include "sbr_qmf.h"
+#include "sbr_syntax.h"
+
+#define TEST_SKIPPED 77
+#define FRAMES 8
+
+#if defined(USE_SSE) && defined(SBR_DEC)
+static real_t random_sample(void)
+{
+    return (real_t)(rand() - RAND_MAX/2) / (RAND_MAX/2) * 32768;
+}
+
+static int compare(const char *what, uint8_t slots, int frame,
+                   const real_t *scalar, const real_t *sse, uint16_t n)
+{
+    uint16_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        if (scalar[i] != sse[i])
+        {
+            printf("%s, %d time slots, frame %d, value %d: scalar %g sse %g\n",
+                what, slots, frame, i, scalar[i], sse[i]);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int compare_rows(const char *what, uint8_t slots, int frame,
+                        qmf_row_t *scalar, qmf_row_t *sse)
+{
+    uint8_t l, k;
+
+    for (l = 0; l < slots; l++)
+    {
+        for (k = 0; k < 64; k++)
+        {
+            if (QMF_RE_AT(scalar[l], k) != QMF_RE_AT(sse[l], k) ||
+                QMF_IM_AT(scalar[l], k) != QMF_IM_AT(sse[l], k))
+            {
+                printf("%s, %d time slots, frame %d, slot %d band %d: scalar (%g, %g) sse (%g, %g)\n",
+                    what, slots, frame, l, k,
+                    QMF_RE_AT(scalar[l], k), QMF_IM_AT(scalar[l], k),
+                    QMF_RE_AT(sse[l], k), QMF_IM_AT(sse[l], k));
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int check_slots(sbr_info *sbr, uint8_t slots)
+{
+    static qmf_row_t X_scalar[MAX_NTSRHFG], X_sse[MAX_NTSRHFG];
+    static real_t in[64*MAX_NTSR];
+    static real_t out_scalar[64*MAX_NTSR], out_sse[64*MAX_NTSR];
+    qmfa_info *qmfa_scalar, *qmfa_sse;
+    qmfs_info *qmfs32_scalar, *qmfs32_sse, *qmfs64_scalar, *qmfs64_sse;
+    int errors = 0;
+    uint16_t i;
+    uint8_t l, k;
+    int frame;
+
+    sbr->numTimeSlotsRate = slots;
+
+    qmfa_scalar = qmfa_init(NULL, 32);
+    qmfa_sse = qmfa_init(NULL, 32);
+    qmfs32_scalar = qmfs_init(NULL, 32);
+    qmfs32_sse = qmfs_init(NULL, 32);
+    qmfs64_scalar = qmfs_init(NULL, 64);
+    qmfs64_sse = qmfs_init(NULL, 64);
+    if (!qmfa_scalar || !qmfa_sse || !qmfs32_scalar || !qmfs32_sse ||
+        !qmfs64_scalar || !qmfs64_sse)
+    {
+        printf("QMF bank allocation failed\n");
+        return 1;
+    }
+    qmfa_scalar->sse = 0;
+    qmfa_sse->sse = 1;
+    qmfs32_scalar->sse = 0;
+    qmfs32_sse->sse = 1;
+    qmfs64_scalar->sse = 0;
+    qmfs64_sse->sse = 1;
+
+    for (frame = 0; frame < FRAMES && !errors; frame++)
+    {
+        /* analysis */
+        for (i = 0; i < 32*slots; i++)
+            in[i] = random_sample();
+
+        memset(X_scalar, 0, sizeof(X_scalar));
+        memset(X_sse, 0, sizeof(X_sse));
+        sbr_qmf_analysis_32(sbr, qmfa_scalar, in, X_scalar, 0, 32);
+        sbr_qmf_analysis_32(sbr, qmfa_sse, in, X_sse, 0, 32);
+        errors += compare_rows("analysis", slots, frame, X_scalar, X_sse);
+
+        /* synthesis, from random subband samples */
+        for (l = 0; l < slots; l++)
+        {
+            for (k = 0; k < 64; k++)
+            {
+                QMF_RE_AT(X_scalar[l], k) = random_sample();
+                QMF_IM_AT(X_scalar[l], k) = random_sample();
+            }
+        }
+        memcpy(X_sse, X_scalar, sizeof(X_scalar));
+
+        sbr_qmf_synthesis_32(sbr, qmfs32_scalar, X_scalar, out_scalar);
+        sbr_qmf_synthesis_32(sbr, qmfs32_sse, X_sse, out_sse);
+        errors += compare("synthesis 32", slots, frame, out_scalar, out_sse, 32*slots);
+
+        sbr_qmf_synthesis_64(sbr, qmfs64_scalar, X_scalar, out_scalar);
+        sbr_qmf_synthesis_64(sbr, qmfs64_sse, X_sse, out_sse);
+        errors += compare("synthesis 64", slots, frame, out_scalar, out_sse, 64*slots);
+    }
+
+    qmfa_end(NULL, qmfa_scalar);
+    qmfa_end(NULL, qmfa_sse);
+    qmfs_end(NULL, qmfs32_scalar);
+    qmfs_end(NULL, qmfs32_sse);
+    qmfs_end(NULL, qmfs64_scalar);
+    qmfs_end(NULL, qmfs64_sse);
+
+    return errors;
+}
+#endif
+
+int main(void)
+{
+#if defined(USE_SSE) && defined(SBR_DEC)
+    sbr_info *sbr;
+    int errors = 0;
+
+    if (!cpu_has_sse())
+        return TEST_SKIPPED;
+
+    /* the QMF banks only use numTimeSlotsRate and lp */
+    sbr = (sbr_info*)calloc(1, sizeof(sbr_info));
+    if (sbr == NULL)
+        return 1;
+
+    srand(1);
+    /* 1024 and 960 sample frames */
+    errors += check_slots(sbr, RATE * NO_TIME_SLOTS);
+    errors += check_slots(sbr, RATE * NO_TIME_SLOTS_960);
+
+    free(sbr);
+
+    if (errors)
+        return 1;
+    printf("SSE and scalar QMF banks match\n");
+    return 0;
+#else
+    return TEST_SKIPPED;
+#endif
+}
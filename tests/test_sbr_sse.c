@@ -0,0 +1,148 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**/
+
+/* Checks the SSE kernels of the SBR HF generation (auto correlation and
+ * prediction coefficients) and HF adjustment (envelope estimation, gain
+ * limiter, gain boost and HF assembly) against the scalar code. Both do
+ * the same float operations in the same order, so the results have to be
+ * identical. The fast math mode uses different approximations in the two,
+ * test_sbr_fast_math checks it against the exact code.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "structs.h"
+#include "sbr_dec.h"
+#include "sbr_syntax.h"
+#include "sbr_hfgen.h"
+#include "sbr_hfadj.h"
+#include "sbr_state.h"
+
+#define TEST_SKIPPED 77
+#define TRIALS 1000
+
+#if defined(USE_SSE) && defined(SBR_DEC) && !defined(SBR_LOW_POWER)
+static int compare_rows(const char *what, int trial,
+                        qmf_row_t *scalar, qmf_row_t *sse)
+{
+    uint8_t l, k;
+
+    for (l = 0; l < MAX_NTSRHFG; l++)
+    {
+        for (k = 0; k < 64; k++)
+        {
+            if (QMF_RE_AT(scalar[l], k) != QMF_RE_AT(sse[l], k) ||
+                QMF_IM_AT(scalar[l], k) != QMF_IM_AT(sse[l], k))
+            {
+                printf("%s, trial %d, slot %d band %d: scalar (%g, %g) sse (%g, %g)\n",
+                    what, trial, l, k,
+                    QMF_RE_AT(scalar[l], k), QMF_IM_AT(scalar[l], k),
+                    QMF_RE_AT(sse[l], k), QMF_IM_AT(sse[l], k));
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* HF generation and adjustment of the same random states with the SSE
+ * kernels on and off */
+static int check_sbr(const char *what, uint8_t lp)
+{
+    static sbr_info scalar, sse;
+    static real_t G_scalar[5*64], Q_scalar[5*64], G_sse[5*64], Q_sse[5*64];
+    real_t deg_scalar[64], deg_sse[64];
+    int errors = 0;
+    int trial;
+
+    for (trial = 0; trial < TRIALS && !errors; trial++)
+    {
+        memset(&scalar, 0, sizeof(scalar));
+        memset(&sse, 0, sizeof(sse));
+        srand(trial + 1);
+        sbr_random_state(&scalar, G_scalar, Q_scalar);
+        srand(trial + 1);
+        sbr_random_state(&sse, G_sse, Q_sse);
+
+        scalar.lp = sse.lp = lp;
+        scalar.sse = 0;
+        sse.sse = 1;
+
+        memset(deg_scalar, 0, sizeof(deg_scalar));
+        memset(deg_sse, 0, sizeof(deg_sse));
+        hf_generation(&scalar, scalar.Xsbr[0], scalar.Xsbr[0], deg_scalar, 0);
+        hf_generation(&sse, sse.Xsbr[0], sse.Xsbr[0], deg_sse, 0);
+        errors += compare_rows(what, trial, scalar.Xsbr[0], sse.Xsbr[0]);
+        if (memcmp(deg_scalar, deg_sse, sizeof(deg_scalar)))
+        {
+            printf("%s, trial %d: aliasing degrees differ\n", what, trial);
+            errors++;
+        }
+        if (errors)
+            break;
+
+        hf_adjustment(&scalar, scalar.Xsbr[0], deg_scalar, 0);
+        hf_adjustment(&sse, sse.Xsbr[0], deg_sse, 0);
+        errors += compare_rows(what, trial, scalar.Xsbr[0], sse.Xsbr[0]);
+
+        /* the smoothed gains are carried over to the next frame */
+        if (memcmp(G_scalar, G_sse, sizeof(G_scalar)) ||
+            memcmp(Q_scalar, Q_sse, sizeof(Q_scalar)))
+        {
+            printf("%s, trial %d: gain history differs\n", what, trial);
+            errors++;
+        }
+    }
+
+    return errors;
+}
+#endif
+
+int main(void)
+{
+#if defined(USE_SSE) && defined(SBR_DEC) && !defined(SBR_LOW_POWER)
+    int errors = 0;
+
+    if (!cpu_has_sse())
+        return TEST_SKIPPED;
+
+    errors += check_sbr("HQ SBR", 0);
+    errors += check_sbr("low power SBR", 1);
+
+    if (errors)
+        return 1;
+    printf("SSE and scalar SBR HF generation and adjustment match\n");
+    return 0;
+#else
+    return TEST_SKIPPED;
+#endif
+}
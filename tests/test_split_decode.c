@@ -0,0 +1,394 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**/
+
+/* Checks the split decoding interface against NeAACDecDecode. A generated
+ * stereo stream is decoded with NeAACDecDecode, with NeAACDecParse and
+ * NeAACDecSynthesize on one thread, and with NeAACDecParse on a second
+ * thread when the library has thread support. Halfway through, the stream
+ * seeks back with NeAACDecPostSeekReset. The PCM and frame info of every
+ * frame have to be identical.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "structs.h"
+#include "tpool.h"
+#include "aac_stream.h"
+
+#define FRAMES   40
+/* frames decoded before the seek, and the frame the seek goes back to */
+#define SEEK_AT  24
+#define SEEK_TO  8
+#define OUTPUTS  (SEEK_AT + FRAMES - SEEK_TO)
+
+typedef struct
+{
+    NeAACDecFrameInfo info;
+    int16_t pcm[2*1024];
+} decoded_frame;
+
+static uint8_t stream[FRAMES][AAC_STREAM_MAX_FRAME];
+static unsigned long stream_size[FRAMES];
+static uint8_t asc[2];
+
+static NeAACDecHandle open_decoder(void)
+{
+    NeAACDecHandle hDecoder = NeAACDecOpen();
+    unsigned long samplerate;
+    unsigned char channels;
+
+    if (hDecoder == NULL)
+        return NULL;
+    if (NeAACDecInit2(hDecoder, asc, sizeof(asc), &samplerate, &channels) < 0)
+    {
+        NeAACDecClose(hDecoder);
+        return NULL;
+    }
+
+    return hDecoder;
+}
+
+static void keep_frame(decoded_frame *out, const NeAACDecFrameInfo *info, const void *samples)
+{
+    out->info = *info;
+    memset(out->pcm, 0, sizeof(out->pcm));
+    if (samples != NULL && info->samples <= 2*1024)
+        memcpy(out->pcm, samples, info->samples * sizeof(int16_t));
+}
+
+static int compare_frames(const char *what, const decoded_frame *ref,
+                          const decoded_frame *out, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        const NeAACDecFrameInfo *a = &ref[i].info, *b = &out[i].info;
+
+        if (a->bytesconsumed != b->bytesconsumed || a->samples != b->samples ||
+            a->channels != b->channels || a->error != b->error ||
+            a->samplerate != b->samplerate || a->sbr != b->sbr ||
+            a->object_type != b->object_type || a->header_type != b->header_type ||
+            a->num_front_channels != b->num_front_channels ||
+            a->num_side_channels != b->num_side_channels ||
+            a->num_back_channels != b->num_back_channels ||
+            a->num_lfe_channels != b->num_lfe_channels || a->ps != b->ps ||
+            memcmp(a->channel_position, b->channel_position, sizeof(a->channel_position)))
+        {
+            printf("%s, output %d: frame info differs\n", what, i);
+            return 1;
+        }
+        if (memcmp(ref[i].pcm, out[i].pcm, sizeof(ref[i].pcm)))
+        {
+            printf("%s, output %d: PCM differs\n", what, i);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* frames 0 to before-1, a seek back to SEEK_TO, then the rest */
+static int decode_reference(decoded_frame *out, int before)
+{
+    NeAACDecHandle hDecoder = open_decoder();
+    NeAACDecFrameInfo info;
+    void *samples;
+    int i, n = 0;
+
+    if (hDecoder == NULL)
+        return -1;
+
+    for (i = 0; i < before; i++)
+    {
+        samples = NeAACDecDecode(hDecoder, &info, stream[i], stream_size[i]);
+        keep_frame(&out[n++], &info, samples);
+    }
+    NeAACDecPostSeekReset(hDecoder, SEEK_TO);
+    for (i = SEEK_TO; i < FRAMES; i++)
+    {
+        samples = NeAACDecDecode(hDecoder, &info, stream[i], stream_size[i]);
+        keep_frame(&out[n++], &info, samples);
+    }
+
+    NeAACDecClose(hDecoder);
+    return n;
+}
+
+/* parses a frame, making room in the queue when it is full */
+static int parse_frame(NeAACDecHandle hDecoder, int i, decoded_frame *out, int *n)
+{
+    NeAACDecFrameInfo info;
+    void *samples;
+
+    while (!NeAACDecParse(hDecoder, &info, stream[i], stream_size[i]))
+    {
+        if (info.error != 34)
+        {
+            printf("NeAACDecParse: %s\n", NeAACDecGetErrorMessage(info.error));
+            return 1;
+        }
+        if (*n == OUTPUTS)
+        {
+            printf("one thread: more frames output than parsed\n");
+            return 1;
+        }
+        samples = NeAACDecSynthesize(hDecoder, &info);
+        if (info.error == 35)
+        {
+            printf("one thread: queue full and empty at the same time\n");
+            return 1;
+        }
+        keep_frame(&out[(*n)++], &info, samples);
+    }
+
+    return 0;
+}
+
+/* the seek drops the frames still in the queue, so fewer frames are
+ * output before it than were parsed */
+static int check_one_thread(decoded_frame *ref, decoded_frame *out)
+{
+    NeAACDecHandle hDecoder = open_decoder();
+    NeAACDecFrameInfo info;
+    void *samples;
+    int i, before, parsed, n = 0;
+    int errors = 0;
+
+    if (hDecoder == NULL)
+        return 1;
+
+    for (i = 0; i < SEEK_AT && !errors; i++)
+        errors += parse_frame(hDecoder, i, out, &n);
+    before = n;
+    NeAACDecPostSeekReset(hDecoder, SEEK_TO);
+
+    parsed = 0;
+    for (i = SEEK_TO; i < FRAMES && !errors; i++, parsed++)
+        errors += parse_frame(hDecoder, i, out, &n);
+    for (i = n - before; i < parsed && !errors; i++)
+    {
+        samples = NeAACDecSynthesize(hDecoder, &info);
+        keep_frame(&out[n++], &info, samples);
+    }
+
+    /* the queue is empty now */
+    if (!errors && (NeAACDecSynthesize(hDecoder, &info) != NULL || info.error != 35))
+    {
+        printf("one thread: queue not empty after the last frame\n");
+        errors++;
+    }
+    NeAACDecClose(hDecoder);
+
+    if (!errors && decode_reference(ref, before) != n)
+    {
+        printf("one thread: %d frames output\n", n);
+        errors++;
+    }
+    if (!errors)
+        errors += compare_frames("one thread", ref, out, n);
+
+    return errors;
+}
+
+#ifdef USE_THREADS
+typedef struct
+{
+    NeAACDecHandle hDecoder;
+    int first;
+    int last;
+    decoded_frame *out;
+    int n;
+    int parsed_all;
+    int synthesized_all;
+    int failed;
+} pipeline;
+
+/* flags shared by the two threads */
+static int flag_get(int *flag)
+{
+#if defined(_MSC_VER)
+    return *(volatile int*)flag;
+#elif defined(__GNUC__)
+    return __atomic_load_n(flag, __ATOMIC_ACQUIRE);
+#else
+    return *flag;
+#endif
+}
+
+static void flag_set(int *flag)
+{
+#if defined(_MSC_VER)
+    *(volatile int*)flag = 1;
+#elif defined(__GNUC__)
+    __atomic_store_n(flag, 1, __ATOMIC_RELEASE);
+#else
+    *flag = 1;
+#endif
+}
+
+/* job 0 parses the frames, job 1 synthesizes them */
+static void pipeline_job(void *arg, unsigned long job)
+{
+    pipeline *p = (pipeline*)arg;
+    NeAACDecFrameInfo info;
+    void *samples;
+    int i;
+
+    /* a queue that stays full or empty after the other side is done
+       would never drain; the flag is read before the attempt */
+    for (i = p->first; i < p->last && !flag_get(&p->failed); i++)
+    {
+        if (job == 0)
+        {
+            for (;;)
+            {
+                int synthesized_all = flag_get(&p->synthesized_all);
+
+                if (NeAACDecParse(p->hDecoder, &info, stream[i], stream_size[i]) || flag_get(&p->failed))
+                    break;
+                if (info.error != 34)
+                {
+                    printf("NeAACDecParse: %s\n", NeAACDecGetErrorMessage(info.error));
+                    flag_set(&p->failed);
+                } else if (synthesized_all) {
+                    printf("two threads: queue full after the last frame\n");
+                    flag_set(&p->failed);
+                }
+            }
+        } else {
+            for (;;)
+            {
+                int parsed_all = flag_get(&p->parsed_all);
+
+                samples = NeAACDecSynthesize(p->hDecoder, &info);
+                if (samples != NULL || info.error != 35 || flag_get(&p->failed))
+                    break;
+                if (parsed_all)
+                {
+                    printf("two threads: queue empty before the last frame\n");
+                    flag_set(&p->failed);
+                }
+            }
+            if (!flag_get(&p->failed))
+                keep_frame(&p->out[p->n++], &info, samples);
+        }
+    }
+
+    if (job == 0)
+        flag_set(&p->parsed_all);
+    else
+        flag_set(&p->synthesized_all);
+}
+
+static int check_two_threads(decoded_frame *ref, decoded_frame *out)
+{
+    tpool *pool = tpool_init(NULL, 2);
+    pipeline p;
+    int errors = 0;
+
+    /* no threads could be started */
+    if (pool == NULL)
+        return 0;
+
+    memset(&p, 0, sizeof(p));
+    p.hDecoder = open_decoder();
+    p.out = out;
+    if (p.hDecoder == NULL)
+    {
+        tpool_end(NULL, pool);
+        return 1;
+    }
+
+    /* both threads are done with the frames before the seek */
+    p.first = 0;
+    p.last = SEEK_AT;
+    tpool_run(pool, pipeline_job, &p, 2);
+    NeAACDecPostSeekReset(p.hDecoder, SEEK_TO);
+    p.first = SEEK_TO;
+    p.last = FRAMES;
+    p.parsed_all = p.synthesized_all = 0;
+    if (!p.failed)
+        tpool_run(pool, pipeline_job, &p, 2);
+
+    NeAACDecClose(p.hDecoder);
+    tpool_end(NULL, pool);
+
+    if (p.failed)
+        return 1;
+    if (decode_reference(ref, SEEK_AT) != p.n)
+    {
+        printf("two threads: %d frames output\n", p.n);
+        errors++;
+    }
+    if (!errors)
+        errors += compare_frames("two threads", ref, out, p.n);
+
+    return errors;
+}
+#endif
+
+int main(void)
+{
+    static decoded_frame ref[OUTPUTS], out[OUTPUTS];
+    int errors = 0;
+    int i;
+
+    stream_seed(1);
+    aac_stream_config(asc, 2);
+    for (i = 0; i < FRAMES; i++)
+        stream_size[i] = aac_stream_frame(stream[i], sizeof(stream[i]), 2);
+
+    /* the generated stream has to decode without errors */
+    if (decode_reference(ref, SEEK_AT) != OUTPUTS)
+    {
+        printf("decoder setup failed\n");
+        return 1;
+    }
+    for (i = 0; i < OUTPUTS; i++)
+    {
+        if (ref[i].info.error)
+        {
+            printf("output %d: %s\n", i, NeAACDecGetErrorMessage(ref[i].info.error));
+            return 1;
+        }
+    }
+
+    errors += check_one_thread(ref, out);
+#ifdef USE_THREADS
+    errors += check_two_threads(ref, out);
+#endif
+
+    if (errors)
+        return 1;
+    printf("split decoding matches NeAACDecDecode\n");
+    return 0;
+}